@@ -0,0 +1,209 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_BENCH_IO_BENCHMARK_HPP
+#define BOOST_ASTRONOMY_BENCH_IO_BENCHMARK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/io/default_card_policy.hpp>
+
+namespace io_bench {
+
+    /**
+     * @brief Number of calls made to the global operator new ( defined in main.cpp )
+    */
+    extern std::atomic<std::size_t> allocation_count;
+
+    /**
+     * @brief Options controlling how long each benchmark is run
+    */
+    struct benchmark_options {
+        double min_time = 0.5;
+        std::size_t min_iterations = 3;
+        std::string filter;
+        std::string samples_directory;
+        std::string scratch_directory;
+    };
+
+    /**
+     * @brief Measurements of a single benchmark
+    */
+    struct benchmark_result {
+        std::string name;
+        std::size_t iterations;
+        double seconds;
+        std::size_t bytes_per_iteration;
+        std::size_t allocations;
+
+        /**
+         * @brief Writes the result as a single line of JSON
+        */
+        void print(std::ostream& out) const {
+            double ns_per_iteration = seconds * 1e9 / static_cast<double>(iterations);
+            double bytes_per_second = seconds > 0 ?
+                static_cast<double>(bytes_per_iteration) * static_cast<double>(iterations) / seconds : 0.0;
+            double allocations_per_iteration = static_cast<double>(allocations) / static_cast<double>(iterations);
+
+            out << "{\"name\":\"" << name << "\""
+                << ",\"iterations\":" << iterations
+                << ",\"ns_per_iteration\":" << ns_per_iteration
+                << ",\"bytes_per_iteration\":" << bytes_per_iteration
+                << ",\"bytes_per_second\":" << bytes_per_second
+                << ",\"allocations_per_iteration\":" << allocations_per_iteration
+                << "}" << std::endl;
+        }
+    };
+
+    /**
+     * @brief Runs the benchmarks registered with it and reports the results
+    */
+    class benchmark_runner {
+        benchmark_options options;
+        std::vector<benchmark_result> results;
+    public:
+        explicit benchmark_runner(const benchmark_options& opts) :options(opts) {}
+
+        const benchmark_options& get_options() const { return options; }
+
+        const std::vector<benchmark_result>& get_results() const { return results; }
+
+        /**
+         * @brief Returns true if the benchmark with given name is selected by the filter
+        */
+        bool selected(const std::string& name) const {
+            return options.filter.empty() || name.find(options.filter) != std::string::npos;
+        }
+
+        /**
+         * @brief Runs the function repeatedly until both minimum time and iterations are reached
+         * @param[in] name Name of the benchmark
+         * @param[in] bytes_per_iteration Amount of data processed by a single call of function
+         * @param[in] function The operation to be measured
+        */
+        void run(const std::string& name, std::size_t bytes_per_iteration, const std::function<void()>& function) {
+            if (!selected(name)) { return; }
+
+            function(); // warm up caches and lazily initialized state
+
+            std::size_t iterations = 0;
+            std::size_t allocations_before = allocation_count.load();
+            auto start = std::chrono::steady_clock::now();
+            double elapsed = 0;
+            while (iterations < options.min_iterations || elapsed < options.min_time) {
+                function();
+                iterations++;
+                elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            }
+
+            benchmark_result result{ name, iterations, elapsed, bytes_per_iteration,
+                allocation_count.load() - allocations_before };
+            result.print(std::cout);
+            results.push_back(result);
+        }
+    };
+
+    /**
+     * @brief Reader over an in memory buffer which mimics fits_stream
+     * @note  Used to measure parsing without the cost of disk access
+    */
+    struct memory_reader {
+        std::string buffer;
+        std::size_t position = 0;
+
+        memory_reader() {}
+        explicit memory_reader(const std::string& data) :buffer(data) {}
+
+        std::string read(std::size_t num_bytes) {
+            std::string data = buffer.substr(position, num_bytes);
+            position += num_bytes;
+            return data;
+        }
+        void set_reading_pos(std::size_t pos) { position = pos; }
+        std::size_t get_current_pos() { return position; }
+        bool at_end() { return position >= buffer.size(); }
+        std::size_t find_unit_end() { return (position + 2879) / 2880 * 2880; }
+        void set_unit_end() { position = find_unit_end(); }
+    };
+
+    /**
+     * @brief Writer into an in memory buffer which mimics fits_stream
+    */
+    struct memory_writer {
+        std::string buffer;
+
+        bool write(const std::string& data) {
+            buffer += data;
+            return true;
+        }
+        bool write(const std::string& data, std::size_t position) {
+            if (buffer.size() < position + data.size()) { buffer.resize(position + data.size(), '\0'); }
+            buffer.replace(position, data.size(), data);
+            return true;
+        }
+        std::size_t get_current_pos() { return buffer.size(); }
+        std::size_t find_unit_end() { return (buffer.size() + 2879) / 2880 * 2880; }
+    };
+
+    /**
+     * @brief Builds a raw FITS header ( padded to logical records ) card by card
+    */
+    class header_builder {
+        std::string cards;
+    public:
+        template<typename ValueType>
+        header_builder& add(const std::string& key, ValueType value) {
+            boost::astronomy::io::card<boost::astronomy::io::card_policy> new_card;
+            new_card.create_card(key, value);
+            cards += new_card.raw_card().to_string();
+            return *this;
+        }
+
+        std::string build() const {
+            std::string raw_header = cards + "END" + std::string(77, ' ');
+            raw_header.append((2880 - raw_header.size() % 2880) % 2880, ' ');
+            return raw_header;
+        }
+    };
+
+    /**
+     * @brief Returns num_bytes of deterministic pseudo random data
+    */
+    inline std::string random_bytes(std::size_t num_bytes, std::uint64_t seed) {
+        std::mt19937_64 engine(seed);
+        std::string data(num_bytes, '\0');
+        for (std::size_t i = 0; i < num_bytes; i++) {
+            data[i] = static_cast<char>(engine() & 0xFF);
+        }
+        return data;
+    }
+
+    /**
+     * @brief Pads the data unit to the end of logical record
+    */
+    inline std::string pad_data(std::string data, char fill = '\0') {
+        data.append((2880 - data.size() % 2880) % 2880, fill);
+        return data;
+    }
+
+    void register_header_benchmarks(benchmark_runner& runner);
+    void register_image_benchmarks(benchmark_runner& runner);
+    void register_table_benchmarks(benchmark_runner& runner);
+    void register_end_to_end_benchmarks(benchmark_runner& runner);
+
+} // namespace io_bench
+
+#endif // BOOST_ASTRONOMY_BENCH_IO_BENCHMARK_HPP
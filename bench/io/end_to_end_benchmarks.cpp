@@ -0,0 +1,239 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/concurrent_fits_reader.hpp>
+#include <boost/astronomy/io/binary_table_writer.hpp>
+#include <boost/astronomy/io/image_writer.hpp>
+#include <boost/astronomy/io/arrow_writer.hpp>
+#include <boost/astronomy/io/binary_data_converter.hpp>
+#include <boost/astronomy/io/csv.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <boost/astronomy/io/uring_reader.hpp>
+
+#include "benchmark.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace boost::astronomy::io;
+
+namespace io_bench {
+
+    namespace {
+
+        std::size_t file_size(const std::string& path) {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            return file ? static_cast<std::size_t>(file.tellg()) : 0;
+        }
+
+        /**
+         * @brief Writes the file back and evicts it from the page cache, so that the next read reaches the device
+         * @return false if the page cache cannot be dropped on this platform
+        */
+        bool evict_from_page_cache(const std::string& path) {
+#if defined(__linux__)
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) { return false; }
+            bool evicted = fdatasync(fd) == 0 && posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+            ::close(fd);
+            return evicted;
+#else
+            (void)path;
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Prints the time, bytes, seeks and allocations spent in every phase of reading each HDU
+        */
+        void print_phases(const std::string& name, const std::string& path) {
+            io_statistics statistics([]() { return allocation_count.load(); });
+            auto reader = instrumented_fits::open(path, reading_options::read_entire_hdus, statistics);
+
+            for (auto const& hdu : reader.get_observer().hdus) {
+                std::cout << "{\"name\":\"" << name << "/" << hdu.hdu_name << "\""
+                          << ",\"seeks\":" << hdu.seeks
+                          << ",\"header_parse_ns\":" << hdu.header_parse.elapsed.count()
+                          << ",\"header_bytes\":" << hdu.header_parse.bytes_read
+                          << ",\"header_allocations\":" << hdu.header_parse.allocations
+                          << ",\"data_read_ns\":" << hdu.data_read.elapsed.count()
+                          << ",\"data_bytes\":" << hdu.data_read.bytes_read
+                          << ",\"data_allocations\":" << hdu.data_read.allocations
+                          << ",\"decode_ns\":" << hdu.decode.elapsed.count()
+                          << ",\"decode_allocations\":" << hdu.decode.allocations
+                          << "}" << std::endl;
+            }
+        }
+    }
+
+    void register_end_to_end_benchmarks(benchmark_runner& runner) {
+        const char* sample_files[] = { "fits_sample1.fits", "fits_sample2.fits", "fits_sample3.fits" };
+
+        for (auto sample_file : sample_files) {
+            std::string path = runner.get_options().samples_directory + sample_file;
+            std::size_t size = file_size(path);
+            if (size == 0) { continue; }
+
+            std::string name(sample_file);
+            name = name.substr(0, name.find('.'));
+
+            if (runner.selected("fits/phases/" + name)) {
+                print_phases("fits/phases/" + name, path);
+            }
+
+            runner.run("fits/open_headers/" + name, size, [&path]() {
+                auto reader = fits::open(path, reading_options::read_only_headers);
+                (void)reader;
+            });
+
+            runner.run("fits/open_entire/" + name, size, [&path]() {
+                auto reader = fits::open(path, reading_options::read_entire_hdus);
+                (void)reader;
+            });
+
+            // Every HDU is requested by four threads sharing one reader
+            runner.run("fits/concurrent_open/" + name, size, [&path]() {
+                concurrent_fits_reader reader(path);
+                std::vector<std::thread> workers;
+                for (std::size_t thread_id = 0; thread_id < 4; thread_id++) {
+                    workers.emplace_back([&reader, thread_id]() {
+                        for (std::size_t step = 0; step < reader.total_hdus(); step++) {
+                            (void)reader[(thread_id + step) % reader.total_hdus()];
+                        }
+                    });
+                }
+                for (auto& worker : workers) { worker.join(); }
+            });
+
+            std::string output_path = runner.get_options().scratch_directory + "bench_" + name + ".fits";
+            auto reader = fits::open(path, reading_options::read_entire_hdus);
+            runner.run("fits/write_to/" + name, size, [&reader, &output_path]() {
+                reader.write_to(output_path);
+            });
+            std::remove(output_path.c_str());
+        }
+
+        const std::size_t table_rows = 100000;
+        std::vector<std::int32_t> ids(table_rows);
+        std::vector<float> fluxes(table_rows, 1.5f);
+        std::vector<double> positions(3 * table_rows, 2.5);
+        for (std::size_t row = 0; row < table_rows; row++) { ids[row] = static_cast<std::int32_t>(row); }
+
+        std::vector<column> columns = { column("J"), column("E"), column("3D") };
+        std::string table_path = runner.get_options().scratch_directory + "bench_written_table.fits";
+        runner.run("table/binary_table_writer/write_columns", table_rows * 32, [&]() {
+            binary_table_writer writer(table_path, columns);
+            writer.write_columns(table_rows, ids.data(), fluxes.data(), positions.data());
+        });
+
+        if (runner.selected("table/arrow_writer/write_arrow") || runner.selected("table/csv/write_csv") ||
+            runner.selected("table/csv/read_csv")) {
+            {
+                binary_table_writer writer(table_path, columns, "CATALOG");
+                writer.write_columns(table_rows, ids.data(), fluxes.data(), positions.data());
+            }
+            fits_stream table_file;
+            table_file.set_file(table_path);
+            table_file.set_reading_pos(2880);
+            header<card_policy> table_header;
+            table_header.read_header(table_file);
+            std::string table_data = table_file.read(table_rows * 32);
+            basic_binary_table_extension<card_policy, binary_data_converter> table(table_header, "");
+
+            std::string arrow_path = runner.get_options().scratch_directory + "bench_written_table.arrow";
+            runner.run("table/arrow_writer/write_arrow", table_rows * 32, [&]() {
+                write_arrow(table, table_data, arrow_path);
+            });
+            std::remove(arrow_path.c_str());
+
+            std::string csv_path = runner.get_options().scratch_directory + "bench_written_table.csv";
+            std::string imported_path = runner.get_options().scratch_directory + "bench_imported_table.fits";
+            runner.run("table/csv/write_csv", table_rows * 32, [&]() {
+                write_csv(table, table_data, csv_path);
+            });
+            write_csv(table, table_data, csv_path);
+            runner.run("table/csv/read_csv", table_rows * 32, [&]() {
+                read_csv(csv_path, imported_path, columns);
+            });
+            std::remove(csv_path.c_str());
+            std::remove(imported_path.c_str());
+        }
+        std::remove(table_path.c_str());
+
+        const std::size_t image_width = 4096, image_height = 2048, block_rows = 64;
+        std::vector<double> image_rows(image_width * block_rows, 1.25);
+        std::string image_path = runner.get_options().scratch_directory + "bench_written_image.fits";
+        runner.run("image/image_writer/write_rows", image_width * image_height * 4, [&]() {
+            image_writer writer(image_path, bitpix::_B32, { image_width, image_height });
+            for (std::size_t row = 0; row < image_height; row += block_rows) {
+                writer.write_rows(image_rows.data(), block_rows);
+            }
+        });
+
+        // Reading the pixels back in one call, queued reads at a depth of 1 against the default depth of 32. The
+        // cold runs evict the file from the page cache before every read, so that the depth reaches the device
+        const std::size_t image_bytes = image_width * image_height * 4;
+        bool reads_selected = false;
+        for (const char* name : { "fits_stream", "uring_depth_1", "uring_depth_32" }) {
+            reads_selected = reads_selected || runner.selected(std::string("image/read/") + name) ||
+                runner.selected(std::string("image/read/cold/") + name);
+        }
+        if (reads_selected) {
+            {
+                image_writer writer(image_path, bitpix::_B32, { image_width, image_height });
+                for (std::size_t row = 0; row < image_height; row += block_rows) {
+                    writer.write_rows(image_rows.data(), block_rows);
+                }
+            }
+            std::string pixels(image_bytes, ' ');
+            runner.run("image/read/fits_stream", image_bytes, [&]() {
+                fits_stream file;
+                file.set_file(image_path);
+                file.set_reading_pos(2880);
+                pixels = file.read(image_bytes);
+            });
+            for (unsigned depth : { 1u, 32u }) {
+                uring_options options;
+                options.queue_depth = depth;
+                uring_read_queue queue(image_path, options);
+                runner.run("image/read/uring_depth_" + std::to_string(depth), image_bytes, [&]() {
+                    queue.read(2880, &pixels[0], image_bytes);
+                });
+            }
+
+            if (evict_from_page_cache(image_path)) {
+                runner.run("image/read/cold/fits_stream", image_bytes, [&]() {
+                    evict_from_page_cache(image_path);
+                    fits_stream file;
+                    file.set_file(image_path);
+                    file.set_reading_pos(2880);
+                    pixels = file.read(image_bytes);
+                });
+                for (unsigned depth : { 1u, 32u }) {
+                    uring_options options;
+                    options.queue_depth = depth;
+                    uring_read_queue queue(image_path, options);
+                    runner.run("image/read/cold/uring_depth_" + std::to_string(depth), image_bytes, [&]() {
+                        evict_from_page_cache(image_path);
+                        queue.read(2880, &pixels[0], image_bytes);
+                    });
+                }
+            }
+        }
+        std::remove(image_path.c_str());
+    }
+}
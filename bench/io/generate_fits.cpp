@@ -0,0 +1,113 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/astronomy/io/fits_generator.hpp>
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+    void print_usage() {
+        std::cerr << "Usage: astronomy_fits_generator <output> [--seed=<n>] [--image=<bitpix>:<n1>x<n2>[x<n3>...]]...\n"
+                  << "                                         [--table=<rows>x<columns>]... [--extensions=<count>]\n"
+                  << "  --image       The first image becomes the primary HDU, others IMAGE extensions\n"
+                  << "  --table       BINTABLE with columns cycling through all the supported types\n"
+                  << "  --extensions  Appends count small IMAGE extensions\n"
+                  << "Example: astronomy_fits_generator big.fits --image=-32:32768x32768 --table=5000000x200\n";
+    }
+
+    bool parse_bitpix(const std::string& value, bitpix& bitpix_value) {
+        if (value == "8") { bitpix_value = bitpix::B8; }
+        else if (value == "16") { bitpix_value = bitpix::B16; }
+        else if (value == "32") { bitpix_value = bitpix::B32; }
+        else if (value == "-32") { bitpix_value = bitpix::_B32; }
+        else if (value == "-64") { bitpix_value = bitpix::_B64; }
+        else { return false; }
+        return true;
+    }
+
+    std::vector<std::size_t> parse_dimensions(const std::string& value) {
+        std::vector<std::size_t> dimensions;
+        std::size_t start = 0;
+        while (start <= value.length()) {
+            std::size_t end = value.find('x', start);
+            if (end == std::string::npos) { end = value.length(); }
+            dimensions.push_back(std::strtoull(value.substr(start, end - start).c_str(), nullptr, 10));
+            start = end + 1;
+        }
+        return dimensions;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || std::string(argv[1]).compare(0, 2, "--") == 0) {
+        print_usage();
+        return 1;
+    }
+
+    std::uint64_t seed = 0;
+    for (int i = 2; i < argc; i++) {
+        std::string argument(argv[i]);
+        if (argument.compare(0, 7, "--seed=") == 0) { seed = std::strtoull(argument.substr(7).c_str(), nullptr, 10); }
+    }
+
+    try {
+        fits_generator generator(argv[1], seed);
+
+        for (int i = 2; i < argc; i++) {
+            std::string argument(argv[i]);
+
+            if (argument.compare(0, 8, "--image=") == 0) {
+                std::string value = argument.substr(8);
+                bitpix bitpix_value;
+                std::size_t separator = value.find(':');
+                if (separator == std::string::npos || !parse_bitpix(value.substr(0, separator), bitpix_value)) {
+                    print_usage();
+                    return 1;
+                }
+                auto dimensions = parse_dimensions(value.substr(separator + 1));
+                if (generator.total_hdus() == 0) { generator.write_primary_image(bitpix_value, dimensions); }
+                else { generator.write_image_extension(bitpix_value, dimensions); }
+            }
+            else if (argument.compare(0, 8, "--table=") == 0) {
+                auto dimensions = parse_dimensions(argument.substr(8));
+                if (dimensions.size() != 2) {
+                    print_usage();
+                    return 1;
+                }
+                generator.write_binary_table(dimensions[0], fits_generator::mixed_column_forms(dimensions[1]));
+            }
+            else if (argument.compare(0, 13, "--extensions=") == 0) {
+                std::size_t count = std::strtoull(argument.substr(13).c_str(), nullptr, 10);
+                for (std::size_t extension = 0; extension < count; extension++) {
+                    generator.write_image_extension(bitpix::_B32, { 64, 64 }, "EXT" + std::to_string(extension + 1));
+                }
+            }
+            else if (argument.compare(0, 7, "--seed=") != 0) {
+                print_usage();
+                return 1;
+            }
+        }
+
+        if (generator.total_hdus() == 0) { generator.write_primary_hdu(); }
+
+        std::cout << argv[1] << ": " << generator.total_hdus() << " HDUs, "
+                  << generator.bytes_written() << " bytes" << std::endl;
+        generator.close();
+    }
+    catch (std::exception& e) {
+        std::cerr << "astronomy_fits_generator: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
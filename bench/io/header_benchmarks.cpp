@@ -0,0 +1,92 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <string>
+#include <fstream>
+
+#include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/io/default_card_policy.hpp>
+
+#include "benchmark.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace io_bench {
+
+    namespace {
+
+        /**
+         * @brief Creates a header resembling an image with a large number of WCS/SIP coefficients
+        */
+        std::string make_wcs_header(std::size_t coefficients) {
+            header_builder builder;
+            builder.add("SIMPLE", true)
+                .add("BITPIX", -32)
+                .add("NAXIS", 2)
+                .add("NAXIS1", 4096)
+                .add("NAXIS2", 4096)
+                .add("CTYPE1", std::string("RA---TAN-SIP"))
+                .add("CTYPE2", std::string("DEC--TAN-SIP"));
+
+            for (std::size_t i = 0; i < coefficients; i++) {
+                builder.add("A_" + std::to_string(i), 1.0e-7 * static_cast<double>(i + 1) / 3.0);
+            }
+            return builder.build();
+        }
+
+        std::string read_file_prefix(const std::string& path, std::size_t num_bytes) {
+            std::ifstream file(path, std::ios::binary);
+            std::string data(num_bytes, '\0');
+            file.read(&data[0], static_cast<std::streamsize>(num_bytes));
+            data.resize(static_cast<std::size_t>(file.gcount()));
+            return data;
+        }
+
+        void add_parse_benchmark(benchmark_runner& runner, const std::string& name, const std::string& raw_header) {
+            runner.run(name, raw_header.size(), [&raw_header]() {
+                memory_reader reader(raw_header);
+                header<card_policy> hdu_header;
+                hdu_header.read_header(reader);
+            });
+        }
+    }
+
+    void register_header_benchmarks(benchmark_runner& runner) {
+        // Primary header of sample 1 contains 263 cards ( 8 logical records )
+        std::string sample_header = read_file_prefix(runner.get_options().samples_directory + "fits_sample1.fits", 8 * 2880);
+        if (!sample_header.empty()) {
+            add_parse_benchmark(runner, "header/parse/sample1_primary", sample_header);
+        }
+
+        std::string wcs_header = make_wcs_header(1000);
+        add_parse_benchmark(runner, "header/parse/wcs_1000_cards", wcs_header);
+
+        memory_reader reader(wcs_header);
+        header<card_policy> parsed_header;
+        parsed_header.read_header(reader);
+
+        runner.run("header/value_of/double", 80, [&parsed_header]() {
+            volatile double value = parsed_header.value_of<double>("A_500");
+            (void)value;
+        });
+
+        runner.run("header/create_card/double", 80, []() {
+            card<card_policy> new_card;
+            new_card.create_card("A_500", 1.0e-7 / 3.0, "SIP coefficient");
+        });
+
+        runner.run("header/write/wcs_1000_cards", wcs_header.size(), [&parsed_header]() {
+            memory_writer writer;
+            parsed_header.write_header(writer);
+        });
+
+        runner.run("header/copy/wcs_1000_cards", wcs_header.size(), [&parsed_header]() {
+            header<card_policy> copied_header = parsed_header;
+            (void)copied_header;
+        });
+    }
+}
@@ -0,0 +1,234 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_resampling.hpp>
+#include <boost/astronomy/io/image_histogram.hpp>
+#include <boost/astronomy/io/sigma_clipping.hpp>
+#include <boost/astronomy/io/image_expression.hpp>
+#include <boost/astronomy/io/image_stacking.hpp>
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/io/binary_data_converter.hpp>
+
+#include "benchmark.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace io_bench {
+
+    namespace {
+
+        const std::size_t image_width = 1024;
+        const std::size_t image_height = 1024;
+
+        template<bitpix BitpixValue>
+        void add_image_benchmarks(benchmark_runner& runner, const std::string& type_name) {
+            std::size_t element_size = get_element_size_from_bitpix(BitpixValue);
+            std::string raw_data = random_bytes(image_width * image_height * element_size, element_size);
+
+            runner.run("image/decode/" + type_name, raw_data.size(), [&raw_data]() {
+                image<BitpixValue, binary_data_converter> decoded_image;
+                decoded_image.read_image(raw_data);
+            });
+
+            image<BitpixValue, binary_data_converter> decoded_image;
+            decoded_image.read_image(raw_data);
+
+            runner.run("image/encode/" + type_name, raw_data.size(), [&decoded_image]() {
+                std::string encoded_data = decoded_image.write_image();
+                (void)encoded_data;
+            });
+        }
+
+        template<typename PixelType>
+        void add_resampling_benchmarks(benchmark_runner& runner, const std::string& type_name) {
+            const std::size_t width = 4096, height = 4096;
+            image_buffer<PixelType> source(width, height);
+            for (std::size_t i = 0; i < source.size(); i++) {
+                source.data()[i] = static_cast<PixelType>((i * 2654435761u) % 1000);
+            }
+            std::size_t bytes = source.size() * sizeof(PixelType);
+
+            std::vector<float> destination(source.size());
+            image_view<PixelType> view = make_image_view(source);
+
+            runner.run("image/bin/2x2/" + type_name, bytes, [&]() {
+                bin_image(view, 2, 2, binning_mode::mean, destination.data());
+            });
+            runner.run("image/bin/2x2_single_thread/" + type_name, bytes, [&]() {
+                bin_image(view, 2, 2, binning_mode::mean, destination.data(), 1);
+            });
+            runner.run("image/bin/8x8/" + type_name, bytes, [&]() {
+                bin_image(view, 8, 8, binning_mode::sum, destination.data());
+            });
+            runner.run("image/bin/streaming_2x2/" + type_name, bytes, [&]() {
+                image_binner<float> binner(width, 2, 2);
+                float checksum = 0;
+                binner.push_rows(source.data(), height, [&](const float* row) { checksum += row[0]; });
+                (void)checksum;
+            });
+            std::vector<PixelType> downsampled(source.size() / 16);
+            runner.run("image/downsample/4x4/" + type_name, bytes, [&]() {
+                downsample_image(view, 4, 4, downsampled.data());
+            });
+            runner.run("image/resample/bilinear_1000/" + type_name, bytes, [&]() {
+                resample_image(view, 1000, 1000, interpolation::bilinear, destination.data());
+            });
+            runner.run("image/resample/lanczos3_1000/" + type_name, bytes, [&]() {
+                resample_image(view, 1000, 1000, interpolation::lanczos3, destination.data());
+            });
+        }
+
+        template<typename PixelType>
+        void add_histogram_benchmarks(benchmark_runner& runner, const std::string& type_name) {
+            const std::size_t width = 4096, height = 4096;
+            image_buffer<PixelType> source(width, height);
+            for (std::size_t i = 0; i < source.size(); i++) {
+                // Background near 1000 with a sparse population of bright pixels
+                std::size_t hash = (i * 2654435761u) % 4096;
+                source.data()[i] = static_cast<PixelType>(hash < 4 ? 30000 : 990 + hash % 20);
+            }
+            std::size_t bytes = source.size() * sizeof(PixelType);
+            image_view<PixelType> view = make_image_view(source);
+
+            runner.run("image/histogram/full/" + type_name, bytes, [&]() {
+                pixel_histogram histogram = make_histogram(view);
+                (void)histogram;
+            });
+            runner.run("image/histogram/percentile_range/" + type_name, bytes, [&]() {
+                display_range range = percentile_range(view);
+                (void)range;
+            });
+            runner.run("image/histogram/zscale/" + type_name, bytes, [&]() {
+                display_range range = zscale(view);
+                (void)range;
+            });
+            runner.run("image/histogram/exact_median/" + type_name, bytes, [&]() {
+                double median = exact_quantile(view, 0.5);
+                (void)median;
+            });
+            runner.run("image/histogram/image_buffer_median/" + type_name, bytes, [&]() {
+                double median = source.median();
+                (void)median;
+            });
+        }
+
+        template<typename PixelType>
+        void add_sigma_clipping_benchmarks(benchmark_runner& runner, const std::string& type_name) {
+            const std::size_t width = 4096, height = 4096;
+            image_buffer<PixelType> source(width, height);
+            image_buffer<std::uint8_t> mask(width, height);
+            for (std::size_t i = 0; i < source.size(); i++) {
+                std::size_t hash = (i * 2654435761u) % 4096;
+                source.data()[i] = static_cast<PixelType>(hash < 4 ? 30000 : 990 + hash % 20);
+                mask.data()[i] = hash % 64 == 0 ? 1 : 0;
+            }
+            std::size_t bytes = source.size() * sizeof(PixelType);
+            image_view<PixelType> view = make_image_view(source);
+
+            runner.run("image/sigma_clip/median/" + type_name, bytes, [&]() {
+                clipped_statistics statistics = sigma_clipped_stats(view);
+                (void)statistics;
+            });
+            runner.run("image/sigma_clip/mean/" + type_name, bytes, [&]() {
+                sigma_clip_options options;
+                options.center = clip_center::mean;
+                clipped_statistics statistics = sigma_clipped_stats(view, options);
+                (void)statistics;
+            });
+            runner.run("image/sigma_clip/masked/" + type_name, bytes, [&]() {
+                clipped_statistics statistics = sigma_clipped_stats(view, make_image_view(mask));
+                (void)statistics;
+            });
+        }
+
+        void add_expression_benchmarks(benchmark_runner& runner) {
+            const std::size_t width = 4096, height = 4096;
+            image_buffer<std::int16_t> raw(width, height);
+            image_buffer<float> bias(width, height), flat(width, height), calibrated(width, height);
+            image_buffer<std::uint8_t> bad_pixels(width, height);
+            image_buffer<std::int16_t> rounded(width, height);
+            for (std::size_t i = 0; i < raw.size(); i++) {
+                std::size_t hash = (i * 2654435761u) % 4096;
+                raw.data()[i] = static_cast<std::int16_t>(1000 + hash);
+                bias.data()[i] = static_cast<float>(990 + hash % 20);
+                flat.data()[i] = 0.9f + static_cast<float>(hash % 100) / 500;
+                bad_pixels.data()[i] = hash < 8 ? 1 : 0;
+            }
+            std::size_t bytes = raw.size() * (sizeof(std::int16_t) + 2 * sizeof(float));
+
+            runner.run("image/expression/calibrate/B16_to_B32", bytes, [&]() {
+                evaluate((raw - bias) / flat * 1.5, calibrated.data());
+            });
+            runner.run("image/expression/calibrate/B16_to_B16", bytes, [&]() {
+                evaluate(clamp((raw - bias) / flat * 1.5, 0, 30000), rounded.data());
+            });
+            runner.run("image/expression/calibrate_masked/B16_to_B32", bytes, [&]() {
+                evaluate(where(bad_pixels, 0, (raw - bias) / flat * 1.5), calibrated.data());
+            });
+            runner.run("image/expression/scale/_B32_to_B32", raw.size() * 2 * sizeof(float), [&]() {
+                evaluate(flat * 2.0 - bias, calibrated.data());
+            });
+        }
+
+        template<typename PixelType>
+        void add_stacking_benchmarks(benchmark_runner& runner, const std::string& type_name) {
+            const std::size_t width = 1024, height = 1024;
+            for (std::size_t frames : { 9u, 64u }) {
+                std::vector<image_buffer<PixelType>> stack;
+                std::vector<image_view<PixelType>> views;
+                for (std::size_t frame = 0; frame < frames; frame++) {
+                    stack.emplace_back(width, height);
+                    for (std::size_t i = 0; i < stack.back().size(); i++) {
+                        std::size_t hash = ((i + 7919 * frame) * 2654435761u) % 4096;
+                        stack.back().data()[i] = static_cast<PixelType>(hash % 64 == 0 ? 20000 + hash : 1000 + hash % 50);
+                    }
+                }
+                for (auto const& frame : stack) { views.push_back(make_image_view(frame)); }
+                image_buffer<float> stacked(width, height);
+                std::size_t bytes = frames * width * height * sizeof(PixelType);
+                std::string suffix = "/" + std::to_string(frames) + "_frames/" + type_name;
+
+                stack_options options;
+                options.method = stack_method::mean;
+                runner.run("image/stack/mean" + suffix, bytes, [&]() { stack_images(views, stacked.data(), options); });
+                options.method = stack_method::median;
+                runner.run("image/stack/median" + suffix, bytes, [&]() { stack_images(views, stacked.data(), options); });
+                options.method = stack_method::sigma_clipped_mean;
+                runner.run("image/stack/sigma_clipped_mean" + suffix, bytes, [&]() {
+                    stack_images(views, stacked.data(), options);
+                });
+            }
+        }
+    }
+
+    void register_image_benchmarks(benchmark_runner& runner) {
+        add_image_benchmarks<bitpix::B8>(runner, "B8");
+        add_image_benchmarks<bitpix::B16>(runner, "B16");
+        add_image_benchmarks<bitpix::B32>(runner, "B32");
+        add_image_benchmarks<bitpix::_B32>(runner, "_B32");
+        add_image_benchmarks<bitpix::_B64>(runner, "_B64");
+
+        add_resampling_benchmarks<std::int16_t>(runner, "B16");
+        add_resampling_benchmarks<float>(runner, "_B32");
+
+        add_histogram_benchmarks<std::int16_t>(runner, "B16");
+        add_histogram_benchmarks<float>(runner, "_B32");
+
+        add_sigma_clipping_benchmarks<std::int16_t>(runner, "B16");
+        add_sigma_clipping_benchmarks<float>(runner, "_B32");
+
+        add_expression_benchmarks(runner);
+
+        add_stacking_benchmarks<std::int16_t>(runner, "B16");
+        add_stacking_benchmarks<float>(runner, "_B32");
+    }
+}
@@ -0,0 +1,80 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <iostream>
+
+#include "benchmark.hpp"
+
+namespace io_bench {
+    std::atomic<std::size_t> allocation_count(0);
+}
+
+// Replacing the global allocation functions lets every benchmark report its allocation count
+void* operator new(std::size_t size) {
+    io_bench::allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
+namespace {
+
+    void print_usage() {
+        std::cerr << "Usage: astronomy_io_benchmarks [--filter=<substring>] [--min-time=<seconds>]\n"
+                  << "                               [--samples=<directory>] [--scratch=<directory>]\n"
+                  << "Each result is written to stdout as a single line of JSON\n";
+    }
+
+    bool parse_arguments(int argc, char** argv, io_bench::benchmark_options& options) {
+        for (int i = 1; i < argc; i++) {
+            std::string argument(argv[i]);
+            auto value_of = [&argument](const std::string& option) { return argument.substr(option.length()); };
+
+            if (argument.compare(0, 9, "--filter=") == 0) { options.filter = value_of("--filter="); }
+            else if (argument.compare(0, 11, "--min-time=") == 0) { options.min_time = std::atof(value_of("--min-time=").c_str()); }
+            else if (argument.compare(0, 10, "--samples=") == 0) { options.samples_directory = value_of("--samples="); }
+            else if (argument.compare(0, 10, "--scratch=") == 0) { options.scratch_directory = value_of("--scratch="); }
+            else { return false; }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    io_bench::benchmark_options options;
+#ifdef BOOST_ASTRONOMY_BENCH_SAMPLES_DIR
+    options.samples_directory = BOOST_ASTRONOMY_BENCH_SAMPLES_DIR;
+#endif
+    options.scratch_directory = ".";
+
+    if (!parse_arguments(argc, argv, options)) {
+        print_usage();
+        return 1;
+    }
+    if (!options.samples_directory.empty() && options.samples_directory.back() != '/') {
+        options.samples_directory += '/';
+    }
+    if (options.scratch_directory.back() != '/') {
+        options.scratch_directory += '/';
+    }
+
+    io_bench::benchmark_runner runner(options);
+    io_bench::register_header_benchmarks(runner);
+    io_bench::register_image_benchmarks(runner);
+    io_bench::register_table_benchmarks(runner);
+    io_bench::register_end_to_end_benchmarks(runner);
+
+    return 0;
+}
@@ -0,0 +1,249 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/io/default_card_policy.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/bit_column.hpp>
+#include <boost/astronomy/io/column_transpose.hpp>
+#include <boost/astronomy/io/table_schema.hpp>
+#include <boost/astronomy/io/ascii_table.hpp>
+#include <boost/astronomy/io/binary_data_converter.hpp>
+#include <boost/astronomy/io/string_conversion_utility.hpp>
+
+#include "benchmark.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace io_bench {
+
+    namespace {
+
+        typedef basic_binary_table_extension<card_policy, binary_data_converter> binary_table_type;
+        typedef basic_ascii_table<card_policy, ascii_converter> ascii_table_type;
+
+        BOOST_ASTRONOMY_TABLE_COLUMN(col1, "COL1", std::int32_t);
+        BOOST_ASTRONOMY_TABLE_COLUMN(col3, "COL3", double);
+        BOOST_ASTRONOMY_TABLE_COLUMN(col5, "COL5", std::array<float, 10>);
+        typedef typed_binary_table<table_schema<col1, col3, col5>> typed_table_type;
+
+        const std::size_t table_rows = 10000;
+
+        /**
+         * @brief Columns of the synthetic binary table ( J, E, D, I, 10E, L, 8A )
+        */
+        const char* binary_forms[] = { "J", "E", "D", "I", "10E", "L", "8A" };
+        const std::size_t binary_widths[] = { 4, 4, 8, 2, 40, 1, 8 };
+
+        header<card_policy> parse_header(const std::string& raw_header) {
+            memory_reader reader(raw_header);
+            header<card_policy> table_header;
+            table_header.read_header(reader);
+            return table_header;
+        }
+
+        std::string make_binary_table_header(std::size_t rows) {
+            std::size_t row_width = 0;
+            for (auto width : binary_widths) { row_width += width; }
+
+            header_builder builder;
+            builder.add("XTENSION", std::string("BINTABLE"))
+                .add("BITPIX", 8)
+                .add("NAXIS", 2)
+                .add("NAXIS1", static_cast<long long>(row_width))
+                .add("NAXIS2", static_cast<long long>(rows))
+                .add("PCOUNT", 0)
+                .add("GCOUNT", 1)
+                .add("TFIELDS", 7);
+
+            for (std::size_t i = 0; i < 7; i++) {
+                builder.add("TTYPE" + std::to_string(i + 1), "COL" + std::to_string(i + 1))
+                    .add("TFORM" + std::to_string(i + 1), std::string(binary_forms[i]));
+            }
+            builder.add("EXTNAME", std::string("BENCH"));
+            return builder.build();
+        }
+
+        std::string make_ascii_table_header(std::size_t rows) {
+            header_builder builder;
+            builder.add("XTENSION", std::string("TABLE"))
+                .add("BITPIX", 8)
+                .add("NAXIS", 2)
+                .add("NAXIS1", 40)
+                .add("NAXIS2", static_cast<long long>(rows))
+                .add("PCOUNT", 0)
+                .add("GCOUNT", 1)
+                .add("TFIELDS", 3)
+                .add("TTYPE1", std::string("ID"))
+                .add("TFORM1", std::string("I10"))
+                .add("TBCOL1", 1)
+                .add("TTYPE2", std::string("FLUX"))
+                .add("TFORM2", std::string("E15.7"))
+                .add("TBCOL2", 11)
+                .add("TTYPE3", std::string("NAME"))
+                .add("TFORM3", std::string("A15"))
+                .add("TBCOL3", 26)
+                .add("EXTNAME", std::string("BENCH"));
+            return builder.build();
+        }
+
+        std::string make_ascii_table_data(std::size_t rows) {
+            std::string data;
+            // Every row must be exactly NAXIS1 ( 40 ) characters wide, longer values are reported instead of cut
+            char row_buffer[64];
+            for (std::size_t row = 0; row < rows; row++) {
+                int row_size = std::snprintf(row_buffer, sizeof(row_buffer), "%10zu%15.7E%15s",
+                    row, static_cast<double>(row) * 1.25e-3, ("SRC" + std::to_string(row)).c_str());
+                if (row_size != 40) { throw std::length_error("Row does not fit in the ASCII table"); }
+                data.append(row_buffer, 40);
+            }
+            return data;
+        }
+
+        template<typename ColDataType, typename Converter, typename Table>
+        void add_column_benchmarks(benchmark_runner& runner, Table& table,
+            const std::string& prefix, const std::string& column_name, std::size_t column_width) {
+
+            std::size_t column_bytes = column_width * table_rows;
+
+            runner.run(prefix + "/make_column_view/" + column_name, column_bytes, [&table, &column_name]() {
+                auto view = table.template make_column_view<ColDataType, Converter>(column_name);
+                for (std::size_t row = 0; row < view.get_row_count(); row++) {
+                    ColDataType value = view[static_cast<int>(row)];
+                    (void)value;
+                }
+            });
+
+            runner.run(prefix + "/iterate_column/" + column_name, column_bytes, [&table, &column_name]() {
+                auto view = table.template make_column_view<ColDataType, Converter>(column_name);
+                for (auto iter = view.begin(); iter != view.end(); ++iter) {
+                    ColDataType value = *iter;
+                    (void)value;
+                }
+            });
+        }
+    }
+
+    void register_table_benchmarks(benchmark_runner& runner) {
+        std::string binary_header = make_binary_table_header(table_rows);
+        header<card_policy> binary_table_header = parse_header(binary_header);
+        std::string binary_data = random_bytes(binary_table_header.naxis(1) * table_rows, 42);
+
+        runner.run("table/binary/construct", binary_data.size(), [&binary_table_header, &binary_data]() {
+            binary_table_type table(binary_table_header, binary_data);
+            (void)table;
+        });
+
+        binary_table_type binary_table(binary_table_header, binary_data);
+        add_column_benchmarks<boost::int32_t, binary_data_converter>(runner, binary_table, "table/binary", "COL1", 4);
+        add_column_benchmarks<boost::float32_t, binary_data_converter>(runner, binary_table, "table/binary", "COL2", 4);
+        add_column_benchmarks<boost::float64_t, binary_data_converter>(runner, binary_table, "table/binary", "COL3", 8);
+        add_column_benchmarks<std::vector<boost::float32_t>, binary_data_converter>(runner, binary_table, "table/binary", "COL5", 40);
+
+        runner.run("table/binary/get_column_by_name/COL3", 0, [&binary_table]() {
+            for (std::size_t i = 0; i < table_rows; i++) {
+                auto& view = binary_table.get_column<boost::float64_t>("COL3");
+                (void)view;
+            }
+        });
+
+        column_id col3_id = binary_table.get_column_id("COL3");
+        runner.run("table/binary/get_column_by_id/COL3", 0, [&binary_table, col3_id]() {
+            for (std::size_t i = 0; i < table_rows; i++) {
+                auto& view = binary_table.get_column<boost::float64_t>(col3_id);
+                (void)view;
+            }
+        });
+
+        typed_table_type typed_table(binary_table_header, binary_data);
+        runner.run("table/typed/iterate_column/COL1", 4 * table_rows, [&typed_table]() {
+            std::int64_t sum = 0;
+            for (auto value : typed_table.column<col1>()) { sum += value; }
+            volatile auto result = sum;
+            (void)result;
+        });
+        runner.run("table/typed/iterate_column/COL3", 8 * table_rows, [&typed_table]() {
+            double sum = 0;
+            for (auto value : typed_table.column<col3>()) { sum += value; }
+            volatile auto result = sum;
+            (void)result;
+        });
+        runner.run("table/typed/get/COL5", 40 * table_rows, [&typed_table]() {
+            float sum = 0;
+            for (std::size_t row = 0; row < typed_table.total_rows(); row++) {
+                sum += typed_table.get<col5>(row)[9];
+            }
+            volatile auto result = sum;
+            (void)result;
+        });
+
+        add_column_benchmarks<bool, binary_data_converter>(runner, binary_table, "table/binary", "COL6", 1);
+        column_id col6_id = binary_table.get_column_id("COL6");
+        runner.run("table/binary/decode_logical/COL6", table_rows, [&binary_table, &binary_data, col6_id]() {
+            auto values = decode_logical(binary_table, binary_data, col6_id);
+            (void)values;
+        });
+        runner.run("table/binary/logical_mask/COL6", table_rows, [&binary_table, &binary_data, col6_id]() {
+            volatile auto selected = logical_mask(binary_table, binary_data, col6_id).count();
+            (void)selected;
+        });
+
+        // The first two bytes of every row read as a 16 bit flag field
+        column flag_metadata("16X");
+        flag_metadata.TBCOL(0);
+        bit_column flags = read_bit_column(binary_data.data(), table_rows, binary_table_header.naxis(1), flag_metadata);
+        runner.run("table/bit_column/read/16X", 2 * table_rows, [&binary_data, &binary_table_header, &flag_metadata]() {
+            auto bits = read_bit_column(binary_data.data(), table_rows, binary_table_header.naxis(1), flag_metadata);
+            (void)bits;
+        });
+        runner.run("table/bit_column/any_of/16X", 2 * table_rows, [&flags]() {
+            volatile auto selected = flags.any_of({ 1, 9, 14 }).count();
+            (void)selected;
+        });
+        runner.run("table/bit_column/mask_combine/16X", 2 * table_rows, [&flags]() {
+            volatile auto selected = ((flags.mask(1) | flags.mask(9)) & ~flags.mask(14)).count();
+            (void)selected;
+        });
+
+        runner.run("table/binary/transpose/1_thread", binary_data.size(), [&binary_table, &binary_data]() {
+            auto columns = transpose_columns(binary_table, binary_data, 1);
+            (void)columns;
+        });
+
+        std::size_t large_rows = 100 * table_rows;
+        std::string large_header = make_binary_table_header(large_rows);
+        binary_table_type large_table(parse_header(large_header), "");
+        std::string large_data = random_bytes(binary_table_header.naxis(1) * large_rows, 7);
+
+        runner.run("table/binary/transpose_large/1_thread", large_data.size(), [&large_table, &large_data]() {
+            auto columns = transpose_columns(large_table, large_data, 1);
+            (void)columns;
+        });
+        runner.run("table/binary/transpose_large/all_threads", large_data.size(), [&large_table, &large_data]() {
+            auto columns = transpose_columns(large_table, large_data);
+            (void)columns;
+        });
+
+        std::string ascii_header = make_ascii_table_header(table_rows);
+        header<card_policy> ascii_table_header = parse_header(ascii_header);
+        std::string ascii_data = make_ascii_table_data(table_rows);
+
+        runner.run("table/ascii/construct", ascii_data.size(), [&ascii_table_header, &ascii_data]() {
+            ascii_table_type table(ascii_table_header, ascii_data);
+            (void)table;
+        });
+
+        ascii_table_type ascii_table(ascii_table_header, ascii_data);
+        add_column_benchmarks<long long, ascii_converter>(runner, ascii_table, "table/ascii", "ID", 10);
+        add_column_benchmarks<double, ascii_converter>(runner, ascii_table, "table/ascii", "FLUX", 15);
+    }
+}
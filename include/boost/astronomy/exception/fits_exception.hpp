@@ -65,6 +65,26 @@ namespace boost
             }
         };
 
+        class header_space_exhausted_exception : public fits_exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "Card cannot be accommodated in the existing header blocks";
+            }
+        };
+
+        class structural_keyword_exception : public fits_exception {
+            std::string message;
+        public:
+            structural_keyword_exception(const std::string& keyword) {
+                message = "Structural keyword cannot be changed in place : " + keyword;
+            }
+            const char* what() const noexcept override {
+                return message.c_str();
+            }
+        };
+
         class invalid_key_length_exception : public invalid_card
         {
         public:
@@ -108,6 +128,15 @@ namespace boost
                 return message.c_str();
             }
 
+        };
+        class file_writing_exception : public fits_exception {
+            std::string message;
+        public:
+            file_writing_exception(const std::string& error_message):message(error_message) {}
+            const char* what() const noexcept override {
+                return message.c_str();
+            }
+
         };
         class column_not_found_exception : public fits_exception {
             std::string message;
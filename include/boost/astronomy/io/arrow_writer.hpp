@@ -0,0 +1,797 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_ARROW_WRITER_HPP
+#define BOOST_ASTRONOMY_IO_ARROW_WRITER_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <boost/astronomy/io/ascii_table.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/io/column_transpose.hpp>
+#include <boost/astronomy/io/table_field.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief Layout of the Arrow IPC output
+*/
+enum class arrow_format {
+    file,   //! Random access file format ( ARROW1 magic and footer )
+    stream  //! Streaming format ( sequence of messages ended by an end of stream marker )
+};
+
+/**
+ * @brief Arrow data type of a level of an exported column
+*/
+struct arrow_type {
+    enum kind_type { integer, floating_point, boolean, utf8, fixed_size_binary, fixed_size_list };
+
+    kind_type kind;
+    int bit_width;      //! Width of integers and floating point numbers in bits
+    bool is_signed;     //! Whether integers are signed
+    int width;          //! Byte width of fixed size binary or number of elements of fixed size lists
+
+    static arrow_type make(kind_type kind, int bit_width = 0, bool is_signed = false, int width = 0) {
+        arrow_type type;
+        type.kind = kind;
+        type.bit_width = bit_width;
+        type.is_signed = is_signed;
+        type.width = width;
+        return type;
+    }
+};
+
+/**
+ * @brief   Describes how a column of a FITS table is exported to Arrow
+ * @details Vector columns ( e.g 10E ) become fixed size lists of their element type and complex values fixed size
+ *          lists of two floating point numbers, so types holds the list levels from the outermost to the leaf type.
+ *          Values equal to TNULL ( or undefined logicals and blank ASCII fields ) are marked as null. elements counts
+ *          the leaf values of a field, so strings and bit arrays hold a single one
+*/
+struct arrow_column : table_field {
+    std::vector<arrow_type> types;  //! Type of every level of the field, the last one holds the values
+
+    arrow_column() {}
+    explicit arrow_column(table_field const& field) :table_field(field) {}
+};
+namespace detail {
+
+    /**
+     * @brief   Minimal FlatBuffers builder for the Arrow IPC metadata
+     * @details Like the reference implementation the buffer is built back to front, so that every object
+     *          referenced by an offset is written before the object referring to it. Positions are measured
+     *          from the end of the buffer until finish() reverses it
+    */
+    class flatbuffer_builder {
+        std::vector<char> reversed;
+        std::size_t min_align;
+        std::vector<std::pair<std::uint16_t, std::uint32_t>> table_fields;
+        std::uint32_t table_start;
+
+    public:
+        typedef std::uint32_t offset;
+
+        flatbuffer_builder() :min_align(1), table_start(0) {}
+
+        offset size() const { return static_cast<offset>(reversed.size()); }
+
+        /**
+         * @brief Pads the buffer so that an object of len bytes written next ends aligned to alignment
+        */
+        void prealign(std::size_t len, std::size_t alignment) {
+            min_align = std::max(min_align, alignment);
+            std::size_t padding = (alignment - (reversed.size() + len) % alignment) % alignment;
+            reversed.insert(reversed.end(), padding, '\0');
+        }
+
+        /**
+         * @brief Writes a scalar in little endian byte order
+        */
+        template<typename T>
+        offset push(T value) {
+            prealign(sizeof(T), sizeof(T));
+            boost::endian::native_to_little_inplace(value);
+            char bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            for (std::size_t i = sizeof(T); i > 0; i--) { reversed.push_back(bytes[i - 1]); }
+            return size();
+        }
+
+        /**
+         * @brief Writes an offset referring to an object written earlier
+        */
+        offset push_offset(offset target) {
+            prealign(4, 4);
+            return push<std::uint32_t>(size() + 4 - target);
+        }
+
+        offset create_string(std::string const& value) {
+            prealign(value.size() + 1, 4);
+            reversed.push_back('\0');
+            reversed.insert(reversed.end(), value.rbegin(), value.rend());
+            return push<std::uint32_t>(static_cast<std::uint32_t>(value.size()));
+        }
+
+        offset create_offset_vector(std::vector<offset> const& targets) {
+            prealign(4 * targets.size(), 4);
+            for (std::size_t i = targets.size(); i > 0; i--) { push_offset(targets[i - 1]); }
+            return push<std::uint32_t>(static_cast<std::uint32_t>(targets.size()));
+        }
+
+        /**
+         * @brief Writes a vector of structs already encoded in little endian byte order
+        */
+        offset create_struct_vector(std::string const& structs, std::size_t count, std::size_t alignment) {
+            prealign(structs.size(), 4);
+            prealign(structs.size(), alignment);
+            reversed.insert(reversed.end(), structs.rbegin(), structs.rend());
+            return push<std::uint32_t>(static_cast<std::uint32_t>(count));
+        }
+
+        void start_table() {
+            table_fields.clear();
+            table_start = size();
+        }
+
+        template<typename T>
+        void add_scalar(std::uint16_t id, T value) {
+            table_fields.emplace_back(id, push(value));
+        }
+
+        void add_offset(std::uint16_t id, offset target) {
+            table_fields.emplace_back(id, push_offset(target));
+        }
+
+        /**
+         * @brief Writes the table and its vtable
+        */
+        offset end_table() {
+            offset table_position = push<std::int32_t>(0);
+
+            std::size_t field_count = 0;
+            for (auto const& field : table_fields) { field_count = std::max<std::size_t>(field_count, field.first + 1u); }
+            std::vector<std::uint16_t> entries(field_count, 0);
+            for (auto const& field : table_fields) {
+                entries[field.first] = static_cast<std::uint16_t>(table_position - field.second);
+            }
+
+            for (std::size_t i = field_count; i > 0; i--) { push<std::uint16_t>(entries[i - 1]); }
+            push<std::uint16_t>(static_cast<std::uint16_t>(table_position - table_start));
+            offset vtable_position = push<std::uint16_t>(static_cast<std::uint16_t>(4 + 2 * field_count));
+
+            // The table starts with the distance back to its vtable
+            std::int32_t distance = static_cast<std::int32_t>(vtable_position - table_position);
+            boost::endian::native_to_little_inplace(distance);
+            char bytes[4];
+            std::memcpy(bytes, &distance, 4);
+            for (std::size_t i = 0; i < 4; i++) { reversed[table_position - 1 - i] = bytes[i]; }
+            return table_position;
+        }
+
+        /**
+         * @brief Writes the offset of the root table and returns the finished buffer ( a multiple of 8 bytes )
+        */
+        std::string finish(offset root) {
+            prealign(4, std::max<std::size_t>(min_align, 8));
+            push_offset(root);
+            return std::string(reversed.rbegin(), reversed.rend());
+        }
+    };
+
+    /**
+     * @brief Appends a scalar in little endian byte order ( used for encoding FlatBuffers structs )
+    */
+    template<typename T>
+    inline void append_little_endian(std::string& buffer, T value) {
+        boost::endian::native_to_little_inplace(value);
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    // Identifiers from the Arrow Schema.fbs and Message.fbs
+    enum : std::uint8_t { arrow_type_int = 2, arrow_type_floating_point = 3, arrow_type_utf8 = 5, arrow_type_bool = 6,
+        arrow_type_fixed_size_binary = 15, arrow_type_fixed_size_list = 16 };
+    enum : std::uint8_t { arrow_message_schema = 1, arrow_message_record_batch = 3 };
+    const std::int16_t arrow_metadata_version = 4;
+
+    inline flatbuffer_builder::offset build_arrow_type(flatbuffer_builder& builder, arrow_type const& type) {
+        builder.start_table();
+        switch (type.kind) {
+        case arrow_type::integer:
+            builder.add_scalar<std::int32_t>(0, type.bit_width);
+            builder.add_scalar<std::uint8_t>(1, type.is_signed ? 1 : 0);
+            break;
+        case arrow_type::floating_point:
+            builder.add_scalar<std::int16_t>(0, static_cast<std::int16_t>(type.bit_width == 32 ? 1 : 2));
+            break;
+        case arrow_type::fixed_size_binary:
+        case arrow_type::fixed_size_list:
+            builder.add_scalar<std::int32_t>(0, type.width);
+            break;
+        case arrow_type::boolean:
+        case arrow_type::utf8:
+            break;
+        }
+        return builder.end_table();
+    }
+
+    inline std::uint8_t arrow_type_id(arrow_type const& type) {
+        switch (type.kind) {
+        case arrow_type::integer: return arrow_type_int;
+        case arrow_type::floating_point: return arrow_type_floating_point;
+        case arrow_type::boolean: return arrow_type_bool;
+        case arrow_type::utf8: return arrow_type_utf8;
+        case arrow_type::fixed_size_binary: return arrow_type_fixed_size_binary;
+        default: return arrow_type_fixed_size_list;
+        }
+    }
+
+    inline flatbuffer_builder::offset build_arrow_field(flatbuffer_builder& builder,
+        std::vector<arrow_type> const& types, std::size_t level, std::string const& name) {
+
+        std::vector<flatbuffer_builder::offset> children;
+        if (level + 1 < types.size()) { children.push_back(build_arrow_field(builder, types, level + 1, "item")); }
+
+        auto name_offset = builder.create_string(name);
+        auto type_offset = build_arrow_type(builder, types[level]);
+        auto children_offset = builder.create_offset_vector(children);
+
+        builder.start_table();
+        builder.add_offset(0, name_offset);
+        builder.add_scalar<std::uint8_t>(1, 1);
+        builder.add_scalar<std::uint8_t>(2, arrow_type_id(types[level]));
+        builder.add_offset(3, type_offset);
+        builder.add_offset(5, children_offset);
+        return builder.end_table();
+    }
+
+    inline flatbuffer_builder::offset build_arrow_schema(flatbuffer_builder& builder, std::vector<arrow_column> const& columns) {
+        std::vector<flatbuffer_builder::offset> fields;
+        for (auto const& col : columns) { fields.push_back(build_arrow_field(builder, col.types, 0, col.name)); }
+        auto fields_offset = builder.create_offset_vector(fields);
+
+        builder.start_table();
+        builder.add_scalar<std::int16_t>(0, boost::endian::order::native == boost::endian::order::little ? 0 : 1);
+        builder.add_offset(1, fields_offset);
+        return builder.end_table();
+    }
+
+    /**
+     * @brief Wraps the header of a message into a finished Message flatbuffer
+    */
+    inline std::string finish_arrow_message(flatbuffer_builder& builder, std::uint8_t header_type,
+        flatbuffer_builder::offset header, std::size_t body_length) {
+        builder.start_table();
+        builder.add_scalar<std::int16_t>(0, arrow_metadata_version);
+        builder.add_scalar<std::uint8_t>(1, header_type);
+        builder.add_offset(2, header);
+        builder.add_scalar<std::int64_t>(3, static_cast<std::int64_t>(body_length));
+        return builder.finish(builder.end_table());
+    }
+
+    /**
+     * @brief Collects the field nodes and buffers of a record batch and lays the buffers out in the body
+    */
+    class arrow_batch_builder {
+        std::string body_;
+        std::string nodes_;
+        std::string buffers_;
+        std::size_t node_count_;
+        std::size_t buffer_count_;
+
+    public:
+        arrow_batch_builder() :node_count_(0), buffer_count_(0) {}
+
+        void clear() {
+            body_.clear();
+            nodes_.clear();
+            buffers_.clear();
+            node_count_ = 0;
+            buffer_count_ = 0;
+        }
+
+        void reserve(std::size_t size) { body_.reserve(size); }
+
+        void add_node(std::size_t length, std::size_t null_count) {
+            append_little_endian<std::int64_t>(nodes_, static_cast<std::int64_t>(length));
+            append_little_endian<std::int64_t>(nodes_, static_cast<std::int64_t>(null_count));
+            node_count_++;
+        }
+
+        /**
+         * @brief Reserves a zero filled buffer of size bytes padded to 8 bytes and returns its offset in the body
+        */
+        std::size_t add_buffer(std::size_t size) {
+            std::size_t offset = body_.size();
+            append_little_endian<std::int64_t>(buffers_, static_cast<std::int64_t>(offset));
+            append_little_endian<std::int64_t>(buffers_, static_cast<std::int64_t>(size));
+            buffer_count_++;
+            body_.resize(offset + (size + 7) / 8 * 8, '\0');
+            return offset;
+        }
+
+        char* at(std::size_t offset) { return &body_[0] + offset; }
+
+        std::string const& body() const { return body_; }
+        std::string const& nodes() const { return nodes_; }
+        std::string const& buffers() const { return buffers_; }
+        std::size_t node_count() const { return node_count_; }
+        std::size_t buffer_count() const { return buffer_count_; }
+    };
+
+    inline void set_validity_bit(char* bitmap, std::size_t index, bool valid) {
+        bitmap[index / 8] = static_cast<char>(bitmap[index / 8] | (static_cast<int>(valid) << (index % 8)));
+    }
+
+    /**
+     * @brief Marks the values equal to TNULL as null and returns their number
+    */
+    template<typename Integer>
+    inline std::size_t mark_integer_nulls(const char* values, std::size_t count, long long null_value, char* bitmap) {
+        std::size_t null_count = 0;
+        Integer null = static_cast<Integer>(null_value);
+        for (std::size_t i = 0; i < count; i++) {
+            Integer value;
+            std::memcpy(&value, values + i * sizeof(Integer), sizeof(Integer));
+            bool valid = value != null;
+            set_validity_bit(bitmap, i, valid);
+            null_count += !valid;
+        }
+        return null_count;
+    }
+
+    /**
+     * @brief Converts the leaf values of a binary table column to Arrow buffers
+    */
+    inline void encode_binary_leaf(arrow_batch_builder& batch, arrow_column const& col,
+        const char* rows, std::size_t count, std::size_t row_width) {
+
+        std::size_t values = count * col.elements;
+        const char* source = rows + col.offset;
+
+        switch (col.type) {
+        case 'L': {
+            std::size_t validity = batch.add_buffer((values + 7) / 8);
+            std::size_t bits = batch.add_buffer((values + 7) / 8);
+            std::size_t null_count = 0;
+            for (std::size_t row = 0; row < count; row++) {
+                const char* field = source + row * row_width;
+                for (std::size_t i = 0; i < col.elements; i++) {
+                    std::size_t index = row * col.elements + i;
+                    set_validity_bit(batch.at(validity), index, field[i] != '\0');
+                    set_validity_bit(batch.at(bits), index, field[i] == 'T');
+                    null_count += field[i] == '\0';
+                }
+            }
+            batch.add_node(values, null_count);
+            return;
+        }
+        case 'A': {
+            batch.add_buffer(0);
+            std::size_t offsets = batch.add_buffer((count + 1) * 4);
+            std::vector<std::uint32_t> lengths(count);
+            std::size_t total = 0;
+            for (std::size_t row = 0; row < count; row++) {
+                const char* field = source + row * row_width;
+                std::size_t length = std::find(field, field + col.width, '\0') - field;
+                while (length > 0 && field[length - 1] == ' ') { length--; }
+                lengths[row] = static_cast<std::uint32_t>(length);
+                total += length;
+            }
+            if (total > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max())) {
+                throw invalid_table_colum_format();
+            }
+            std::size_t data = batch.add_buffer(total);
+            std::int32_t position = 0;
+            for (std::size_t row = 0; row < count; row++) {
+                std::memcpy(batch.at(offsets) + 4 * row, &position, 4);
+                std::memcpy(batch.at(data) + position, source + row * row_width, lengths[row]);
+                position += static_cast<std::int32_t>(lengths[row]);
+            }
+            std::memcpy(batch.at(offsets) + 4 * count, &position, 4);
+            batch.add_node(count, 0);
+            return;
+        }
+        default:
+            break;
+        }
+
+        bool integer = col.type == 'B' || col.type == 'I' || col.type == 'J' || col.type == 'K';
+        bool nullable = integer && col.has_null;
+        std::size_t validity = batch.add_buffer(nullable ? (values + 7) / 8 : 0);
+
+        std::size_t element_size = col.type == 'X' ? 1 : col.width / col.elements;
+        std::size_t data = batch.add_buffer(count * col.width);
+        char* destination = batch.at(data);
+        switch (element_size) {
+        case 2: copy_swapped<std::uint16_t>(source, row_width, destination, count, col.elements); break;
+        case 4: copy_swapped<std::uint32_t>(source, row_width, destination, count, col.elements); break;
+        case 8: copy_swapped<std::uint64_t>(source, row_width, destination, count, col.elements); break;
+        default: copy_unswapped(source, row_width, destination, count, col.width); break;
+        }
+
+        std::size_t null_count = 0;
+        if (nullable) {
+            char* bitmap = batch.at(validity);
+            switch (col.type) {
+            case 'B': null_count = mark_integer_nulls<std::uint8_t>(destination, values, col.null_value, bitmap); break;
+            case 'I': null_count = mark_integer_nulls<std::int16_t>(destination, values, col.null_value, bitmap); break;
+            case 'J': null_count = mark_integer_nulls<std::int32_t>(destination, values, col.null_value, bitmap); break;
+            default: null_count = mark_integer_nulls<std::int64_t>(destination, values, col.null_value, bitmap); break;
+            }
+        }
+        batch.add_node(values, null_count);
+    }
+
+    /**
+     * @brief Converts a column of an ASCII table to Arrow buffers ( blank fields and TNULL are null )
+     * @throws file_reading_exception If a numeric field cannot be parsed
+    */
+    inline void encode_ascii_column(arrow_batch_builder& batch, arrow_column const& col,
+        const char* rows, std::size_t count, std::size_t row_width) {
+
+        if (col.type == 'A') {
+            encode_binary_leaf(batch, col, rows, count, row_width);
+            return;
+        }
+
+        std::size_t validity = batch.add_buffer((count + 7) / 8);
+        std::size_t data = batch.add_buffer(count * 8);
+        std::size_t null_count = 0;
+        std::string field;
+        for (std::size_t row = 0; row < count; row++) {
+            field.assign(rows + row * row_width + col.offset, col.width);
+            boost::trim(field);
+            bool valid = !field.empty() && !(col.has_null && field == col.ascii_null);
+            set_validity_bit(batch.at(validity), row, valid);
+            null_count += !valid;
+            if (!valid) { continue; }
+
+            char* end = nullptr;
+            errno = 0;
+            if (col.type == 'I') {
+                long long value = std::strtoll(field.c_str(), &end, 10);
+                std::memcpy(batch.at(data) + 8 * row, &value, 8);
+            }
+            else {
+                std::replace(field.begin(), field.end(), 'D', 'E');
+                std::replace(field.begin(), field.end(), 'd', 'e');
+                double value = std::strtod(field.c_str(), &end);
+                std::memcpy(batch.at(data) + 8 * row, &value, 8);
+            }
+            if (end != field.c_str() + field.size() || errno == ERANGE) {
+                throw file_reading_exception("Invalid number in ASCII table field: " + field);
+            }
+        }
+        batch.add_node(count, null_count);
+    }
+
+    /**
+     * @brief Plans the export of a binary table column from its metadata
+     * @throws invalid_table_colum_format If the column format cannot be exported ( P or a repeat count of 0 )
+    */
+    inline arrow_column make_binary_arrow_column(column const& metadata) {
+        arrow_column col(make_binary_table_field(metadata));
+        if (col.repeat == 0) { throw invalid_table_colum_format(); }
+
+        bool vector = col.repeat > 1;
+        switch (col.type) {
+        case 'L': col.types.push_back(arrow_type::make(arrow_type::boolean)); break;
+        case 'B': col.types.push_back(arrow_type::make(arrow_type::integer, 8, false)); break;
+        case 'I': col.types.push_back(arrow_type::make(arrow_type::integer, 16, true)); break;
+        case 'J': col.types.push_back(arrow_type::make(arrow_type::integer, 32, true)); break;
+        case 'K': col.types.push_back(arrow_type::make(arrow_type::integer, 64, true)); break;
+        case 'E': col.types.push_back(arrow_type::make(arrow_type::floating_point, 32)); break;
+        case 'D': col.types.push_back(arrow_type::make(arrow_type::floating_point, 64)); break;
+        case 'C':
+        case 'M':
+            col.types.push_back(arrow_type::make(arrow_type::fixed_size_list, 0, false, 2));
+            col.types.push_back(arrow_type::make(arrow_type::floating_point, col.type == 'C' ? 32 : 64));
+            break;
+        case 'A':
+            col.types.push_back(arrow_type::make(arrow_type::utf8));
+            col.elements = 1;
+            vector = false;
+            break;
+        case 'X':
+            col.types.push_back(arrow_type::make(arrow_type::fixed_size_binary, 0, false, static_cast<int>(col.width)));
+            col.elements = 1;
+            vector = false;
+            break;
+        default:
+            throw invalid_table_colum_format();
+        }
+        if (vector) {
+            col.types.insert(col.types.begin(), arrow_type::make(arrow_type::fixed_size_list, 0, false, static_cast<int>(col.repeat)));
+        }
+        return col;
+    }
+
+    /**
+     * @brief Plans the export of an ASCII table column ( A as utf8, I as int64 and F, E, D as float64 )
+    */
+    inline arrow_column make_ascii_arrow_column(column const& metadata, std::size_t width) {
+        arrow_column col(make_ascii_table_field(metadata, width));
+        switch (col.type) {
+        case 'A': col.types.push_back(arrow_type::make(arrow_type::utf8)); break;
+        case 'I': col.types.push_back(arrow_type::make(arrow_type::integer, 64, true)); break;
+        case 'F': case 'E': case 'D': col.types.push_back(arrow_type::make(arrow_type::floating_point, 64)); break;
+        default: throw invalid_table_colum_format();
+        }
+        return col;
+    }
+}
+
+/**
+ * @brief   Writes FITS table rows as an Arrow IPC file or stream without depending on the Arrow libraries
+ * @details The schema is written when the writer is created and every call to write_batch produces one record
+ *          batch. Fixed width columns are converted with a single pass of byte swapping over the rows, vector columns
+ *          become fixed size lists and TNULL values are recorded in validity bitmaps. The memory used is about
+ *          the size of a batch
+ * @author  agent
+*/
+class arrow_table_writer {
+    std::ofstream out;
+    std::vector<arrow_column> columns_;
+    arrow_format format_;
+    std::size_t position;
+    std::string blocks;
+    std::size_t block_count;
+    std::size_t rows_written;
+    detail::arrow_batch_builder batch;
+    bool closed;
+
+public:
+    /**
+     * @brief Creates the output file and writes the schema
+     * @param[in] path Location of the output file
+     * @param[in] columns Columns to export ( see make_arrow_columns )
+     * @param[in] format Whether the output is an Arrow IPC file or stream
+     * @throws file_writing_exception If the file cannot be created or written
+    */
+    arrow_table_writer(std::string const& path, std::vector<arrow_column> const& columns,
+        arrow_format format = arrow_format::file)
+        :out(path, std::ios::binary | std::ios::trunc), columns_(columns), format_(format), position(0),
+        block_count(0), rows_written(0), closed(false) {
+
+        if (!out) { throw file_writing_exception("Cannot Create File"); }
+        if (format_ == arrow_format::file) { write_bytes("ARROW1\0\0", 8); }
+
+        detail::flatbuffer_builder builder;
+        auto schema = detail::build_arrow_schema(builder, columns_);
+        write_message(detail::finish_arrow_message(builder, detail::arrow_message_schema, schema, 0), false);
+    }
+
+    arrow_table_writer(arrow_table_writer const&) = delete;
+    arrow_table_writer& operator=(arrow_table_writer const&) = delete;
+
+    /**
+     * @brief Closes the output if it has not been closed yet ( errors are ignored )
+    */
+    ~arrow_table_writer() {
+        try { close(); }
+        catch (...) {}
+    }
+
+    /**
+     * @brief Returns the columns written to the output
+    */
+    std::vector<arrow_column> const& columns() const { return columns_; }
+
+    /**
+     * @brief Returns the number of rows written so far
+    */
+    std::size_t total_rows() const { return rows_written; }
+
+    /**
+     * @brief Converts count consecutive rows of the data unit into a record batch
+     * @param[in] rows Start of the first row
+     * @param[in] count Number of rows
+     * @param[in] row_width Width of a row in bytes ( NAXIS1 )
+     * @throws invalid_table_colum_format If a field does not fit in the row
+     * @throws file_reading_exception If an ASCII table field cannot be parsed
+     * @throws file_writing_exception If the output cannot be written
+    */
+    void write_batch(const char* rows, std::size_t count, std::size_t row_width) {
+        batch.clear();
+        batch.reserve(count * row_width + 64 * columns_.size());
+
+        for (auto const& col : columns_) {
+            if (col.offset + col.width > row_width) { throw invalid_table_colum_format(); }
+
+            std::size_t length = count;
+            for (std::size_t level = 0; level + 1 < col.types.size(); level++) {
+                batch.add_node(length, 0);
+                batch.add_buffer(0);
+                length *= static_cast<std::size_t>(col.types[level].width);
+            }
+            if (col.ascii) {
+                detail::encode_ascii_column(batch, col, rows, count, row_width);
+            }
+            else {
+                detail::encode_binary_leaf(batch, col, rows, count, row_width);
+            }
+        }
+
+        detail::flatbuffer_builder builder;
+        auto nodes = builder.create_struct_vector(batch.nodes(), batch.node_count(), 8);
+        auto buffers = builder.create_struct_vector(batch.buffers(), batch.buffer_count(), 8);
+        builder.start_table();
+        builder.add_scalar<std::int64_t>(0, static_cast<std::int64_t>(count));
+        builder.add_offset(1, nodes);
+        builder.add_offset(2, buffers);
+        auto record_batch = builder.end_table();
+
+        write_message(detail::finish_arrow_message(builder, detail::arrow_message_record_batch,
+            record_batch, batch.body().size()), true);
+        rows_written += count;
+    }
+
+    /**
+     * @brief Writes the end of stream marker and for the file format the footer
+     * @throws file_writing_exception If the output cannot be written
+     * @note Calling close more than once has no effect
+    */
+    void close() {
+        if (closed) { return; }
+        closed = true;
+
+        write_bytes("\xFF\xFF\xFF\xFF\0\0\0\0", 8);
+        if (format_ == arrow_format::file) {
+            detail::flatbuffer_builder builder;
+            auto schema = detail::build_arrow_schema(builder, columns_);
+            auto dictionaries = builder.create_struct_vector(std::string(), 0, 8);
+            auto record_batches = builder.create_struct_vector(blocks, block_count, 8);
+            builder.start_table();
+            builder.add_scalar<std::int16_t>(0, detail::arrow_metadata_version);
+            builder.add_offset(1, schema);
+            builder.add_offset(2, dictionaries);
+            builder.add_offset(3, record_batches);
+            std::string footer = builder.finish(builder.end_table());
+
+            write_bytes(footer.data(), footer.size());
+            std::string footer_size;
+            detail::append_little_endian<std::int32_t>(footer_size, static_cast<std::int32_t>(footer.size()));
+            write_bytes(footer_size.data(), footer_size.size());
+            write_bytes("ARROW1", 6);
+        }
+        out.close();
+        if (!out) { throw file_writing_exception("Cannot Write To File"); }
+    }
+
+private:
+    void write_bytes(const char* data, std::size_t size) {
+        out.write(data, static_cast<std::streamsize>(size));
+        if (!out) { throw file_writing_exception("Cannot Write To File"); }
+        position += size;
+    }
+
+    /**
+     * @brief Writes an encapsulated message ( continuation marker, metadata size, metadata and body )
+    */
+    void write_message(std::string const& metadata, bool record_batch) {
+        std::size_t message_start = position;
+        std::string prefix("\xFF\xFF\xFF\xFF", 4);
+        detail::append_little_endian<std::int32_t>(prefix, static_cast<std::int32_t>(metadata.size()));
+        write_bytes(prefix.data(), prefix.size());
+        write_bytes(metadata.data(), metadata.size());
+
+        if (record_batch) {
+            write_bytes(batch.body().data(), batch.body().size());
+
+            detail::append_little_endian<std::int64_t>(blocks, static_cast<std::int64_t>(message_start));
+            detail::append_little_endian<std::int32_t>(blocks, static_cast<std::int32_t>(8 + metadata.size()));
+            detail::append_little_endian<std::int32_t>(blocks, 0);
+            detail::append_little_endian<std::int64_t>(blocks, static_cast<std::int64_t>(batch.body().size()));
+            block_count++;
+        }
+    }
+};
+
+/**
+ * @brief Plans the export of every column of a binary table ( TNULL of integer columns marks null values )
+ * @throws invalid_table_colum_format If a column cannot be exported ( variable length arrays are not supported )
+*/
+template<typename CardPolicy, typename Converter>
+std::vector<arrow_column> make_arrow_columns(basic_binary_table_extension<CardPolicy, Converter> const& table) {
+    return detail::plan_table_fields<arrow_column>(table, [](column const& metadata) {
+        return detail::make_binary_arrow_column(metadata);
+    });
+}
+
+/**
+ * @brief Plans the export of every column of an ASCII table ( fields equal to TNULL or blank are null )
+ * @throws invalid_table_colum_format If a column format is not supported
+*/
+template<typename CardPolicy, typename Converter>
+std::vector<arrow_column> make_arrow_columns(basic_ascii_table<CardPolicy, Converter> const& table) {
+    return detail::plan_table_fields<arrow_column>(table, [](column const& metadata) {
+        return detail::make_ascii_arrow_column(metadata,
+            basic_ascii_table<CardPolicy, Converter>::column_size(metadata.TFORM()));
+    });
+}
+
+/**
+ * @brief Exports a table held in memory to an Arrow IPC file or stream
+ * @param[in] table Binary or ASCII table providing the layout of the rows
+ * @param[in] data_buffer Data unit of the table
+ * @param[in] path Location of the output file
+ * @param[in] format Whether the output is an Arrow IPC file or stream
+ * @param[in] batch_rows Number of rows in a record batch
+ * @throws file_reading_exception If the data unit is smaller than the table described by the header
+ * @throws file_writing_exception If the output cannot be written
+*/
+template<typename Table>
+void write_arrow(Table const& table, std::string const& data_buffer, std::string const& path,
+    arrow_format format = arrow_format::file, std::size_t batch_rows = 65536) {
+
+    std::size_t rows = table.get_header().naxis(2);
+    std::size_t row_width = table.get_header().naxis(1);
+    if (data_buffer.size() < rows * row_width) {
+        throw file_reading_exception("Data unit is smaller than the table described by the header");
+    }
+
+    batch_rows = std::max<std::size_t>(batch_rows, 1);
+    arrow_table_writer writer(path, make_arrow_columns(table), format);
+    for (std::size_t first = 0; first < rows; first += batch_rows) {
+        writer.write_batch(data_buffer.data() + first * row_width, std::min(batch_rows, rows - first), row_width);
+    }
+    writer.close();
+}
+
+/**
+ * @brief Exports a table to an Arrow IPC file or stream reading its data unit from the FITS file batch by batch
+ * @details Only one batch of rows is held in memory, so tables larger than the memory can be exported
+ * @param[in] table Table created from the header of the HDU ( its data is not used )
+ * @param[in,out] file_reader FITS file containing the table
+ * @param[in] data_location Offset of the data unit of the table in the file
+ * @param[in] path Location of the output file
+ * @param[in] format Whether the output is an Arrow IPC file or stream
+ * @param[in] batch_rows Number of rows in a record batch
+ * @throws file_reading_exception If the data unit cannot be read
+ * @throws file_writing_exception If the output cannot be written
+*/
+template<typename Table, typename FileReader>
+void write_arrow(Table const& table, FileReader& file_reader, std::size_t data_location, std::string const& path,
+    arrow_format format = arrow_format::file, std::size_t batch_rows = 65536) {
+
+    std::size_t rows = table.get_header().naxis(2);
+    std::size_t row_width = table.get_header().naxis(1);
+
+    batch_rows = std::max<std::size_t>(batch_rows, 1);
+    arrow_table_writer writer(path, make_arrow_columns(table), format);
+    for (std::size_t first = 0; first < rows; first += batch_rows) {
+        std::size_t count = std::min(batch_rows, rows - first);
+        file_reader.set_reading_pos(data_location + first * row_width);
+        std::string data = file_reader.read(count * row_width);
+        if (data.size() < count * row_width) {
+            throw file_reading_exception("Data unit is smaller than the table described by the header");
+        }
+        writer.write_batch(data.data(), count, row_width);
+    }
+    writer.close();
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_ARROW_WRITER_HPP
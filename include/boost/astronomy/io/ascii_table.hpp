@@ -17,11 +17,15 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include <string>
 #include <cmath>
 #include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 #include <boost/astronomy/io/column.hpp>
 #include <boost/astronomy/io/column_data.hpp>
 #include <boost/astronomy/io/table_extension.hpp>
 #include <boost/endian/conversion.hpp>
+#include <boost/optional.hpp>
 #include <boost/variant.hpp>
 #include <boost/cstdfloat.hpp>
 
@@ -40,15 +44,17 @@ namespace boost { namespace astronomy {  namespace io {
 template<typename CardPolicy,typename Converter>
 struct basic_ascii_table : public table_extension<CardPolicy>
 {
-    mutable std::unordered_map<std::string,
+    /**
+     * @brief Views of the columns created so far ( indexed by column position, empty if not created )
+    */
+    mutable std::vector<boost::optional<
         boost::variant<
-
         column_view<std::string, Converter>,
         column_view<long long, Converter>,
         column_view<float, Converter>,
         column_view<double, Converter>
         >
-    > cached_columns;
+    >> cached_columns;
 
 public:
 
@@ -77,6 +83,21 @@ public:
     }
 
 
+    /**
+     * @brief       Returns a editable view of the column
+     * @param[in]   id Handle of the column obtained from get_column_id
+     * @return      Returns a view of the column for reading or writing data
+     * @throws      std::out_of_range If the handle does not refer to a column of this table
+    */
+    template<typename ColDataType>
+    column_view<ColDataType,Converter>& get_column(column_id id) const {
+        auto& cache_entry = this->cached_columns.at(id.position());
+        if (!cache_entry) {
+            cache_entry = this->template make_column_view<ColDataType,Converter>(id);
+        }
+        return boost::get<column_view<ColDataType,Converter>>(*cache_entry);
+    }
+
     /**
      * @brief       Returns a editable view of the column
      * @param[in]   name Name of the field
@@ -84,19 +105,47 @@ public:
     */ 
     template<typename ColDataType>
     column_view<ColDataType,Converter>& get_column(const std::string& column_name) const {
+        return get_column<ColDataType>(this->get_column_id(column_name));
+    }
 
-        auto cache_entry = this->cached_columns.find(column_name);
+    /**
+     * @brief Overwrites a single field of the table in place, both in the file and in memory
+     * @param[in,out] file_writer Provides operations for writing data into the file
+     * @param[in] data_location Offset of the data unit of this HDU in the file
+     * @param[in] column_name Name of the column containing the field
+     * @param[in] row Row number ( 0 based ) of the field
+     * @param[in] value New value of the field
+     * @throws column_not_found_exception If the column is not present in the table
+     * @throws std::out_of_range If the row is not present in the table
+     * @throws invalid_table_colum_format If the serialized value is wider than the field
+     * @throws invalid_cast If the value is neither arithmetic nor a string, is NaN or infinite or lies outside the range
+     *         of the column
+     * @throws file_writing_exception If the field cannot be written to the file
+    */
+    template<typename ColDataType, typename FileWriter>
+    void write_cell(FileWriter& file_writer, std::size_t data_location,
+        const std::string& column_name, std::size_t row, ColDataType value) {
 
-        if (cache_entry != this->cached_columns.end()) {
-            return boost::get<column_view<ColDataType,Converter>>(this->cached_columns[column_name]);
-        }
-        else {
-            this->cached_columns.emplace(column_name, this->template make_column_view<ColDataType,Converter>(column_name));
-            return boost::get<column_view<ColDataType,Converter>>(this->cached_columns[column_name]);
-        }
+        write_cell(file_writer, data_location, this->get_column_id(column_name), row, value);
     }
 
+    /**
+     * @brief Overwrites a single field of the table in place, both in the file and in memory
+     * @param[in] id Handle of the column containing the field
+     * @throws std::out_of_range If the column or row is not present in the table
+     * @throws invalid_table_colum_format If the serialized value is wider than the field
+     * @throws invalid_cast If the value is neither arithmetic nor a string, is NaN or infinite or lies outside the range
+     *         of the column
+     * @throws file_writing_exception If the field cannot be written to the file
+    */
+    template<typename ColDataType, typename FileWriter>
+    void write_cell(FileWriter& file_writer, std::size_t data_location,
+        column_id id, std::size_t row, ColDataType value) {
 
+        write_cell_impl(file_writer, data_location, id, row, value,
+            std::integral_constant<bool,
+                std::is_arithmetic<ColDataType>::value || std::is_convertible<ColDataType, std::string>::value>());
+    }
 
     /**
      * @brief     Returns the field width based on the specified format
@@ -164,6 +213,46 @@ public:
 
 private:
 
+    /**
+     * @brief Overwrites a single field of the table holding an arithmetic or string value
+    */
+    template<typename ColDataType, typename FileWriter>
+    void write_cell_impl(FileWriter& file_writer, std::size_t data_location,
+        column_id id, std::size_t row, ColDataType const& value, std::true_type) {
+
+        const column& col = this->get_column_metadata(id);
+        if (row >= this->hdu_header.naxis(2)) {
+            throw std::out_of_range("Row not present in the table");
+        }
+
+        std::string serialized_value = Converter::serialize_field(value, col.TFORM());
+        std::size_t field_width = column_size(col.TFORM());
+
+        // The cached column checks that the value fits before anything is written to the file
+        if (!this->tb_data.empty()) {
+            auto& cache_entry = this->cached_columns[id.position()];
+            if (cache_entry) {
+                boost::apply_visitor(column_update_visitor<ColDataType>(static_cast<int>(row), value), *cache_entry);
+            }
+            else {
+                this->tb_data[row][col.index() - 1] = serialized_value;
+            }
+        }
+
+        std::string field = std::string(field_width - serialized_value.length(), ' ') + serialized_value;
+        if (!file_writer.write(field, data_location + row * this->hdu_header.naxis(1) + col.TBCOL() - 1)) {
+            throw file_writing_exception("Cannot write the field");
+        }
+    }
+
+    /**
+     * @brief Fields of ASCII table cannot hold values other than arithmetic or string values
+    */
+    template<typename ColDataType, typename FileWriter>
+    void write_cell_impl(FileWriter&, std::size_t, column_id, std::size_t, ColDataType const&, std::false_type) {
+        throw invalid_cast("Fields of ASCII table can only hold arithmetic or string values");
+    }
+
   
     /**
      * @brief    Populates the metadata information for all fields of ASCII_Table extension
@@ -227,6 +316,9 @@ private:
     */
     void set_ascii_table_info(const std::string& data_buffer) {
         populate_column_data();
+        this->index_columns();
+        this->cached_columns.clear();
+        this->cached_columns.resize(this->tfields_);
 
         if (!data_buffer.empty()) {
           set_table_data(data_buffer);
@@ -19,6 +19,7 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include<boost/cstdfloat.hpp>
 #include<boost/endian/conversion.hpp>
 #include<boost/astronomy/io/column.hpp>
+#include<boost/astronomy/io/binary_field_layout.hpp>
 #include<boost/lexical_cast.hpp>
 #include<type_traits>
 
@@ -179,13 +180,7 @@ namespace boost{namespace astronomy{namespace io{
         * @param[in] format Format of field
        */
         static std::size_t element_count(std::string format) {
-            std::string form = boost::trim_copy_if(format, [](char c) -> bool {
-                return c == '\'' || c == ' ';
-                });
-
-            return form.length() > 1 ?
-                boost::lexical_cast<std::size_t>(form.substr(0, form.length() - 1)) :
-                static_cast<std::size_t>(1);
+            return parse_binary_form(format).repeat;
         }
 
         /**
@@ -217,6 +212,14 @@ namespace boost{namespace astronomy{namespace io{
 
         }
 
+        /**
+         * @brief Serializes the value of a field, binary fields do not depend on the TFORM beyond the type of value
+        */
+        template<typename T>
+        static std::string serialize_field(T data, const std::string&) {
+            return serialize(data);
+        }
+
         /**
          * @brief Overloaded case for Array Descriptors
         */
@@ -259,11 +262,11 @@ namespace boost{namespace astronomy{namespace io{
     };
 
     template<>
-    bool binary_data_converter::deserialize_to(const std::string& element, int) {
+    inline bool binary_data_converter::deserialize_to(const std::string& element, int) {
         return element[0] == 'T';
     }
     template<>
-    std::vector<bool> binary_data_converter::deserialize_to(const std::string& elements,int) {
+    inline std::vector<bool> binary_data_converter::deserialize_to(const std::string& elements,int) {
         std::vector<bool> values;
         for (auto element : elements) {
             values.emplace_back(element == 'T');
@@ -272,46 +275,46 @@ namespace boost{namespace astronomy{namespace io{
     }
 
     template<>
-    boost::int16_t binary_data_converter::deserialize_to(const std::string& element, int) {
+    inline boost::int16_t binary_data_converter::deserialize_to(const std::string& element, int) {
         return element_to_numeric<boost::int16_t>(element);
     }
 
     template<>
-    std::vector<boost::int16_t> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
+    inline std::vector<boost::int16_t> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
         return elements_to_numeric_collection<boost::int16_t>(
             elements, num_elements);
     }
 
     template<>
-    boost::int32_t binary_data_converter::deserialize_to(const std::string& element, int) {
+    inline boost::int32_t binary_data_converter::deserialize_to(const std::string& element, int) {
         return element_to_numeric<boost::int32_t>(element);
     }
     template<>
-    std::vector<boost::int32_t> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
+    inline std::vector<boost::int32_t> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
         return binary_data_converter::elements_to_numeric_collection<boost::int32_t>(
             elements, num_elements);
     }
 
     template<>
-    boost::float32_t binary_data_converter::deserialize_to(const std::string& element,int) {
+    inline boost::float32_t binary_data_converter::deserialize_to(const std::string& element,int) {
         return element_to_numeric<boost::float32_t, boost::int32_t>(element);
     }
     template<>
-    std::vector<boost::float32_t> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
+    inline std::vector<boost::float32_t> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
         return elements_to_numeric_collection<boost::float32_t, boost::int32_t>(
             elements, num_elements);
     }
     template<>
-    boost::float64_t binary_data_converter::deserialize_to(const std::string& element, int) {
+    inline boost::float64_t binary_data_converter::deserialize_to(const std::string& element, int) {
         return binary_data_converter::element_to_numeric<boost::float64_t, boost::int64_t>(element);
     }
     template<>
-    std::vector<boost::float64_t> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
+    inline std::vector<boost::float64_t> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
         return binary_data_converter::elements_to_numeric_collection<boost::float64_t, boost::int64_t>(
             elements, num_elements);
     }
     template<>
-    std::pair<boost::int32_t, boost::int32_t> binary_data_converter::deserialize_to(const std::string& element,int) {
+    inline std::pair<boost::int32_t, boost::int32_t> binary_data_converter::deserialize_to(const std::string& element,int) {
         auto x = boost::endian::big_to_native(
             *reinterpret_cast<const boost::int32_t*>(element.c_str()));
         auto y = boost::endian::big_to_native(
@@ -319,7 +322,7 @@ namespace boost{namespace astronomy{namespace io{
         return std::make_pair(x, y);
     }
     template<>
-    std::vector<std::pair<boost::int32_t, boost::int32_t>> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
+    inline std::vector<std::pair<boost::int32_t, boost::int32_t>> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
         std::vector<std::pair<boost::int32_t, boost::int32_t>> values;
         values.reserve(num_elements);
         for (std::size_t i = 0; i < num_elements; i++) {
@@ -333,49 +336,49 @@ namespace boost{namespace astronomy{namespace io{
         return values;
     }
     template<>
-    std::complex<boost::float32_t> binary_data_converter::deserialize_to(const std::string& element,int) {
+    inline std::complex<boost::float32_t> binary_data_converter::deserialize_to(const std::string& element,int) {
         return element_to_complex<boost::float32_t, boost::int32_t>(element);
     }
     template<>
-    std::vector<std::complex<boost::float32_t>> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
+    inline std::vector<std::complex<boost::float32_t>> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
         return elements_to_complex_collection<boost::float32_t, boost::int32_t>(
             elements, num_elements);
     }
     template<>
-    std::complex<boost::float64_t>binary_data_converter::deserialize_to(const std::string& element,int) {
+    inline std::complex<boost::float64_t>binary_data_converter::deserialize_to(const std::string& element,int) {
         return element_to_complex<boost::float64_t, boost::int64_t>(element);
     }
     template<>
-    std::vector<std::complex<boost::float64_t>> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
+    inline std::vector<std::complex<boost::float64_t>> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
         return elements_to_complex_collection<boost::float64_t, boost::int64_t>(
             elements,num_elements);
     }
     template<>
-    std::uint8_t binary_data_converter::deserialize_to(const std::string& element, int) {
+    inline std::uint8_t binary_data_converter::deserialize_to(const std::string& element, int) {
         return element_to_byte<std::uint8_t>(element);
     }
     template<>
-    std::vector<std::uint8_t> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
+    inline std::vector<std::uint8_t> binary_data_converter::deserialize_to(const std::string& elements, int num_elements) {
         return elements_to_byte_collection<std::uint8_t>(
             elements, num_elements);
     }
     template<>
-    char binary_data_converter::deserialize_to(const std::string& element, int) {
+    inline char binary_data_converter::deserialize_to(const std::string& element, int) {
         return binary_data_converter::element_to_byte<char>(element);
     }
     template<>
-    std::vector<char> binary_data_converter::deserialize_to(const std::string& elements,int num_elements) {
+    inline std::vector<char> binary_data_converter::deserialize_to(const std::string& elements,int num_elements) {
         return binary_data_converter::elements_to_byte_collection<char>(
             elements, num_elements);
     }
 
     template<>
-    std::string binary_data_converter::serialize(bool value) {
+    inline std::string binary_data_converter::serialize(bool value) {
         return value ? std::string(1,'T') : std::string(1,'F');
     }
 
     template<>
-    std::string binary_data_converter::serialize(const std::vector<bool>& values) {
+    inline std::string binary_data_converter::serialize(const std::vector<bool>& values) {
         std::string data;
         data.resize(values.size());
 
@@ -0,0 +1,89 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_BINARY_FIELD_LAYOUT_HPP
+#define BOOST_ASTRONOMY_IO_BINARY_FIELD_LAYOUT_HPP
+
+#include <cstddef>
+#include <string>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+/**
+ * @file    binary_field_layout.hpp
+ * @details Parses the TFORM of binary table fields ( rTa ) into the type, repeat count and width of the field, so
+ *          that every reader and writer of binary tables agrees on how a field is laid out in a row
+*/
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief Position and encoding of a field of a binary table within a row
+*/
+struct binary_field_layout {
+    char type = ' ';              //! Data type of the field ( the letter of TFORM )
+    std::size_t repeat = 1;       //! Number of elements in the field ( bits for X, characters for A )
+    std::size_t offset = 0;       //! Offset of the field from the start of the row
+    std::size_t width = 0;        //! Width of the field in bytes
+    std::size_t element_size = 1; //! Size of the big endian units that need byte swapping ( 1 if none )
+};
+
+/**
+ * @brief Parses the TFORM of a binary table field, leaving the offset at 0
+ * @details Complex values are swapped as two separate reals and array descriptors ( P and Q ) as two integers
+ * @param[in] tform TFORM of the field, quotes and blanks around it are ignored
+ * @throws invalid_table_colum_format If the TFORM is not a valid binary table format
+*/
+inline binary_field_layout parse_binary_form(std::string const& tform) {
+    std::string form = boost::trim_copy_if(tform, [](char c) -> bool {
+        return c == '\'' || c == ' ';
+    });
+    if (form.empty()) { throw invalid_table_colum_format(); }
+
+    // Array descriptors are followed by the type and maximum length of the arrays ( rPt(emax) )
+    std::size_t type_position = form.find_first_of("PQ");
+    if (type_position == std::string::npos) { type_position = form.length() - 1; }
+
+    binary_field_layout layout;
+    layout.type = form[type_position];
+    try {
+        layout.repeat = type_position > 0 ?
+            boost::lexical_cast<std::size_t>(form.substr(0, type_position)) : 1;
+    }
+    catch (boost::bad_lexical_cast const&) { throw invalid_table_colum_format(); }
+
+    std::size_t repeat = layout.repeat;
+    switch (layout.type) {
+    case 'L': case 'B': case 'A': layout.width = repeat; break;
+    case 'X': layout.width = (repeat + 7) / 8; break;
+    case 'I': layout.width = 2 * repeat; layout.element_size = 2; break;
+    case 'J': case 'E': layout.width = 4 * repeat; layout.element_size = 4; break;
+    case 'K': case 'D': layout.width = 8 * repeat; layout.element_size = 8; break;
+    case 'C': case 'P': layout.width = 8 * repeat; layout.element_size = 4; break;
+    case 'M': case 'Q': layout.width = 16 * repeat; layout.element_size = 8; break;
+    default: throw invalid_table_colum_format();
+    }
+    return layout;
+}
+
+/**
+ * @brief Computes the layout of a binary table field from its metadata ( TBCOL and TFORM )
+ * @throws invalid_table_colum_format If the TFORM is not a valid binary table format
+*/
+inline binary_field_layout make_binary_field_layout(column const& metadata) {
+    binary_field_layout layout = parse_binary_form(metadata.TFORM());
+    layout.offset = metadata.TBCOL();
+    return layout;
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_BINARY_FIELD_LAYOUT_HPP
@@ -14,13 +14,17 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include <algorithm>
 #include <complex>
 #include <utility>
+#include <vector>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/cstdfloat.hpp>
+#include <boost/optional.hpp>
+#include <boost/variant.hpp>
 
 #include <boost/astronomy/io/table_extension.hpp>
+#include <boost/astronomy/io/binary_field_layout.hpp>
 #include <boost/astronomy/io/column.hpp>
 #include <boost/astronomy/io/column_data.hpp>
 #include <boost/astronomy/exception/fits_exception.hpp>
@@ -38,7 +42,10 @@ template<typename CardPolicy, typename Converter>
 struct basic_binary_table_extension : table_extension<CardPolicy>
 {
 
-    mutable std::unordered_map<std::string,
+    /**
+     * @brief Views of the columns created so far ( indexed by column position, empty if not created )
+    */
+    mutable std::vector<boost::optional<
         boost::variant<
         column_view<bool, Converter>,
         column_view<std::vector<bool>, Converter>,
@@ -70,7 +77,7 @@ struct basic_binary_table_extension : table_extension<CardPolicy>
         column_view<char, Converter>,
         column_view<std::vector<char>, Converter>
          >
-    > cached_columns;
+    >> cached_columns;
 
 public:
 
@@ -92,6 +99,22 @@ public:
     }
 
     
+    /**
+     * @brief       Returns a editable view of the column
+     * @param[in]   id Handle of the column obtained from get_column_id
+     * @return      Returns a view of the column for reading or writing data
+     * @tparam  ColDataType Data type of the column data stored
+     * @throws      std::out_of_range If the handle does not refer to a column of this table
+    */
+    template<typename ColDataType>
+    column_view<ColDataType, Converter>& get_column(column_id id) {
+        auto& cache_entry = this->cached_columns.at(id.position());
+        if (!cache_entry) {
+            cache_entry = this->template make_column_view<ColDataType, Converter>(id);
+        }
+        return boost::get<column_view<ColDataType, Converter>>(*cache_entry);
+    }
+
     /**
      * @brief       Returns a editable view of the column
      * @param[in]   name Name of the field
@@ -100,15 +123,7 @@ public:
     */
     template<typename ColDataType>
     column_view<ColDataType, Converter>& get_column(const std::string& column_name) {
-        auto cache_entry = this->cached_columns.find(column_name);
-
-        if (cache_entry != this->cached_columns.end()) {
-            return boost::get<column_view<ColDataType, Converter>>(this->cached_columns[column_name]);
-        }
-        else {
-                this->cached_columns.emplace(column_name, this->template make_column_view<ColDataType, Converter>(column_name));
-                return boost::get<column_view<ColDataType, Converter>>(this->cached_columns[column_name]);
-        }
+        return get_column<ColDataType>(this->get_column_id(column_name));
     }
 
     /**
@@ -137,6 +152,64 @@ public:
         file_writer.write(std::string(logical_record_end_pos - current_write_pos, ' '));
     }
 
+    /**
+     * @brief Overwrites a single field of the table in place, both in the file and in memory
+     * @param[in,out] file_writer Provides operations for writing data into the file
+     * @param[in] data_location Offset of the data unit of this HDU in the file
+     * @param[in] column_name Name of the column containing the field
+     * @param[in] row Row number ( 0 based ) of the field
+     * @param[in] value New value of the field
+     * @throws column_not_found_exception If the column is not present in the table
+     * @throws std::out_of_range If the row is not present in the table
+     * @throws invalid_table_colum_format If the serialized value does not match the field width
+     * @throws invalid_cast If the value cannot be stored in the column ( e.g. lies outside the range of its type )
+     * @throws file_writing_exception If the field cannot be written to the file
+    */
+    template<typename ColDataType, typename FileWriter>
+    void write_cell(FileWriter& file_writer, std::size_t data_location,
+        const std::string& column_name, std::size_t row, ColDataType value) {
+
+        write_cell(file_writer, data_location, this->get_column_id(column_name), row, value);
+    }
+
+    /**
+     * @brief Overwrites a single field of the table in place, both in the file and in memory
+     * @param[in] id Handle of the column containing the field
+     * @throws std::out_of_range If the column or row is not present in the table
+     * @throws invalid_table_colum_format If the serialized value does not match the field width
+     * @throws invalid_cast If the value cannot be stored in the column ( e.g. lies outside the range of its type )
+     * @throws file_writing_exception If the field cannot be written to the file
+    */
+    template<typename ColDataType, typename FileWriter>
+    void write_cell(FileWriter& file_writer, std::size_t data_location,
+        column_id id, std::size_t row, ColDataType value) {
+
+        const column& col = this->get_column_metadata(id);
+        if (row >= this->hdu_header.naxis(2)) {
+            throw std::out_of_range("Row not present in the table");
+        }
+
+        std::string serialized_value = Converter::serialize(value);
+        if (serialized_value.length() != column_size(col.TFORM())) {
+            throw invalid_table_colum_format();
+        }
+
+        // The cached column checks that the value fits before anything is written to the file
+        if (!this->tb_data.empty()) {
+            auto& cache_entry = this->cached_columns[id.position()];
+            if (cache_entry) {
+                boost::apply_visitor(column_update_visitor<ColDataType>(static_cast<int>(row), value), *cache_entry);
+            }
+            else {
+                this->tb_data[row][col.index() - 1] = serialized_value;
+            }
+        }
+
+        if (!file_writer.write(serialized_value, data_location + row * this->hdu_header.naxis(1) + col.TBCOL())) {
+            throw file_writing_exception("Cannot write the field");
+        }
+    }
+
     /**
      * @brief      Sets the data of Binary Table from data_buffer
      * @param[in]  data_buffer Data of Binary Table
@@ -151,6 +224,7 @@ public:
      * @brief     Returns the field width based on the specified format
      * @param[in] format Field format
      * @return    Returns the width of the field
+     * @note      Bit arrays ( X ) pack 8 bits in a byte, so nX occupies ( n + 7 ) / 8 bytes
     */
     static std::size_t column_size(std::string format)
     {
@@ -158,6 +232,9 @@ public:
                             return c == '\'' || c == ' ';
                         });
         auto no_of_elements = element_count(form);
+        if (get_type(form) == 'X') {
+            return (no_of_elements + 7) / 8;
+        }
         auto size_type = type_size(get_type(form));
         return no_of_elements * size_type;
     }
@@ -170,13 +247,7 @@ public:
     */
     static std::size_t element_count(std::string format) 
     {
-        std::string form = boost::trim_copy_if(format, [](char c) -> bool {
-                            return c == '\'' || c == ' ';
-                        });
-
-        return form.length() > 1 ?
-            boost::lexical_cast<std::size_t>(form.substr(0, form.length() - 1)) :
-            static_cast<std::size_t>(1);
+        return parse_binary_form(format).repeat;
     }
 
     /**
@@ -197,6 +268,7 @@ public:
      * @brief       Gets the size of a perticular type
      * @param[in]   type  Field type based on binary table extension
      * @return      Size of perticular type
+     * @note        For bit arrays ( X ) this is the size of the byte the bits are packed in, use column_size for the field width
     */
     static std::size_t type_size(char type) 
     {
@@ -212,6 +284,8 @@ public:
             return 2;
         case 'J':
             return 4;
+        case 'K':
+            return 8;
         case 'A':
             return 1;
         case 'E':
@@ -310,6 +384,9 @@ private:
     */
     void set_binary_table_info(const std::string& data_buffer) {
         populate_column_data();
+        this->index_columns();
+        this->cached_columns.clear();
+        this->cached_columns.resize(this->tfields_);
         if (!data_buffer.empty()) {
             set_table_data(data_buffer);
         }
@@ -340,7 +417,7 @@ private:
             starting_offset = ending_offset;
             ending_offset = starting_offset + column_size(this->col_metadata_[current_column].TFORM());
 
-            this->tb_data[current_row][current_column++] = boost::algorithm::trim_copy(std::string(starting_offset, ending_offset));
+            this->tb_data[current_row][current_column++] = std::string(starting_offset, ending_offset);
             if (current_column % this->tfields_ == 0) {
                 current_row++;
                 current_column = 0;
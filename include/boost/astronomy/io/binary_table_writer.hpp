@@ -0,0 +1,346 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_BINARY_TABLE_WRITER_HPP
+#define BOOST_ASTRONOMY_IO_BINARY_TABLE_WRITER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+
+#include <boost/astronomy/io/binary_field_layout.hpp>
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/io/default_card_policy.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/io/table_schema.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief   Writes a BINTABLE extension row by row without holding the table in memory
+ * @details The header is written when the writer is created with NAXIS2 = 0. Rows are encoded into a batch
+ *          buffer of batch_rows rows which is appended to the file whenever it fills up, so the memory used does
+ *          not depend on the size of the table. close() writes the last batch, pads the data unit and
+ *          rewrites the header with the final NAXIS2
+ * @tparam  FileWriter Stream used for writing the file ( e.g fits_stream )
+ * @tparam  CardPolicy Policy of the header cards
+ * @note    Variable length array ( P ) columns are not supported, so PCOUNT is always 0
+ * @author  agent
+*/
+template<typename FileWriter, typename CardPolicy>
+class basic_binary_table_writer {
+    /**
+     * @brief Position, type and repeat count of a field in the row
+    */
+    struct field_info {
+        std::size_t offset;
+        std::size_t width;
+        std::size_t repeat;
+        char type;
+    };
+
+    FileWriter file_writer;
+    header<CardPolicy> table_header;
+    std::vector<field_info> fields;
+    std::size_t header_location;
+    std::size_t write_location;
+    std::size_t row_width;
+    std::size_t rows_written;
+    std::string batch;
+    std::size_t batch_used;
+    bool closed;
+
+public:
+    /**
+     * @brief Creates the file and writes the header of the table
+     * @param[in] path Location of the file
+     * @param[in] columns Columns of the table ( TTYPE, TFORM and optionally TUNIT of each column are used )
+     * @param[in] extname Name of the extension ( EXTNAME is omitted if empty )
+     * @param[in] append Whether the table is appended to an existing FITS file instead of a new file
+     *            ( a new file starts with an empty primary HDU )
+     * @param[in] batch_rows Number of rows buffered before they are written to the file
+     * @throws file_writing_exception If the file cannot be created or written
+     * @throws file_reading_exception If the file to append to cannot be opened or is not a sequence of logical records
+     * @throws invalid_table_colum_format If a column format is not supported
+    */
+    basic_binary_table_writer(std::string const& path, std::vector<column> const& columns,
+        std::string const& extname = "", bool append = false, std::size_t batch_rows = 4096)
+        :header_location(0), write_location(0), row_width(0), rows_written(0), batch_used(0), closed(false) {
+
+        for (auto const& col : columns) {
+            fields.push_back(make_field_info(col, row_width));
+            row_width += fields.back().width;
+        }
+        batch.resize(std::max<std::size_t>(batch_rows, 1) * std::max<std::size_t>(row_width, 1));
+
+        if (append) {
+            file_writer.set_file_for_update(path);
+            write_location = file_writer.file_size();
+            if (write_location % 2880 != 0) {
+                throw file_reading_exception("File does not end at the boundary of a logical record");
+            }
+        }
+        else {
+            if (!file_writer.create_file(path)) {
+                throw file_writing_exception("Cannot Create File");
+            }
+            write_empty_primary_hdu();
+        }
+
+        build_header(columns, extname);
+        header_location = write_location;
+        write_data(table_header.raw_records());
+    }
+
+    basic_binary_table_writer(basic_binary_table_writer const&) = delete;
+    basic_binary_table_writer& operator=(basic_binary_table_writer const&) = delete;
+
+    /**
+     * @brief Closes the table if it has not been closed yet ( errors are ignored )
+    */
+    ~basic_binary_table_writer() {
+        try { close(); }
+        catch (...) {}
+    }
+
+    /**
+     * @brief Returns the number of rows written so far
+    */
+    std::size_t total_rows() const { return rows_written; }
+
+    /**
+     * @brief Returns the width of a row in bytes ( NAXIS1 )
+    */
+    std::size_t width() const { return row_width; }
+
+    /**
+     * @brief Appends a single row
+     * @details Each value is encoded according to the format of its column ( e.g double for D,
+     *          std::array<float, 10> for 10E, std::string for nA )
+     * @param[in] values Value of every column in the order of columns
+     * @throws column_exception If the number of values does not match the number of columns
+     * @throws invalid_table_colum_format If the type of a value does not match the format of its column
+    */
+    template<typename... Values>
+    void write_row(Values const&... values) {
+        check_column_count(sizeof...(Values));
+        check_row_types<Values...>(std::index_sequence_for<Values...>());
+
+        char* row = next_row();
+        encode_row(row, std::index_sequence_for<Values...>(), values...);
+    }
+
+    /**
+     * @brief Appends a batch of rows given column by column
+     * @details Every column is an array of rows * repeat elements of the element type of the column
+     *          ( e.g float for 10E, char for 8A, std::complex<double> for M )
+     * @param[in] rows Number of rows in the batch
+     * @param[in] columns Pointer to the elements of every column in the order of columns
+     * @throws column_exception If the number of columns does not match
+     * @throws invalid_table_colum_format If the element type of a column does not match its format
+    */
+    template<typename... Elements>
+    void write_columns(std::size_t rows, Elements const*... columns) {
+        check_column_count(sizeof...(Elements));
+        check_element_types<Elements...>(std::index_sequence_for<Elements...>());
+
+        for (std::size_t row = 0; row < rows; row++) {
+            char* row_start = next_row();
+            encode_elements(row_start, row, std::index_sequence_for<Elements...>(), columns...);
+        }
+    }
+
+    /**
+     * @brief Appends rows that are already encoded in the FITS format ( big endian, NAXIS1 bytes per row )
+     * @param[in] data Start of the first row
+     * @param[in] rows Number of rows
+    */
+    void write_raw_rows(const char* data, std::size_t rows) {
+        for (std::size_t row = 0; row < rows; row++) {
+            std::memcpy(next_row(), data + row * row_width, row_width);
+        }
+    }
+
+    /**
+     * @brief Writes the buffered rows, pads the data unit and records the final number of rows in the header
+     * @throws file_writing_exception If the file cannot be written
+     * @note Calling close more than once has no effect
+    */
+    void close() {
+        if (closed) { return; }
+        closed = true;
+
+        flush_batch();
+        std::size_t padding = (2880 - write_location % 2880) % 2880;
+        write_data(std::string(padding, '\0'));
+
+        table_header.set_value_of("NAXIS2", static_cast<long long>(rows_written));
+        if (!file_writer.write(table_header.raw_records(), header_location)) {
+            throw file_writing_exception("Cannot update the header of the table");
+        }
+        file_writer.flush();
+        file_writer.close();
+    }
+
+private:
+    /**
+     * @brief Extracts the type and repeat count from TFORM and places the field at offset
+    */
+    static field_info make_field_info(column const& col, std::size_t offset) {
+        column positioned = col;
+        positioned.TBCOL(offset);
+        binary_field_layout layout = make_binary_field_layout(positioned);
+        if (layout.type == 'P' || layout.type == 'Q') { throw invalid_table_colum_format(); }
+
+        field_info info;
+        info.offset = offset;
+        info.width = layout.width;
+        info.type = layout.type;
+        info.repeat = layout.repeat;
+        return info;
+    }
+
+    template<typename ValueType>
+    static card<CardPolicy> make_card(std::string const& key, ValueType value) {
+        card<CardPolicy> new_card;
+        new_card.create_card(key, value);
+        return new_card;
+    }
+
+    void write_empty_primary_hdu() {
+        header<CardPolicy> primary_header;
+        primary_header.add_card(make_card("SIMPLE", true));
+        primary_header.add_card(make_card("BITPIX", 8));
+        primary_header.add_card(make_card("NAXIS", 0));
+        primary_header.add_card(make_card("EXTEND", true));
+        primary_header.add_card(card<CardPolicy>("END" + std::string(77, ' ')));
+        write_data(primary_header.raw_records());
+    }
+
+    void build_header(std::vector<column> const& columns, std::string const& extname) {
+        table_header.add_card(make_card("XTENSION", std::string("BINTABLE")));
+        table_header.add_card(make_card("BITPIX", 8));
+        table_header.add_card(make_card("NAXIS", 2));
+        table_header.add_card(make_card("NAXIS1", static_cast<long long>(row_width)));
+        table_header.add_card(make_card("NAXIS2", 0LL));
+        table_header.add_card(make_card("PCOUNT", 0));
+        table_header.add_card(make_card("GCOUNT", 1));
+        table_header.add_card(make_card("TFIELDS", static_cast<long long>(columns.size())));
+        for (std::size_t i = 0; i < columns.size(); i++) {
+            std::string index = boost::lexical_cast<std::string>(i + 1);
+            if (!columns[i].TTYPE().empty()) { table_header.add_card(make_card("TTYPE" + index, columns[i].TTYPE())); }
+            table_header.add_card(make_card("TFORM" + index, columns[i].TFORM()));
+            if (!columns[i].TUNIT().empty()) { table_header.add_card(make_card("TUNIT" + index, columns[i].TUNIT())); }
+        }
+        if (!extname.empty()) { table_header.add_card(make_card("EXTNAME", extname)); }
+        table_header.add_card(card<CardPolicy>("END" + std::string(77, ' ')));
+    }
+
+    void write_data(std::string const& data) {
+        if (!file_writer.write(data, write_location)) {
+            throw file_writing_exception("Cannot Write To File");
+        }
+        write_location += data.size();
+    }
+
+    /**
+     * @brief Returns the space for the next row in the batch, writing the batch to the file if it is full
+    */
+    char* next_row() {
+        if (batch_used + row_width > batch.size()) { flush_batch(); }
+        char* row = &batch[batch_used];
+        batch_used += row_width;
+        rows_written++;
+        return row;
+    }
+
+    void flush_batch() {
+        if (batch_used == 0) { return; }
+        if (batch_used == batch.size()) {
+            write_data(batch);
+        }
+        else {
+            write_data(batch.substr(0, batch_used));
+        }
+        batch_used = 0;
+    }
+
+    void check_column_count(std::size_t count) const {
+        if (count != fields.size()) { throw column_exception(); }
+    }
+
+    /**
+     * @brief Checks that the value type matches the type and repeat count of the column
+    */
+    template<typename Value>
+    void check_value_type(std::size_t index) const {
+        typedef binary_field<Value> field;
+        if (field::type() != fields[index].type ||
+            (field::repeat() != 0 && field::repeat() != fields[index].repeat)) {
+            throw invalid_table_colum_format();
+        }
+    }
+
+    template<typename... Values, std::size_t... Indices>
+    void check_row_types(std::index_sequence<Indices...>) const {
+        int expand[] = { 0, (check_value_type<Values>(Indices), 0)... };
+        (void)expand;
+    }
+
+    /**
+     * @brief Checks that the element type matches the type of the column ( the repeat count can be anything )
+    */
+    template<typename Element>
+    void check_element_type(std::size_t index) const {
+        typedef binary_field<Element> field;
+        if (field::type() != fields[index].type || field::repeat() != 1) {
+            throw invalid_table_colum_format();
+        }
+    }
+
+    template<typename... Elements, std::size_t... Indices>
+    void check_element_types(std::index_sequence<Indices...>) const {
+        int expand[] = { 0, (check_element_type<Elements>(Indices), 0)... };
+        (void)expand;
+    }
+
+    template<typename... Values, std::size_t... Indices>
+    void encode_row(char* row, std::index_sequence<Indices...>, Values const&... values) const {
+        int expand[] = { 0, (binary_field<Values>::encode(values, row + fields[Indices].offset, fields[Indices].width), 0)... };
+        (void)expand;
+    }
+
+    template<typename Element>
+    void encode_field(char* row, std::size_t row_index, std::size_t index, const Element* column_data) const {
+        field_info const& info = fields[index];
+        const Element* elements = column_data + row_index * info.repeat;
+        for (std::size_t i = 0; i < info.repeat; i++) {
+            binary_field<Element>::encode(elements[i], row + info.offset + i * binary_field<Element>::size(),
+                binary_field<Element>::size());
+        }
+    }
+
+    template<typename... Elements, std::size_t... Indices>
+    void encode_elements(char* row, std::size_t row_index, std::index_sequence<Indices...>, Elements const*... columns) const {
+        int expand[] = { 0, (encode_field(row, row_index, Indices, columns), 0)... };
+        (void)expand;
+    }
+};
+
+using binary_table_writer = basic_binary_table_writer<fits_stream, card_policy>;
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_BINARY_TABLE_WRITER_HPP
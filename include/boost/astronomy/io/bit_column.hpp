@@ -0,0 +1,481 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_BIT_COLUMN_HPP
+#define BOOST_ASTRONOMY_IO_BIT_COLUMN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/io/column_transpose.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+namespace detail {
+
+    /**
+     * @brief Returns the number of bits set in word
+    */
+    inline std::size_t popcount(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<std::size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    /**
+     * @brief Returns the number of bits set in size bytes starting at bytes
+    */
+    inline std::size_t popcount(const std::uint8_t* bytes, std::size_t size) {
+        std::size_t count = 0;
+        std::size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + i, 8);
+            count += popcount(word);
+        }
+        for (; i < size; i++) { count += popcount(bytes[i]); }
+        return count;
+    }
+
+    /**
+     * @brief Checks that the column has the expected type and fits in the row, and returns its layout
+     * @throws invalid_table_colum_format If the column has a different type or does not fit in the row
+    */
+    inline binary_field_layout checked_field_layout(column const& metadata, std::size_t row_width, char type) {
+        binary_field_layout layout = make_binary_field_layout(metadata);
+        if (layout.type != type || layout.offset + layout.width > row_width) { throw invalid_table_colum_format(); }
+        return layout;
+    }
+
+    /**
+     * @brief Checks that the data unit holds all the rows described by the header of the table
+     * @throws file_reading_exception If the data unit is smaller than the table
+    */
+    template<typename CardPolicy, typename Converter>
+    void check_data_unit(basic_binary_table_extension<CardPolicy, Converter> const& table, std::string const& data_buffer) {
+        if (data_buffer.size() < table.get_header().naxis(2) * table.get_header().naxis(1)) {
+            throw file_reading_exception("Data unit is smaller than the table described by the header");
+        }
+    }
+}
+
+/**
+ * @brief   Set of rows of a table stored as one bit per row
+ * @details Used as the result of filtering flag columns. Masks are combined 64 rows at a time
+ *          and the bits past the last row are always kept clear
+*/
+class row_mask {
+    std::vector<std::uint64_t> words_;
+    std::size_t rows_;
+
+public:
+    /**
+     * @brief Creates a mask of rows rows which are all selected if value is true
+    */
+    explicit row_mask(std::size_t rows = 0, bool value = false)
+        :words_((rows + 63) / 64, value ? ~std::uint64_t(0) : 0), rows_(rows) {
+        clear_padding();
+    }
+
+    /**
+     * @brief Returns the number of rows covered by the mask
+    */
+    std::size_t size() const { return rows_; }
+
+    /**
+     * @brief Returns whether the row is selected
+    */
+    bool test(std::size_t row) const { return (words_[row / 64] >> (row % 64)) & 1; }
+
+    /**
+     * @brief Selects or deselects the row
+    */
+    void set(std::size_t row, bool value = true) {
+        std::uint64_t bit = std::uint64_t(1) << (row % 64);
+        words_[row / 64] = value ? (words_[row / 64] | bit) : (words_[row / 64] & ~bit);
+    }
+
+    /**
+     * @brief Returns the number of selected rows
+    */
+    std::size_t count() const {
+        std::size_t total = 0;
+        for (std::uint64_t word : words_) { total += detail::popcount(word); }
+        return total;
+    }
+
+    /**
+     * @brief Returns whether any row is selected
+    */
+    bool any() const {
+        return std::any_of(words_.begin(), words_.end(), [](std::uint64_t word) { return word != 0; });
+    }
+
+    /**
+     * @brief Returns the positions of the selected rows in increasing order
+    */
+    std::vector<std::size_t> selected_rows() const {
+        std::vector<std::size_t> rows;
+        rows.reserve(count());
+        for (std::size_t i = 0; i < words_.size(); i++) {
+            for (std::uint64_t word = words_[i]; word != 0; word &= word - 1) {
+                std::size_t bit = 0;
+                while (((word >> bit) & 1) == 0) { bit++; }
+                rows.push_back(i * 64 + bit);
+            }
+        }
+        return rows;
+    }
+
+    /**
+     * @brief Keeps only the rows selected in both masks
+     * @throws std::invalid_argument If the masks cover a different number of rows
+    */
+    row_mask& operator&=(row_mask const& other) {
+        check_size(other);
+        for (std::size_t i = 0; i < words_.size(); i++) { words_[i] &= other.words_[i]; }
+        return *this;
+    }
+
+    /**
+     * @brief Selects the rows selected in either mask
+     * @throws std::invalid_argument If the masks cover a different number of rows
+    */
+    row_mask& operator|=(row_mask const& other) {
+        check_size(other);
+        for (std::size_t i = 0; i < words_.size(); i++) { words_[i] |= other.words_[i]; }
+        return *this;
+    }
+
+    /**
+     * @brief Inverts the selection of every row
+    */
+    row_mask& flip() {
+        for (auto& word : words_) { word = ~word; }
+        clear_padding();
+        return *this;
+    }
+
+    /**
+     * @brief Returns the words of the mask ( row r is bit r % 64 of word r / 64 )
+    */
+    const std::uint64_t* data() const { return words_.data(); }
+    std::uint64_t* data() { return words_.data(); }
+
+    /**
+     * @brief Returns the number of 64 bit words in the mask
+    */
+    std::size_t word_count() const { return words_.size(); }
+
+    bool operator==(row_mask const& other) const { return rows_ == other.rows_ && words_ == other.words_; }
+    bool operator!=(row_mask const& other) const { return !(*this == other); }
+
+private:
+    void check_size(row_mask const& other) const {
+        if (other.rows_ != rows_) { throw std::invalid_argument("Masks cover a different number of rows"); }
+    }
+
+    void clear_padding() {
+        if (rows_ % 64 != 0) { words_.back() &= (std::uint64_t(1) << (rows_ % 64)) - 1; }
+    }
+};
+
+inline row_mask operator&(row_mask lhs, row_mask const& rhs) { return lhs &= rhs; }
+inline row_mask operator|(row_mask lhs, row_mask const& rhs) { return lhs |= rhs; }
+inline row_mask operator~(row_mask mask) { return mask.flip(); }
+
+/**
+ * @brief   Bit array ( X ) column of a binary table kept packed as in the file
+ * @details Each row holds ( bits + 7 ) / 8 bytes with the first bit in the most significant bit of the first
+ *          byte. The unused bits of the last byte are cleared, so whole bytes can be counted and compared
+*/
+class bit_column {
+    std::vector<std::uint8_t> fields_;
+    std::size_t rows_;
+    std::size_t bits_;
+    std::size_t width_;
+
+public:
+    /**
+     * @brief Creates a column of rows fields of bits bits each, all cleared
+    */
+    bit_column(std::size_t rows, std::size_t bits)
+        :fields_(rows * ((bits + 7) / 8), 0), rows_(rows), bits_(bits), width_((bits + 7) / 8) {}
+
+    /**
+     * @brief Returns the number of rows in the column
+    */
+    std::size_t rows() const { return rows_; }
+
+    /**
+     * @brief Returns the number of bits in a field ( repeat count of the column )
+    */
+    std::size_t bits() const { return bits_; }
+
+    /**
+     * @brief Returns the width of a field in bytes
+    */
+    std::size_t field_width() const { return width_; }
+
+    /**
+     * @brief Returns the packed bits of the row
+    */
+    const std::uint8_t* field(std::size_t row) const { return fields_.data() + row * width_; }
+    std::uint8_t* field(std::size_t row) { return fields_.data() + row * width_; }
+
+    /**
+     * @brief Returns the value of a bit of the row
+    */
+    bool test(std::size_t row, std::size_t bit) const {
+        return (field(row)[bit / 8] >> (7 - bit % 8)) & 1;
+    }
+
+    /**
+     * @brief Returns the number of bits set in the row
+    */
+    std::size_t popcount(std::size_t row) const { return detail::popcount(field(row), width_); }
+
+    /**
+     * @brief Returns the number of bits set in the whole column
+    */
+    std::size_t count() const { return detail::popcount(fields_.data(), fields_.size()); }
+
+    /**
+     * @brief Returns the rows in which the given bit is set
+     * @throws std::out_of_range If the bit is not present in the column
+    */
+    row_mask mask(std::size_t bit) const {
+        if (bit >= bits_) { throw std::out_of_range("Bit not present in the column"); }
+        row_mask result(rows_);
+        const std::uint8_t* source = fields_.data() + bit / 8;
+        unsigned shift = 7 - static_cast<unsigned>(bit % 8);
+        std::uint64_t* words = result.data();
+
+        for (std::size_t first = 0; first < rows_; first += 64) {
+            std::size_t block = std::min<std::size_t>(64, rows_ - first);
+            std::uint64_t word = 0;
+            for (std::size_t i = 0; i < block; i++) {
+                word |= static_cast<std::uint64_t>((source[(first + i) * width_] >> shift) & 1) << i;
+            }
+            words[first / 64] = word;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the rows in which at least one of the given bits is set
+    */
+    row_mask any_of(std::vector<std::size_t> const& bit_positions) const {
+        std::vector<std::uint8_t> pattern = make_pattern(bit_positions);
+        return select_rows([&](const std::uint8_t* row) {
+            std::uint8_t common = 0;
+            for (std::size_t i = 0; i < width_; i++) { common |= static_cast<std::uint8_t>(row[i] & pattern[i]); }
+            return common != 0;
+        });
+    }
+
+    /**
+     * @brief Returns the rows in which all of the given bits are set
+    */
+    row_mask all_of(std::vector<std::size_t> const& bit_positions) const {
+        std::vector<std::uint8_t> pattern = make_pattern(bit_positions);
+        return select_rows([&](const std::uint8_t* row) {
+            std::uint8_t missing = 0;
+            for (std::size_t i = 0; i < width_; i++) { missing |= static_cast<std::uint8_t>(~row[i] & pattern[i]); }
+            return missing == 0;
+        });
+    }
+
+    /**
+     * @brief Expands the bits of the row into bytes holding 0 or 1
+     * @param[in] row Row to unpack
+     * @param[out] destination Space for bits() bytes
+    */
+    void unpack(std::size_t row, std::uint8_t* destination) const {
+        const std::uint8_t* source = field(row);
+        std::size_t full_bytes = bits_ / 8;
+        for (std::size_t i = 0; i < full_bytes; i++) {
+            std::uint8_t byte = source[i];
+            for (unsigned bit = 0; bit < 8; bit++) {
+                destination[8 * i + bit] = static_cast<std::uint8_t>((byte >> (7 - bit)) & 1);
+            }
+        }
+        for (std::size_t bit = 8 * full_bytes; bit < bits_; bit++) {
+            destination[bit] = static_cast<std::uint8_t>((source[bit / 8] >> (7 - bit % 8)) & 1);
+        }
+    }
+
+    /**
+     * @brief Expands the bits of every row into bytes holding 0 or 1 ( bits() bytes per row )
+    */
+    std::vector<std::uint8_t> unpack() const {
+        std::vector<std::uint8_t> unpacked(rows_ * bits_);
+        for (std::size_t row = 0; row < rows_; row++) { unpack(row, unpacked.data() + row * bits_); }
+        return unpacked;
+    }
+
+private:
+    std::vector<std::uint8_t> make_pattern(std::vector<std::size_t> const& bit_positions) const {
+        std::vector<std::uint8_t> pattern(width_, 0);
+        for (std::size_t bit : bit_positions) {
+            if (bit >= bits_) { throw std::out_of_range("Bit not present in the column"); }
+            pattern[bit / 8] |= static_cast<std::uint8_t>(0x80 >> (bit % 8));
+        }
+        return pattern;
+    }
+
+    template<typename Predicate>
+    row_mask select_rows(Predicate predicate) const {
+        row_mask result(rows_);
+        std::uint64_t* words = result.data();
+        for (std::size_t first = 0; first < rows_; first += 64) {
+            std::size_t block = std::min<std::size_t>(64, rows_ - first);
+            std::uint64_t word = 0;
+            for (std::size_t i = 0; i < block; i++) {
+                word |= static_cast<std::uint64_t>(predicate(field(first + i))) << i;
+            }
+            words[first / 64] = word;
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Extracts a bit array ( X ) column from the row major data unit of a binary table
+ * @param[in] data Start of the data unit
+ * @param[in] rows Number of rows ( NAXIS2 )
+ * @param[in] row_width Width of a row in bytes ( NAXIS1 )
+ * @param[in] metadata Metadata of the column ( TBCOL holds the offset of the field in the row )
+ * @throws invalid_table_colum_format If the column is not a bit array or does not fit in the row
+*/
+inline bit_column read_bit_column(const char* data, std::size_t rows, std::size_t row_width, column const& metadata) {
+    binary_field_layout layout = detail::checked_field_layout(metadata, row_width, 'X');
+    bit_column bits(rows, layout.repeat);
+
+    std::uint8_t last_byte_mask = bits.bits() % 8 == 0 ? 0xFF : static_cast<std::uint8_t>(0xFF << (8 - bits.bits() % 8));
+    for (std::size_t row = 0; row < rows; row++) {
+        std::uint8_t* field = bits.field(row);
+        std::memcpy(field, data + row * row_width + layout.offset, layout.width);
+        if (layout.width != 0) { field[layout.width - 1] &= last_byte_mask; }
+    }
+    return bits;
+}
+
+/**
+ * @brief Extracts a bit array ( X ) column of the binary table
+ * @param[in] table Binary table providing the layout of the rows
+ * @param[in] data_buffer Data unit of the binary table
+ * @param[in] id Handle of the column
+ * @throws file_reading_exception If the data unit is smaller than the table described by the header
+ * @throws invalid_table_colum_format If the column is not a bit array
+*/
+template<typename CardPolicy, typename Converter>
+bit_column read_bit_column(basic_binary_table_extension<CardPolicy, Converter> const& table,
+    std::string const& data_buffer, column_id id) {
+    detail::check_data_unit(table, data_buffer);
+    return read_bit_column(data_buffer.data(), table.get_header().naxis(2), table.get_header().naxis(1),
+        table.get_column_metadata(id));
+}
+
+/**
+ * @brief Decodes a logical ( L ) column into bytes holding 1 for true and 0 for false or undefined
+ * @param[in] data Start of the data unit
+ * @param[in] rows Number of rows ( NAXIS2 )
+ * @param[in] row_width Width of a row in bytes ( NAXIS1 )
+ * @param[in] metadata Metadata of the column ( TBCOL holds the offset of the field in the row )
+ * @return The values of every row one after another ( repeat count bytes per row )
+ * @throws invalid_table_colum_format If the column is not logical or does not fit in the row
+*/
+inline std::vector<std::uint8_t> decode_logical(const char* data, std::size_t rows, std::size_t row_width,
+    column const& metadata) {
+    binary_field_layout layout = detail::checked_field_layout(metadata, row_width, 'L');
+
+    std::vector<std::uint8_t> values(rows * layout.width);
+    std::uint8_t* destination = values.data();
+    for (std::size_t row = 0; row < rows; row++) {
+        const char* field = data + row * row_width + layout.offset;
+        for (std::size_t i = 0; i < layout.width; i++) {
+            destination[i] = static_cast<std::uint8_t>(field[i] == 'T');
+        }
+        destination += layout.width;
+    }
+    return values;
+}
+
+/**
+ * @brief Decodes a logical ( L ) column of the binary table into bytes holding 1 for true and 0 otherwise
+ * @throws file_reading_exception If the data unit is smaller than the table described by the header
+ * @throws invalid_table_colum_format If the column is not logical
+*/
+template<typename CardPolicy, typename Converter>
+std::vector<std::uint8_t> decode_logical(basic_binary_table_extension<CardPolicy, Converter> const& table,
+    std::string const& data_buffer, column_id id) {
+    detail::check_data_unit(table, data_buffer);
+    return decode_logical(data_buffer.data(), table.get_header().naxis(2), table.get_header().naxis(1),
+        table.get_column_metadata(id));
+}
+
+/**
+ * @brief Returns the rows in which an element of a logical ( L ) column is true
+ * @param[in] data Start of the data unit
+ * @param[in] rows Number of rows ( NAXIS2 )
+ * @param[in] row_width Width of a row in bytes ( NAXIS1 )
+ * @param[in] metadata Metadata of the column ( TBCOL holds the offset of the field in the row )
+ * @param[in] element Index of the element within the field
+ * @throws invalid_table_colum_format If the column is not logical or does not fit in the row
+ * @throws std::out_of_range If the element is not present in the field
+*/
+inline row_mask logical_mask(const char* data, std::size_t rows, std::size_t row_width,
+    column const& metadata, std::size_t element = 0) {
+    binary_field_layout layout = detail::checked_field_layout(metadata, row_width, 'L');
+    if (element >= layout.width) { throw std::out_of_range("Element not present in the column"); }
+
+    row_mask result(rows);
+    std::uint64_t* words = result.data();
+    const char* source = data + layout.offset + element;
+    for (std::size_t first = 0; first < rows; first += 64) {
+        std::size_t block = std::min<std::size_t>(64, rows - first);
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < block; i++) {
+            word |= static_cast<std::uint64_t>(source[(first + i) * row_width] == 'T') << i;
+        }
+        words[first / 64] = word;
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the rows in which an element of a logical ( L ) column of the binary table is true
+ * @throws file_reading_exception If the data unit is smaller than the table described by the header
+ * @throws invalid_table_colum_format If the column is not logical
+ * @throws std::out_of_range If the element is not present in the field
+*/
+template<typename CardPolicy, typename Converter>
+row_mask logical_mask(basic_binary_table_extension<CardPolicy, Converter> const& table,
+    std::string const& data_buffer, column_id id, std::size_t element = 0) {
+    detail::check_data_unit(table, data_buffer);
+    return logical_mask(data_buffer.data(), table.get_header().naxis(2), table.get_header().naxis(1),
+        table.get_column_metadata(id), element);
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_BIT_COLUMN_HPP
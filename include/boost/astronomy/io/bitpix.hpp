@@ -31,7 +31,7 @@ enum class bitpix
  * @brief   Returns the element's size on the basis of its bitpix type
  * @param[in]  bitpix_value The bitpix value associated with the element
 */
- int get_element_size_from_bitpix(bitpix bitpix_value) {
+inline int get_element_size_from_bitpix(bitpix bitpix_value) {
     switch (bitpix_value)
     {
     case boost::astronomy::io::bitpix::B8:
@@ -10,13 +10,15 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #ifndef BOOST_ASTRONOMY_IO_CARD_HPP
 #define BOOST_ASTRONOMY_IO_CARD_HPP
 
+#include <algorithm>
+#include <array>
 #include <string>
 #include <sstream>
 
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/type.hpp>
-#include <boost/variant.hpp>
+#include <boost/utility/string_view.hpp>
 
 #include <boost/astronomy/io/default_card_policy.hpp>
 #include <boost/astronomy/exception/fits_exception.hpp>
@@ -28,25 +30,24 @@ namespace boost { namespace astronomy { namespace io {
 /**
  * @brief   Represents the concept of <strong>card</strong> associated with the FITS standard.
  * @details This structure provides functions for storage, manipulation and access of FITS cards.
+ *          The card is stored in place as its 80 characters, so a card does not allocate any memory
  * @author  Pranam Lashkari, Gopi Krishna Menon
  */
 template<typename CardPolicy>
 struct card: CardPolicy
 {
 private:
-    std::string card_;
-    typedef typename boost::make_variant_over< typename CardPolicy::supported_types>::type cache;
-    mutable cache card_cache;
+    std::array<char, 80> card_;
 
 public:
 
     /**
      * @brief   Default Constructor to create a standalone object of <strong>card</strong>
-     * @throws  std::bad_alloc If the request of 80 bytes of memory fails.
+     * @details The card is initialized with blanks
     */
     card()
     {
-        this->card_.reserve(80);
+        this->card_.fill(' ');
     }
 
     
@@ -55,12 +56,13 @@ public:
      * @brief       Takes a string as argument and creates a card object based on that string.
      * @details     This function accepts a string as an argument and stores it internally provided
                     the content inside the string complies with the FITS standard requirements.
+                    Cards shorter than 80 characters are padded with blanks
      * @param[in]   str String that contains the key-value-comment data
     */
-    card(std::string fits_card) : card()
+    card(boost::string_view fits_card) : card()
     {
         if (this->is_card_valid(fits_card)) {
-            this->card_ = fits_card;
+            std::copy(fits_card.begin(), fits_card.end(), this->card_.begin());
         }
         else {
             throw invalid_card();
@@ -101,8 +103,7 @@ public:
     template <typename Value>
     void create_card(std::string const& key, Value value, std::string const& comment = "")
     {
-        create_card_impl(key, this->serialize_to_fits_format(value), comment);
-
+        create_card_impl(key, value, comment, false);
     }
 
 
@@ -118,10 +119,8 @@ public:
     */
     void create_commentary_card(std::string const& key, std::string const& value)
     {
-        if (this->is_key_valid(key)) {
-            std::string card_content = key + "  " + value;
-            this->card_ = card_content;
-            this->card_.append(80 - card_content.length(),' ');
+        if (this->is_key_valid(key) && key.length() + 2 + value.length() <= 80) {
+            assign(key + "  " + value);
             return;
         }
 
@@ -135,7 +134,7 @@ public:
     */
     std::string keyword(bool whole = false) const
     {
-        std::string keyword = this->extract_keyword(this->card_);
+        std::string keyword = this->extract_keyword(raw_card());
         if (whole)
         {
             return keyword;
@@ -151,10 +150,7 @@ public:
     template <typename ReturnType>
     ReturnType value() const
     {
-        if (!value_cached()) {
-            card_cache =value_imp(boost::type<ReturnType>());
-        }
-        return boost::get<ReturnType>(card_cache); 
+        return value_imp(boost::type<ReturnType>());
     }
 
     /**
@@ -163,58 +159,109 @@ public:
     */
     std::string value_with_comment() const
     {
-        return boost::algorithm::trim_copy(this->card_.substr(10));
+        return boost::algorithm::trim_copy(raw_card().substr(10).to_string());
+    }
+
+    /**
+     * @brief   Returns the comment associated with the card
+     * @return  Returns a std::string containing the comment ( empty if there is no comment )
+    */
+    std::string comment() const
+    {
+        return comment_of(raw_card()).to_string();
     }
 
     /**
      * @brief       Sets the value of current card
+     * @details     The comment associated with the card is preserved if it still fits in the card
      * @param[in]   value Value to be set.
+     * @throws      invalid_card If the serialized value does not fit in the card
     */
     template<typename DataType>
     void set_value(DataType value)
     {
-        std::string serialized_value = this->serialize_to_fits_format(value);
-
-        if (this->is_card_valid(this->keyword(), serialized_value, "")) { 
-            std::string key = this->keyword(true);
-            this->card_.clear();
-            this->card_.append(key);
-            this->card_.append(serialized_value);
-            card_cache = value;
-        }
+        // keyword and comment are views into the copy as the card is overwritten
+        std::array<char, 80> original = this->card_;
+        boost::string_view original_card(original.data(), original.size());
+
+        create_card_impl(trim_view(original_card.substr(0, 8)), value, comment_of(original_card), true);
     }
 
     /**
-     * @brief   Returns the complete card as string
+     * @brief   Returns the complete card ( all 80 characters )
     */
-    const std::string& raw_card() { return card_; }
+    boost::string_view raw_card() const { return boost::string_view(card_.data(), card_.size()); }
 
 private:
     /**
-     * @brief Checks if the value is internally cached
+     * @brief Copies the content into the card and fills the rest of the card with blanks
     */
-    bool value_cached() const { return card_cache.which() != 0; }
+    void assign(boost::string_view content) {
+        auto last = std::copy(content.begin(), content.end(), this->card_.begin());
+        std::fill(last, this->card_.end(), ' ');
+    }
 
 
     /**
-     * @brief Creates a card from key, value and comment supplied to the method
+     * @brief   Creates a card from key, value and comment supplied to the method
+     * @details The value is serialized directly into the card, so no temporary strings are created
+     * @param[in] drop_comment Whether a comment which does not fit should be dropped instead of throwing
     */
-    void create_card_impl(const std::string& key, const std::string& value, const std::string& comment="") {
+    template<typename Value>
+    void create_card_impl(boost::string_view key, Value const& value, boost::string_view comment, bool drop_comment) {
+        if (!this->is_key_valid(key)) {
+            throw invalid_card();
+        }
+
+        std::array<char, 80> new_card;
+        new_card.fill(' ');
+        std::copy(key.begin(), key.end(), new_card.begin());
+        new_card[8] = '=';
 
-        if (this->is_card_valid(key, value, comment)) {
+        std::size_t value_end = 10 + this->serialize_to_fits_format(value, new_card.data() + 10, 70);
 
-            if (comment.empty()) {
-                this->card_ = this->format_keyword(key) + "= " + value;
+        if (!comment.empty()) {
+            if (value_end + 2 + comment.length() <= 80) {
+                new_card[value_end + 1] = '/';
+                std::copy(comment.begin(), comment.end(), new_card.begin() + value_end + 2);
             }
-            else {
-                this->card_ = this->format_keyword(key) +"= "+value + " /" + comment;
+            else if (!drop_comment) {
+                throw invalid_card();
             }
+        }
 
-            this->card_.append(80 - this->card_.length(), ' ');
-            return;
+        this->card_ = new_card;
+    }
+
+    /**
+     * @brief Returns the comment of the card ( without the leading and trailing blanks )
+    */
+    static boost::string_view comment_of(boost::string_view fits_card) {
+        std::size_t pos = 10;
+        while (pos < fits_card.length() && fits_card[pos] == ' ') { pos++; }
+
+        // Skip the quoted string values as they may contain '/'
+        if (pos < fits_card.length() && fits_card[pos] == '\'') {
+            for (pos++; pos < fits_card.length(); pos++) {
+                if (fits_card[pos] == '\'') {
+                    if (pos + 1 < fits_card.length() && fits_card[pos + 1] == '\'') { pos++; }
+                    else { break; }
+                }
+            }
         }
 
-        throw invalid_card();
+        auto comment_start = fits_card.find('/', pos);
+        if (comment_start == boost::string_view::npos) { return boost::string_view(); }
+        return trim_view(fits_card.substr(comment_start + 1));
+    }
+
+    /**
+     * @brief Removes the leading and trailing blanks without copying
+    */
+    static boost::string_view trim_view(boost::string_view text) {
+        auto first = text.find_first_not_of(' ');
+        if (first == boost::string_view::npos) { return boost::string_view(); }
+        return text.substr(first, text.find_last_not_of(' ') - first + 1);
     }
 
     /**
@@ -225,7 +272,7 @@ private:
     template <typename ReturnType>
     ReturnType value_imp(boost::type<ReturnType>) const
     {
-        std::string val = boost::algorithm::trim_copy(this->extract_value(this->card_));
+        std::string val = boost::algorithm::trim_copy(this->extract_value(raw_card()));
         return this->template parse_to<ReturnType>(val);
     }
 
@@ -234,7 +281,7 @@ private:
      * @return  string value
     */
     std::string value_imp(boost::type<std::string>) const {
-        std::string val = boost::algorithm::trim_copy(this->extract_value(this->card_));
+        std::string val = boost::algorithm::trim_copy(this->extract_value(raw_card()));
         if (val[0] == '\'') {
             return boost::algorithm::trim_copy(std::string(val.begin() + 1, val.end() - 1));
         }
@@ -282,6 +282,30 @@ public:
 
 };
 
+/**
+ * @brief   Handle to a column of a table resolved once from the column name
+ * @details Refers to the column by its position, so columns, their views and metadata are reached
+ *          without comparing or hashing names. A handle is only meaningful for the table it was obtained from
+*/
+class column_id
+{
+    std::size_t position_;
+
+public:
+    /**
+     * @brief       Creates a handle to the column at given position ( 0 based )
+    */
+    explicit column_id(std::size_t position) :position_(position) {}
+
+    /**
+     * @brief       Returns the position ( 0 based ) of the column in the table
+    */
+    std::size_t position() const { return position_; }
+
+    bool operator==(column_id other) const { return position_ == other.position_; }
+    bool operator!=(column_id other) const { return position_ != other.position_; }
+};
+
 }}}
 
 #endif // !BOOST_ASTRONOMY_IO_COLUMN_HPP
@@ -14,8 +14,12 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include <vector>
 #include <unordered_map>
 #include <sstream>
+#include <type_traits>
 #include <boost/static_assert.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/variant/static_visitor.hpp>
 #include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
 
 namespace boost { namespace astronomy { namespace io {
 
@@ -146,7 +150,7 @@ public:
     */
     void update_value(int row, DataType new_value){
         cached_index[row] = new_value;
-        (*table_ref)[row][this->index()-1] = Converter::serialize(new_value);
+        (*table_ref)[row][this->index()-1] = Converter::serialize_field(new_value, this->TFORM());
     }
 
    /**
@@ -168,6 +172,71 @@ public:
 
 };
 
+/**
+ * @brief Visitor used for updating a field through the cached column views of a table
+ * @details Numbers stored in integer columns are checked against the range of the column, and a single number
+ *          cannot update a complex, vector or text column
+ * @tparam DataType Type of the value supplied for the update
+ * @throws invalid_cast If the value cannot be stored in the column
+*/
+template<typename DataType>
+struct column_update_visitor : public boost::static_visitor<> {
+
+    int row;
+    const DataType& value;
+
+    column_update_visitor(int row_number, const DataType& new_value) :row(row_number), value(new_value) {}
+
+    template<typename ViewDataType, typename Converter>
+    void operator()(column_view<ViewDataType, Converter>& view) const {
+        update(view, std::is_convertible<DataType, ViewDataType>());
+    }
+
+private:
+    struct same_kind {};        //! Value of the type of the column, or a value that is not a number
+    struct integer_column {};   //! Number stored in an integer column
+    struct real_column {};      //! Number stored in a floating point column
+    struct other_column {};     //! Number stored in a complex, vector or text column
+
+    template<typename ViewDataType>
+    using conversion = typename std::conditional<
+        std::is_same<DataType, ViewDataType>::value || !std::is_arithmetic<DataType>::value, same_kind,
+        typename std::conditional<std::is_integral<ViewDataType>::value, integer_column,
+        typename std::conditional<std::is_floating_point<ViewDataType>::value, real_column,
+        other_column>::type>::type>::type;
+
+    template<typename ViewDataType, typename Converter>
+    void update(column_view<ViewDataType, Converter>& view, std::true_type) const {
+        view.update_value(row, convert<ViewDataType>(conversion<ViewDataType>()));
+    }
+
+    template<typename ViewDataType, typename Converter>
+    void update(column_view<ViewDataType, Converter>&, std::false_type) const {
+        throw boost::astronomy::invalid_cast("Value type does not match the type of column view");
+    }
+
+    template<typename ViewDataType>
+    ViewDataType convert(same_kind) const { return static_cast<ViewDataType>(value); }
+
+    template<typename ViewDataType>
+    ViewDataType convert(integer_column) const {
+        try {
+            return boost::numeric_cast<ViewDataType>(value);
+        }
+        catch (boost::numeric::bad_numeric_cast const&) {
+            throw boost::astronomy::invalid_cast("Value lies outside the range of the column");
+        }
+    }
+
+    template<typename ViewDataType>
+    ViewDataType convert(real_column) const { return static_cast<ViewDataType>(value); }
+
+    template<typename ViewDataType>
+    ViewDataType convert(other_column) const {
+        throw boost::astronomy::invalid_cast("A single number cannot update a complex, vector or text column");
+    }
+};
+
 }}}
 
 #endif // !BOOST_ASTRONOMY_IO_COLUMN_DATA_HPP
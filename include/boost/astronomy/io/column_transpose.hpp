@@ -0,0 +1,204 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_COLUMN_TRANSPOSE_HPP
+#define BOOST_ASTRONOMY_IO_COLUMN_TRANSPOSE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <boost/align/aligned_alloc.hpp>
+#include <boost/align/aligned_delete.hpp>
+#include <boost/endian/conversion.hpp>
+
+#include <boost/astronomy/io/binary_field_layout.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/io/parallel.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief   Values of a single binary table column stored contiguously in native byte order
+ * @details The fields of consecutive rows follow each other without any padding and the start of the data is
+ *          aligned to cache line boundary, so the column can be scanned directly with SIMD loads
+*/
+class aligned_column {
+    std::unique_ptr<char, boost::alignment::aligned_delete> buffer;
+    std::string name_;
+    std::string format_;
+    std::size_t rows_;
+    std::size_t field_width_;
+
+public:
+    /**
+     * @brief Alignment in bytes of the start of the column data
+    */
+    static constexpr std::size_t alignment() { return 64; }
+
+    /**
+     * @brief Allocates uninitialized storage for rows fields of field_width bytes
+     * @throws std::bad_alloc If the storage cannot be allocated
+    */
+    aligned_column(std::string const& name, std::string const& format, std::size_t rows, std::size_t field_width)
+        :buffer(static_cast<char*>(boost::alignment::aligned_alloc(alignment(), std::max<std::size_t>(rows * field_width, 1)))),
+        name_(name), format_(format), rows_(rows), field_width_(field_width) {
+        if (!buffer) { throw std::bad_alloc(); }
+    }
+
+    /**
+     * @brief Returns the name ( TTYPE ) of the column
+    */
+    std::string const& name() const { return name_; }
+
+    /**
+     * @brief Returns the format ( TFORM ) of the column
+    */
+    std::string const& format() const { return format_; }
+
+    /**
+     * @brief Returns the number of rows in the column
+    */
+    std::size_t rows() const { return rows_; }
+
+    /**
+     * @brief Returns the width of a single field in bytes
+    */
+    std::size_t field_width() const { return field_width_; }
+
+    /**
+     * @brief Returns the total size of the column data in bytes
+    */
+    std::size_t size() const { return rows_ * field_width_; }
+
+    char* bytes() { return buffer.get(); }
+    const char* bytes() const { return buffer.get(); }
+
+    /**
+     * @brief Returns the column data as an array of T ( e.g float for E and 10E, std::complex<float> for C )
+     * @details A field holding a vector occupies field_width() / sizeof(T) consecutive elements
+    */
+    template<typename T>
+    const T* data() const { return reinterpret_cast<const T*>(buffer.get()); }
+};
+
+namespace detail {
+
+    /**
+     * @brief Copies a field of every row in the block converting each element of it to native byte order
+    */
+    template<typename Unsigned>
+    inline void copy_swapped(const char* source, std::size_t row_width, char* destination,
+        std::size_t rows, std::size_t elements) {
+        for (std::size_t row = 0; row < rows; row++) {
+            const char* field = source + row * row_width;
+            for (std::size_t i = 0; i < elements; i++) {
+                Unsigned value;
+                std::memcpy(&value, field + i * sizeof(Unsigned), sizeof(Unsigned));
+                boost::endian::big_to_native_inplace(value);
+                std::memcpy(destination, &value, sizeof(Unsigned));
+                destination += sizeof(Unsigned);
+            }
+        }
+    }
+
+    /**
+     * @brief Copies a field of every row in the block that does not need byte swapping
+    */
+    inline void copy_unswapped(const char* source, std::size_t row_width, char* destination,
+        std::size_t rows, std::size_t width) {
+        for (std::size_t row = 0; row < rows; row++) {
+            std::memcpy(destination + row * width, source + row * row_width, width);
+        }
+    }
+}
+
+/**
+ * @brief   Transposes the row major data unit of a binary table into one aligned native column per field
+ * @details Rows are processed in blocks small enough to stay in cache while all the columns are extracted from
+ *          them, so the data unit is read from memory only once and every column is written sequentially.
+ *          Blocks are distributed among the threads
+ * @param[in] data Start of the data unit
+ * @param[in] rows Number of rows ( NAXIS2 )
+ * @param[in] row_width Width of a row in bytes ( NAXIS1 )
+ * @param[in] columns Metadata of the columns to be extracted ( TBCOL holds the offset of the field in the row )
+ * @param[in] threads Number of threads to use ( 0 uses the number of hardware threads )
+ * @param[in] block_rows Number of rows in a block ( 0 chooses the block so that it occupies about 32KB )
+ * @return The columns in the same order as columns
+ * @throws invalid_table_colum_format If a column has an invalid format or does not fit in the row
+*/
+inline std::vector<aligned_column> transpose_columns(const char* data, std::size_t rows, std::size_t row_width,
+    std::vector<column> const& columns, std::size_t threads = 0, std::size_t block_rows = 0) {
+
+    std::vector<binary_field_layout> layouts;
+    std::vector<aligned_column> transposed;
+    layouts.reserve(columns.size());
+    transposed.reserve(columns.size());
+    for (auto const& metadata : columns) {
+        layouts.push_back(make_binary_field_layout(metadata));
+        if (layouts.back().offset + layouts.back().width > row_width) {
+            throw invalid_table_colum_format();
+        }
+        transposed.emplace_back(metadata.TTYPE(), metadata.TFORM(), rows, layouts.back().width);
+    }
+
+    if (block_rows == 0) { block_rows = std::max<std::size_t>(1, 32768 / std::max<std::size_t>(row_width, 1)); }
+    std::size_t total_blocks = (rows + block_rows - 1) / block_rows;
+
+    detail::run_parallel(total_blocks, threads, [&](std::size_t block) {
+        std::size_t first_row = block * block_rows;
+        std::size_t block_size = std::min(block_rows, rows - first_row);
+        const char* block_start = data + first_row * row_width;
+
+        for (std::size_t col = 0; col < layouts.size(); col++) {
+            binary_field_layout const& layout = layouts[col];
+            const char* source = block_start + layout.offset;
+            char* destination = transposed[col].bytes() + first_row * layout.width;
+            std::size_t elements = layout.width / layout.element_size;
+
+            switch (layout.element_size) {
+            case 2: detail::copy_swapped<std::uint16_t>(source, row_width, destination, block_size, elements); break;
+            case 4: detail::copy_swapped<std::uint32_t>(source, row_width, destination, block_size, elements); break;
+            case 8: detail::copy_swapped<std::uint64_t>(source, row_width, destination, block_size, elements); break;
+            default: detail::copy_unswapped(source, row_width, destination, block_size, layout.width); break;
+            }
+        }
+    });
+
+    return transposed;
+}
+
+/**
+ * @brief Transposes the data unit of a binary table into one aligned native column per field
+ * @param[in] table Binary table providing the layout of the rows
+ * @param[in] data_buffer Data unit of the binary table
+ * @param[in] threads Number of threads to use ( 0 uses the number of hardware threads )
+ * @throws file_reading_exception If the data unit is smaller than the table described by the header
+ * @throws invalid_table_colum_format If a column has an invalid format or does not fit in the row
+*/
+template<typename CardPolicy, typename Converter>
+std::vector<aligned_column> transpose_columns(basic_binary_table_extension<CardPolicy, Converter> const& table,
+    std::string const& data_buffer, std::size_t threads = 0) {
+
+    std::size_t rows = table.get_header().naxis(2);
+    std::size_t row_width = table.get_header().naxis(1);
+    if (data_buffer.size() < rows * row_width) {
+        throw file_reading_exception("Data unit is smaller than the table described by the header");
+    }
+    return transpose_columns(data_buffer.data(), rows, row_width, table.get_all_column_metadata(), threads);
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_COLUMN_TRANSPOSE_HPP
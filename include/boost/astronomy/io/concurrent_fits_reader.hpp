@@ -0,0 +1,216 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_CONCURRENT_FITS_READER_HPP
+#define BOOST_ASTRONOMY_IO_CONCURRENT_FITS_READER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/astronomy/io/positional_file.hpp>
+#include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/io/default_hdus.hpp>
+#include <boost/astronomy/io/default_card_policy.hpp>
+#include <boost/astronomy/io/binary_data_converter.hpp>
+#include <boost/astronomy/io/string_conversion_utility.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief   Reader of a FITS file which can be shared by any number of threads
+ * @details The headers are read once when the reader is created. The data of an HDU is read with positional
+ *          reads and decoded the first time it is requested, after which the decoded HDU is immutable and shared
+ *          by every thread. Fetching an HDU that was already decoded costs a single atomic load, no locks are taken.
+ *          Only the first request of an HDU synchronizes: one thread decodes it while the other threads requesting
+ *          the same HDU wait for it, so no HDU is decoded twice
+ * @tparam  ExtensionsSupported Contains the list of extensions along with their construction methods
+ * @note    Unlike fits_io the HDUs cannot be modified or written, use fits_io for updating a file
+*/
+template<typename ExtensionsSupported>
+class basic_concurrent_fits_reader {
+public:
+    typedef typename ExtensionsSupported::Extension extension_type;
+    typedef typename ExtensionsSupported::header_type header_type;
+
+private:
+    struct hdu_entry {
+        header_type hdu_header;
+        std::size_t header_location;
+        std::size_t data_location;
+        std::size_t data_size;      // Bytes decoded into the HDU
+        std::size_t data_unit_size; // Bytes of the data unit excluding the padding
+    };
+
+    positional_file file;
+    std::vector<hdu_entry> hdus;
+    std::map<std::string, std::size_t> hdu_names;
+    std::unique_ptr<std::atomic<const extension_type*>[]> decoded;
+    std::unique_ptr<std::once_flag[]> decode_once;
+
+public:
+    /**
+     * @brief Opens the file and reads the headers of all HDUs
+     * @param[in] path Location of the file
+     * @throws file_reading_exception If the file cannot be opened
+     * @throws fits_exception If the file ends before the END card of a header
+    */
+    explicit basic_concurrent_fits_reader(const std::string& path) :file(path) {
+        positional_cursor cursor(file);
+        while (!cursor.at_end()) {
+            hdu_entry entry;
+            entry.header_location = cursor.get_current_pos();
+            entry.hdu_header.read_header(cursor);
+            entry.data_location = cursor.get_current_pos();
+            entry.data_size = entry.hdu_header.data_size() == 0 ? 0 :
+                entry.hdu_header.data_size() * get_element_size_from_bitpix(entry.hdu_header.bitpix());
+            entry.data_unit_size = entry.hdu_header.data_unit_size();
+
+            cursor.set_reading_pos(entry.data_location + entry.data_unit_size);
+            cursor.set_unit_end();
+            hdu_names[entry.hdu_header.get_hdu_name()] = hdus.size();
+            hdus.push_back(std::move(entry));
+        }
+
+        decoded.reset(new std::atomic<const extension_type*>[hdus.size()]);
+        decode_once.reset(new std::once_flag[hdus.size()]);
+        for (std::size_t index = 0; index < hdus.size(); index++) {
+            decoded[index].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    basic_concurrent_fits_reader(const basic_concurrent_fits_reader&) = delete;
+    basic_concurrent_fits_reader& operator=(const basic_concurrent_fits_reader&) = delete;
+    basic_concurrent_fits_reader(basic_concurrent_fits_reader&&) = default;
+
+    ~basic_concurrent_fits_reader() {
+        if (!decoded) { return; }
+        for (std::size_t index = 0; index < hdus.size(); index++) {
+            delete decoded[index].load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Returns the number of HDUs in the file
+    */
+    std::size_t total_hdus() const { return hdus.size(); }
+
+    /**
+     * @brief Returns the header of the HDU at given index
+     * @throws std::out_of_range If there is no HDU at index
+    */
+    const header_type& get_header(std::size_t index) const { return hdus.at(index).hdu_header; }
+
+    /**
+     * @brief Returns the index of the HDU named hdu_name ( the last one if several HDUs share the name )
+     * @throws std::out_of_range If no HDU has the name
+    */
+    std::size_t index_of(const std::string& hdu_name) const { return hdu_names.at(hdu_name); }
+
+    /**
+     * @brief Returns the offset of the data unit of the HDU at given index in the file
+     * @throws std::out_of_range If there is no HDU at index
+    */
+    std::size_t data_location(std::size_t index) const { return hdus.at(index).data_location; }
+
+    /**
+     * @brief Returns the decoded HDU at given index, reading and decoding it on the first request
+     * @throws std::out_of_range If there is no HDU at index
+     * @throws file_reading_exception If the data unit cannot be read completely
+    */
+    const extension_type& operator[](std::size_t index) const {
+        const hdu_entry& entry = hdus.at(index);
+        const extension_type* hdu = decoded[index].load(std::memory_order_acquire);
+        if (hdu != nullptr) { return *hdu; }
+
+        // An exception leaves the HDU undecoded, so a later request tries again
+        std::call_once(decode_once[index], [this, &entry, index]() {
+            decoded[index].store(decode(entry), std::memory_order_release);
+        });
+        return *decoded[index].load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns the decoded HDU named hdu_name ( the last one if several HDUs share the name )
+     * @throws std::out_of_range If no HDU has the name
+    */
+    const extension_type& operator[](const std::string& hdu_name) const {
+        return (*this)[index_of(hdu_name)];
+    }
+
+    /**
+     * @brief Returns whether the HDU at given index has been decoded
+    */
+    bool is_decoded(std::size_t index) const {
+        return index < hdus.size() && decoded[index].load(std::memory_order_acquire) != nullptr;
+    }
+
+    /**
+     * @brief Reads a region of the data unit of an HDU without decoding the HDU
+     * @param[in] index Index of the HDU
+     * @param[in] offset Offset of the region from the start of the data unit
+     * @param[out] buffer Destination of the region
+     * @param[in] num_bytes Size of the region
+     * @throws std::out_of_range If there is no HDU at index or the region exceeds the data unit
+     * @throws file_reading_exception If the region cannot be read completely
+    */
+    void read_region(std::size_t index, std::size_t offset, char* buffer, std::size_t num_bytes) const {
+        const hdu_entry& entry = hdus.at(index);
+        if (offset > entry.data_unit_size || num_bytes > entry.data_unit_size - offset) {
+            throw std::out_of_range("Region exceeds the data unit of the HDU");
+        }
+        if (file.read_at(entry.data_location + offset, buffer, num_bytes) != num_bytes) {
+            throw file_reading_exception("Cannot read the region of the data unit");
+        }
+    }
+
+    /**
+     * @brief Reads a region of the data unit of an HDU as a string without decoding the HDU
+     * @param[in] index Index of the HDU
+     * @param[in] offset Offset of the region from the start of the data unit
+     * @param[in] num_bytes Size of the region
+     * @throws std::out_of_range If there is no HDU at index or the region exceeds the data unit
+     * @throws file_reading_exception If the region cannot be read completely
+    */
+    std::string read_region(std::size_t index, std::size_t offset, std::size_t num_bytes) const {
+        std::string region(num_bytes, ' ');
+        if (num_bytes != 0) { read_region(index, offset, &region[0], num_bytes); }
+        return region;
+    }
+
+private:
+    /**
+     * @brief Reads the data of an HDU and constructs it from a copy of the header
+    */
+    extension_type* decode(const hdu_entry& entry) const {
+        std::string hdu_data;
+        if (entry.data_size != 0) {
+            hdu_data = file.read_at(entry.data_location, entry.data_size);
+            if (hdu_data.size() != entry.data_size) {
+                throw file_reading_exception("Cannot read the data unit of the HDU");
+            }
+        }
+        header_type hdu_header = entry.hdu_header;
+        return new extension_type(ExtensionsSupported::construct_hdu(hdu_header, hdu_data));
+    }
+};
+
+/**
+ * @brief Concurrent reader supporting the default HDUs ( see default_hdus.hpp )
+*/
+using concurrent_fits_reader = basic_concurrent_fits_reader<
+    default_hdu_manager<card_policy, ascii_converter, binary_data_converter>>;
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_CONCURRENT_FITS_READER_HPP
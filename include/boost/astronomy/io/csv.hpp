@@ -0,0 +1,876 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_CSV_HPP
+#define BOOST_ASTRONOMY_IO_CSV_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <boost/astronomy/io/ascii_table.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/binary_table_writer.hpp>
+#include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/io/column_transpose.hpp>
+#include <boost/astronomy/io/string_conversion_utility.hpp>
+#include <boost/astronomy/io/table_field.hpp>
+#include <boost/astronomy/io/table_schema.hpp>
+#include <boost/astronomy/io/parallel.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief   Options of CSV ( or TSV ) export and import
+ * @details The memory used by the writer is about 2 * threads * chunk_rows formatted rows and by the reader about
+ *          block_size bytes of text plus the rows parsed from them
+*/
+struct csv_options {
+    char delimiter = ',';               //! Separator of the fields ( '\t' for TSV )
+    bool header = true;                 //! Whether the first line holds the names of the columns
+    std::size_t chunk_rows = 16384;     //! Number of rows formatted or parsed by a thread at a time
+    std::size_t block_size = 1 << 22;   //! Number of bytes of text read at a time when importing
+    std::size_t threads = 0;            //! Number of threads to use ( 0 uses the number of hardware threads )
+};
+
+/**
+ * @brief   Describes how a column of a FITS table is written to and read from CSV
+ * @details Elements of vector and complex fields are separated by a blank, bit arrays are written as a string of
+ *          0 and 1 and logicals as T or F. Undefined logicals, NaN and values equal to TNULL are written as empty
+ *          fields ( or empty elements )
+*/
+typedef table_field csv_field;
+
+namespace detail {
+
+    /**
+     * @brief Appends text as a CSV field, quoting it if it contains the delimiter, quotes or line breaks
+    */
+    inline void append_csv_text(std::string& out, const char* text, std::size_t length, char delimiter) {
+        bool quote = false;
+        for (std::size_t i = 0; i < length && !quote; i++) {
+            quote = text[i] == delimiter || text[i] == '"' || text[i] == '\n' || text[i] == '\r';
+        }
+        if (!quote) {
+            out.append(text, length);
+            return;
+        }
+
+        out.push_back('"');
+        for (std::size_t i = 0; i < length; i++) {
+            if (text[i] == '"') { out.push_back('"'); }
+            out.push_back(text[i]);
+        }
+        out.push_back('"');
+    }
+
+    template<typename Integer>
+    inline void append_csv_integer(std::string& out, Integer value, csv_field const& field) {
+        if (field.has_null && static_cast<long long>(value) == field.null_value) { return; }
+
+        char buffer[number_formatter::max_length];
+        out.append(buffer, number_formatter::format(value, buffer));
+    }
+
+    template<typename Real>
+    inline void append_csv_real(std::string& out, Real value) {
+        if (std::isnan(value)) { return; }
+
+        char buffer[number_formatter::max_length];
+        out.append(buffer, number_formatter::format(value, buffer));
+    }
+
+    inline void append_binary_element(std::string& out, const char* element, csv_field const& field) {
+        switch (field.type) {
+        case 'L':
+            if (*element == 'T' || *element == 'F') { out.push_back(*element); }
+            break;
+        case 'B': append_csv_integer(out, static_cast<std::uint8_t>(*element), field); break;
+        case 'I': append_csv_integer(out, load_big_endian<std::int16_t, std::uint16_t>(element), field); break;
+        case 'J': append_csv_integer(out, load_big_endian<std::int32_t, std::uint32_t>(element), field); break;
+        case 'K': append_csv_integer(out, load_big_endian<std::int64_t, std::uint64_t>(element), field); break;
+        case 'E': case 'C': append_csv_real(out, load_big_endian<float, std::uint32_t>(element)); break;
+        case 'D': case 'M': append_csv_real(out, load_big_endian<double, std::uint64_t>(element)); break;
+        default: break;
+        }
+    }
+
+    inline void append_binary_field(std::string& out, const char* row, csv_field const& field, char delimiter) {
+        const char* data = row + field.offset;
+        if (field.type == 'A') {
+            std::size_t length = field.width;
+            while (length > 0 && (data[length - 1] == ' ' || data[length - 1] == '\0')) { length--; }
+            append_csv_text(out, data, length, delimiter);
+            return;
+        }
+        if (field.type == 'X') {
+            for (std::size_t bit = 0; bit < field.elements; bit++) {
+                out.push_back((static_cast<unsigned char>(data[bit / 8]) >> (7 - bit % 8)) & 1 ? '1' : '0');
+            }
+            return;
+        }
+
+        for (std::size_t element = 0; element < field.elements; element++) {
+            if (element != 0) { out.push_back(' '); }
+            append_binary_element(out, data + element * field.element_size, field);
+        }
+    }
+
+    /**
+     * @brief Appends an ASCII table field without converting it ( D exponents of reals are written as E )
+    */
+    inline void append_ascii_field(std::string& out, const char* row, csv_field const& field, char delimiter) {
+        const char* first = row + field.offset;
+        const char* last = first + field.width;
+        while (last != first && (*(last - 1) == ' ' || *(last - 1) == '\0')) { last--; }
+        if (field.type != 'A') {
+            while (first != last && *first == ' ') { first++; }
+        }
+
+        std::size_t length = static_cast<std::size_t>(last - first);
+        if (field.has_null && length == field.ascii_null.size() &&
+            std::memcmp(first, field.ascii_null.data(), length) == 0) {
+            return;
+        }
+
+        if (field.type == 'A') {
+            append_csv_text(out, first, length, delimiter);
+            return;
+        }
+        for (; first != last; first++) {
+            out.push_back(*first == 'D' ? 'E' : *first);
+        }
+    }
+
+    /**
+     * @brief Appends count consecutive rows of the data unit as CSV lines
+    */
+    inline void format_csv_rows(std::string& out, const char* data, std::size_t count, std::size_t row_width,
+        std::vector<csv_field> const& fields, char delimiter) {
+
+        for (std::size_t row = 0; row < count; row++) {
+            const char* row_start = data + row * row_width;
+            for (std::size_t i = 0; i < fields.size(); i++) {
+                if (i != 0) { out.push_back(delimiter); }
+                if (fields[i].ascii) {
+                    append_ascii_field(out, row_start, fields[i], delimiter);
+                }
+                else {
+                    append_binary_field(out, row_start, fields[i], delimiter);
+                }
+            }
+            out.push_back('\n');
+        }
+    }
+
+    /**
+     * @brief   Calls field(index, first, last) for every field of a CSV record
+     * @details Quoted fields are passed without their quotes. Only fields containing escaped quotes are copied
+     *          ( into scratch ), every other field points into the record
+     * @return  Number of fields in the record
+     * @throws  invalid_cast If a quoted field is not terminated or is followed by anything but the delimiter
+    */
+    template<typename Field>
+    inline std::size_t for_each_csv_field(const char* first, const char* last, char delimiter, std::string& scratch,
+        Field const& field) {
+
+        std::size_t index = 0;
+        const char* cursor = first;
+        while (true) {
+            const char* value_first = cursor;
+            const char* value_last = cursor;
+            if (cursor != last && *cursor == '"') {
+                const char* closing = cursor + 1;
+                bool escaped = false;
+                while (true) {
+                    closing = std::find(closing, last, '"');
+                    if (closing == last) { throw invalid_cast("Quoted field is not terminated"); }
+                    if (closing + 1 == last || *(closing + 1) != '"') { break; }
+                    escaped = true;
+                    closing += 2;
+                }
+
+                value_first = cursor + 1;
+                value_last = closing;
+                if (escaped) {
+                    scratch.clear();
+                    for (const char* p = value_first; p != value_last; p++) {
+                        scratch.push_back(*p);
+                        if (*p == '"') { p++; }
+                    }
+                    value_first = scratch.data();
+                    value_last = scratch.data() + scratch.size();
+                }
+
+                cursor = closing + 1;
+                if (cursor != last && *cursor != delimiter) {
+                    throw invalid_cast("Quoted field is followed by characters other than the delimiter");
+                }
+            }
+            else {
+                cursor = std::find(cursor, last, delimiter);
+                value_last = cursor;
+            }
+
+            field(index++, value_first, value_last);
+            if (cursor == last) { return index; }
+            cursor++;
+        }
+    }
+
+    inline void trim_csv_value(const char*& first, const char*& last) {
+        while (first != last && *first == ' ') { first++; }
+        while (last != first && *(last - 1) == ' ') { last--; }
+    }
+
+    inline bool equals_ignoring_case(const char* first, const char* last, const char* word) {
+        std::size_t length = std::strlen(word);
+        if (static_cast<std::size_t>(last - first) != length) { return false; }
+        for (std::size_t i = 0; i < length; i++) {
+            char c = first[i];
+            if (c >= 'A' && c <= 'Z') { c = static_cast<char>(c - 'A' + 'a'); }
+            if (c != word[i]) { return false; }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Parses T, F, true, false, 1 or 0 ( an empty value is an undefined logical )
+    */
+    inline bool parse_csv_logical(const char* first, const char* last, char& value) {
+        trim_csv_value(first, last);
+        if (first == last) {
+            value = '\0';
+            return true;
+        }
+        if (equals_ignoring_case(first, last, "t") || equals_ignoring_case(first, last, "true") ||
+            equals_ignoring_case(first, last, "1")) {
+            value = 'T';
+            return true;
+        }
+        if (equals_ignoring_case(first, last, "f") || equals_ignoring_case(first, last, "false") ||
+            equals_ignoring_case(first, last, "0")) {
+            value = 'F';
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Parses an integer that must fit in T and stores it in big endian byte order ( empty values become 0 )
+    */
+    template<typename T, typename Bits>
+    inline bool parse_csv_integer(const char* first, const char* last, char* element) {
+        trim_csv_value(first, last);
+        long long value = 0;
+        if (first != last) {
+            if (!number_parser::parse(first, last, value)) { return false; }
+            if (value < static_cast<long long>(std::numeric_limits<T>::min()) ||
+                value > static_cast<long long>(std::numeric_limits<T>::max())) {
+                return false;
+            }
+        }
+        store_big_endian<T, Bits>(static_cast<T>(value), element);
+        return true;
+    }
+
+    /**
+     * @brief Parses a real and stores it in big endian byte order ( empty values become NaN )
+    */
+    template<typename T, typename Bits>
+    inline bool parse_csv_real(const char* first, const char* last, char* element) {
+        trim_csv_value(first, last);
+        double value = std::numeric_limits<double>::quiet_NaN();
+        if (first != last && !number_parser::parse(first, last, value)) { return false; }
+        store_big_endian<T, Bits>(static_cast<T>(value), element);
+        return true;
+    }
+
+    inline bool parse_csv_element(const char* first, const char* last, char* element, csv_field const& field) {
+        switch (field.type) {
+        case 'L': return parse_csv_logical(first, last, *element);
+        case 'B': return parse_csv_integer<std::uint8_t, std::uint8_t>(first, last, element);
+        case 'I': return parse_csv_integer<std::int16_t, std::uint16_t>(first, last, element);
+        case 'J': return parse_csv_integer<std::int32_t, std::uint32_t>(first, last, element);
+        case 'K': return parse_csv_integer<std::int64_t, std::uint64_t>(first, last, element);
+        case 'E': case 'C': return parse_csv_real<float, std::uint32_t>(first, last, element);
+        case 'D': case 'M': return parse_csv_real<double, std::uint64_t>(first, last, element);
+        default: return false;
+        }
+    }
+
+    /**
+     * @brief Encodes the text of a CSV field into its binary table field ( strings longer than the field are cut )
+     * @return Whether the text could be converted
+    */
+    inline bool parse_csv_field(const char* first, const char* last, char* row, csv_field const& field) {
+        char* data = row + field.offset;
+        if (field.type == 'A') {
+            std::size_t length = std::min(static_cast<std::size_t>(last - first), field.width);
+            std::memcpy(data, first, length);
+            std::memset(data + length, ' ', field.width - length);
+            return true;
+        }
+        if (field.type == 'X') {
+            trim_csv_value(first, last);
+            if (static_cast<std::size_t>(last - first) > field.elements) { return false; }
+            std::memset(data, 0, field.width);
+            for (std::size_t bit = 0; first != last; first++, bit++) {
+                if (*first == '1') { data[bit / 8] = static_cast<char>(data[bit / 8] | (0x80 >> (bit % 8))); }
+                else if (*first != '0') { return false; }
+            }
+            return true;
+        }
+
+        // An empty field leaves every element undefined, otherwise there must be exactly one value per element
+        bool empty = first == last;
+        for (std::size_t element = 0; element < field.elements; element++) {
+            const char* element_last = last;
+            if (!empty && element + 1 < field.elements) {
+                element_last = std::find(first, last, ' ');
+                if (element_last == last) { return false; }
+            }
+            if (!parse_csv_element(first, element_last, data + element * field.element_size, field)) { return false; }
+            if (!empty && element + 1 < field.elements) { first = element_last + 1; }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Encodes a CSV record as a row of the binary table
+     * @throws invalid_cast If the record does not have a field per column or a field cannot be converted
+    */
+    inline void parse_csv_record(const char* first, const char* last, char* row, std::vector<csv_field> const& fields,
+        char delimiter, std::string& scratch, std::size_t row_number) {
+
+        try {
+            std::size_t count = for_each_csv_field(first, last, delimiter, scratch,
+                [&](std::size_t index, const char* value_first, const char* value_last) {
+                    if (index >= fields.size()) { throw invalid_cast("Row has more fields than the table has columns"); }
+                    if (!parse_csv_field(value_first, value_last, row, fields[index])) {
+                        throw invalid_cast("Cannot convert the value of column " + fields[index].name);
+                    }
+                });
+            if (count != fields.size()) { throw invalid_cast("Row has fewer fields than the table has columns"); }
+        }
+        catch (invalid_cast& e) {
+            throw invalid_cast(std::string(e.what()) + " ( row " + boost::lexical_cast<std::string>(row_number) + " )");
+        }
+    }
+
+    /**
+     * @brief   Reads a CSV file in blocks and splits them into records
+     * @details A block is cut after the last line break that is not inside a quoted field, the rest is kept for the
+     *          next block. Empty lines are skipped and a trailing carriage return is removed from every record
+    */
+    class csv_record_reader {
+        std::ifstream in;
+        std::string buffer;
+        std::size_t consumed;
+
+    public:
+        typedef std::pair<std::size_t, std::size_t> record;
+
+        /**
+         * @throws file_reading_exception If the file cannot be opened
+        */
+        explicit csv_record_reader(std::string const& path) :in(path, std::ios::binary), consumed(0) {
+            if (!in) { throw file_reading_exception("Cannot Open File"); }
+        }
+
+        /**
+         * @brief Start of the text the records point into ( valid until the next call to next_records )
+        */
+        const char* data() const { return buffer.data(); }
+
+        /**
+         * @brief Reads about block_size more bytes and returns the records that are complete
+         * @return Whether any record was found ( false at the end of the file )
+        */
+        bool next_records(std::size_t block_size, std::vector<record>& records) {
+            buffer.erase(0, consumed);
+            consumed = 0;
+            block_size = std::max<std::size_t>(block_size, 1);
+
+            bool end_of_file = false;
+            records.clear();
+            while (records.empty() && !end_of_file) {
+                std::size_t old_size = buffer.size();
+                buffer.resize(old_size + block_size);
+                in.read(&buffer[old_size], static_cast<std::streamsize>(block_size));
+                buffer.resize(old_size + static_cast<std::size_t>(in.gcount()));
+                end_of_file = in.eof();
+                split(end_of_file, records);
+            }
+            return !records.empty();
+        }
+
+    private:
+        void split(bool end_of_file, std::vector<record>& records) {
+            records.clear();
+            const char* text = buffer.data();
+            std::size_t size = buffer.size();
+            std::size_t start = 0;
+            std::size_t position = 0;
+            bool quoted = false;
+
+            while (position < size) {
+                const void* line_break = std::memchr(text + position, '\n', size - position);
+                if (line_break == nullptr) { break; }
+                std::size_t end = static_cast<std::size_t>(static_cast<const char*>(line_break) - text);
+
+                for (const char* quote = static_cast<const char*>(std::memchr(text + position, '"', end - position));
+                    quote != nullptr;
+                    quote = static_cast<const char*>(std::memchr(quote + 1, '"', end - static_cast<std::size_t>(quote + 1 - text)))) {
+                    quoted = !quoted;
+                }
+                if (!quoted) {
+                    add(start, end, records);
+                    start = end + 1;
+                }
+                position = end + 1;
+            }
+            if (end_of_file && start < size) {
+                add(start, size, records);
+                start = size;
+            }
+            consumed = start;
+        }
+
+        void add(std::size_t first, std::size_t last, std::vector<record>& records) const {
+            if (last > first && buffer[last - 1] == '\r') { last--; }
+            if (last > first) { records.emplace_back(first, last); }
+        }
+    };
+
+    /**
+     * @brief Kinds of values seen in a column while inferring the schema of a CSV file
+    */
+    struct csv_column_statistics {
+        bool seen = false;
+        bool logical = true;
+        bool integer = true;
+        bool real = true;
+        long long minimum = 0;
+        long long maximum = 0;
+        std::size_t length = 0;
+
+        void add(const char* first, const char* last) {
+            length = std::max(length, static_cast<std::size_t>(last - first));
+            trim_csv_value(first, last);
+            if (first == last) { return; }
+
+            logical = logical && (equals_ignoring_case(first, last, "t") || equals_ignoring_case(first, last, "f") ||
+                equals_ignoring_case(first, last, "true") || equals_ignoring_case(first, last, "false"));
+
+            long long value = 0;
+            if (integer && number_parser::parse(first, last, value)) {
+                minimum = seen ? std::min(minimum, value) : value;
+                maximum = seen ? std::max(maximum, value) : value;
+            }
+            else {
+                integer = false;
+            }
+
+            double real_value = 0;
+            real = real && number_parser::parse(first, last, real_value);
+            seen = true;
+        }
+
+        /**
+         * @brief Returns L, J or K if every value fits, D for reals and A wide enough for the longest value otherwise
+        */
+        std::string form() const {
+            if (seen && logical) { return "L"; }
+            if (seen && integer) {
+                bool fits_int32 = minimum >= std::numeric_limits<std::int32_t>::min() &&
+                    maximum <= std::numeric_limits<std::int32_t>::max();
+                return fits_int32 ? "J" : "K";
+            }
+            if (seen && real) { return "D"; }
+            return boost::lexical_cast<std::string>(std::max<std::size_t>(length, 1)) + "A";
+        }
+    };
+}
+
+/**
+ * @brief   Writes FITS table rows to a CSV ( or TSV ) file
+ * @details The names of the columns are written when the writer is created. Rows are split into chunks of
+ *          chunk_rows rows which are formatted into text buffers that are reused and then written in order, so the
+ *          memory used does not depend on the size of the table. The threads formatting the chunks live as long as
+ *          the writer, and while they format a round of chunks the calling thread writes the previous round. Numbers are formatted
+ *          without allocating ( see number_formatter ) and ASCII table fields are copied without conversion.
+ *          Stored values are written as they are, TSCAL and TZERO are not applied
+ * @author  agent
+*/
+class csv_table_writer {
+    std::ofstream out;
+    std::vector<csv_field> fields_;
+    csv_options options_;
+    detail::task_pool formatters;
+    std::vector<std::string> chunks;    // Two rounds of chunks, one being formatted while the other is written
+    std::size_t rows_written;
+    bool closed;
+
+public:
+    /**
+     * @brief Creates the file and writes the names of the columns if options.header is set
+     * @param[in] path Location of the file
+     * @param[in] fields Columns to be written ( see make_csv_fields )
+     * @param[in] options Delimiter, header line, chunk size and number of threads
+     * @throws file_writing_exception If the file cannot be created
+    */
+    csv_table_writer(std::string const& path, std::vector<csv_field> const& fields,
+        csv_options const& options = csv_options())
+        :out(path, std::ios::binary | std::ios::trunc), fields_(fields), options_(options), formatters(options.threads),
+        rows_written(0), closed(false) {
+
+        if (!out) { throw file_writing_exception("Cannot Create File"); }
+        options_.chunk_rows = std::max<std::size_t>(options_.chunk_rows, 1);
+        options_.threads = formatters.size();
+        chunks.resize(2 * options_.threads);
+
+        if (options_.header) {
+            std::string names;
+            for (std::size_t i = 0; i < fields_.size(); i++) {
+                if (i != 0) { names.push_back(options_.delimiter); }
+                detail::append_csv_text(names, fields_[i].name.data(), fields_[i].name.size(), options_.delimiter);
+            }
+            names.push_back('\n');
+            write_text(names);
+        }
+    }
+
+    csv_table_writer(csv_table_writer const&) = delete;
+    csv_table_writer& operator=(csv_table_writer const&) = delete;
+
+    /**
+     * @brief Closes the file if it has not been closed yet ( errors are ignored )
+    */
+    ~csv_table_writer() {
+        try { close(); }
+        catch (...) {}
+    }
+
+    /**
+     * @brief Returns the columns written to the file
+    */
+    std::vector<csv_field> const& fields() const { return fields_; }
+
+    /**
+     * @brief Returns the number of rows written so far
+    */
+    std::size_t total_rows() const { return rows_written; }
+
+    /**
+     * @brief Formats count consecutive rows of the data unit and appends them to the file
+     * @param[in] rows Start of the first row
+     * @param[in] count Number of rows
+     * @param[in] row_width Width of a row in bytes ( NAXIS1 )
+     * @throws invalid_table_colum_format If a field does not fit in the row
+     * @throws file_writing_exception If the file cannot be written
+    */
+    void write_rows(const char* rows, std::size_t count, std::size_t row_width) {
+        for (auto const& field : fields_) {
+            if (field.offset + field.width > row_width) { throw invalid_table_colum_format(); }
+        }
+
+        std::size_t chunk_rows = options_.chunk_rows;
+        std::size_t total_chunks = (count + chunk_rows - 1) / chunk_rows;
+        std::size_t round_chunks = options_.threads;
+        std::size_t rounds = (total_chunks + round_chunks - 1) / round_chunks;
+        auto chunks_in = [&](std::size_t round) { return std::min(round_chunks, total_chunks - round * round_chunks); };
+
+        for (std::size_t round = 0; round <= rounds; round++) {
+            if (round < rounds) {
+                formatters.start(chunks_in(round), [=](std::size_t task) {
+                    std::size_t first_row = (round * round_chunks + task) * chunk_rows;
+                    std::string& chunk = chunks[(round % 2) * round_chunks + task];
+                    chunk.clear();
+                    detail::format_csv_rows(chunk, rows + first_row * row_width,
+                        std::min(chunk_rows, count - first_row), row_width, fields_, options_.delimiter);
+                });
+            }
+            if (round > 0) {
+                try {
+                    for (std::size_t task = 0; task < chunks_in(round - 1); task++) {
+                        write_text(chunks[((round - 1) % 2) * round_chunks + task]);
+                    }
+                }
+                catch (...) {
+                    try { formatters.wait(); }
+                    catch (...) {}
+                    throw;
+                }
+            }
+            if (round < rounds) { formatters.wait(); }
+        }
+        rows_written += count;
+    }
+
+    /**
+     * @brief Flushes and closes the file
+     * @throws file_writing_exception If the file cannot be written
+     * @note Calling close more than once has no effect
+    */
+    void close() {
+        if (closed) { return; }
+        closed = true;
+        out.close();
+        if (out.fail()) { throw file_writing_exception("Cannot Write To File"); }
+    }
+
+private:
+    void write_text(std::string const& text) {
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        if (!out) { throw file_writing_exception("Cannot Write To File"); }
+    }
+};
+
+/**
+ * @brief Plans the conversion of every column of a binary table ( TNULL of integer columns marks null values )
+ * @throws invalid_table_colum_format If a column is not supported ( variable length arrays )
+*/
+template<typename CardPolicy, typename Converter>
+std::vector<csv_field> make_csv_fields(basic_binary_table_extension<CardPolicy, Converter> const& table) {
+    return detail::plan_table_fields<csv_field>(table, [](column const& metadata) {
+        return detail::make_binary_table_field(metadata);
+    });
+}
+
+/**
+ * @brief Plans the conversion of every column of an ASCII table ( fields equal to TNULL are written empty )
+ * @throws invalid_table_colum_format If a column format is not supported
+*/
+template<typename CardPolicy, typename Converter>
+std::vector<csv_field> make_csv_fields(basic_ascii_table<CardPolicy, Converter> const& table) {
+    return detail::plan_table_fields<csv_field>(table, [](column const& metadata) {
+        return detail::make_ascii_table_field(metadata,
+            basic_ascii_table<CardPolicy, Converter>::column_size(metadata.TFORM()));
+    });
+}
+
+/**
+ * @brief Exports a table held in memory to a CSV file
+ * @param[in] table Binary or ASCII table providing the layout of the rows
+ * @param[in] data_buffer Data unit of the table
+ * @param[in] path Location of the output file
+ * @param[in] options Delimiter, header line, chunk size and number of threads
+ * @throws file_reading_exception If the data unit is smaller than the table described by the header
+ * @throws file_writing_exception If the output cannot be written
+*/
+template<typename Table>
+void write_csv(Table const& table, std::string const& data_buffer, std::string const& path,
+    csv_options const& options = csv_options()) {
+
+    std::size_t rows = table.get_header().naxis(2);
+    std::size_t row_width = table.get_header().naxis(1);
+    if (data_buffer.size() < rows * row_width) {
+        throw file_reading_exception("Data unit is smaller than the table described by the header");
+    }
+
+    csv_table_writer writer(path, make_csv_fields(table), options);
+    writer.write_rows(data_buffer.data(), rows, row_width);
+    writer.close();
+}
+
+/**
+ * @brief Exports a table to a CSV file reading its data unit from the FITS file in blocks
+ * @details Each block holds a chunk of rows for every thread, so tables larger than the memory can be exported
+ * @param[in] table Table created from the header of the HDU ( its data is not used )
+ * @param[in,out] file_reader FITS file containing the table
+ * @param[in] data_location Offset of the data unit of the table in the file
+ * @param[in] path Location of the output file
+ * @param[in] options Delimiter, header line, chunk size and number of threads
+ * @throws file_reading_exception If the data unit cannot be read
+ * @throws file_writing_exception If the output cannot be written
+*/
+template<typename Table, typename FileReader>
+void write_csv(Table const& table, FileReader& file_reader, std::size_t data_location, std::string const& path,
+    csv_options const& options = csv_options()) {
+
+    std::size_t rows = table.get_header().naxis(2);
+    std::size_t row_width = table.get_header().naxis(1);
+    std::size_t block_rows = std::max<std::size_t>(options.chunk_rows, 1) * detail::resolve_threads(options.threads);
+
+    csv_table_writer writer(path, make_csv_fields(table), options);
+    for (std::size_t first = 0; first < rows; first += block_rows) {
+        std::size_t count = std::min(block_rows, rows - first);
+        file_reader.set_reading_pos(data_location + first * row_width);
+        std::string data = file_reader.read(count * row_width);
+        if (data.size() < count * row_width) {
+            throw file_reading_exception("Data unit is smaller than the table described by the header");
+        }
+        writer.write_rows(data.data(), count, row_width);
+    }
+    writer.close();
+}
+
+/**
+ * @brief   Infers the columns of a binary table able to hold a CSV file
+ * @details Columns whose sampled values are all T/F/true/false become L, integers J ( or K if they do not fit in
+ *          32 bits ), other numbers D and anything else A wide enough for the longest sampled value. Names come
+ *          from the header line or are COL1, COL2 ...
+ * @param[in] path Location of the CSV file
+ * @param[in] options Delimiter and whether the file has a header line
+ * @param[in] sample_rows Number of rows examined ( 0 examines the whole file )
+ * @throws file_reading_exception If the file cannot be opened
+ * @throws invalid_cast If the rows do not all have the same number of fields
+*/
+inline std::vector<column> infer_csv_columns(std::string const& path, csv_options const& options = csv_options(),
+    std::size_t sample_rows = 1000) {
+
+    detail::csv_record_reader reader(path);
+    std::vector<detail::csv_record_reader::record> records;
+    std::vector<std::string> names;
+    std::vector<detail::csv_column_statistics> statistics;
+    std::string scratch;
+    bool first_record = true;
+    std::size_t sampled = 0;
+
+    while ((sample_rows == 0 || sampled < sample_rows) && reader.next_records(options.block_size, records)) {
+        for (auto const& record : records) {
+            const char* first = reader.data() + record.first;
+            const char* last = reader.data() + record.second;
+            if (first_record && options.header) {
+                detail::for_each_csv_field(first, last, options.delimiter, scratch,
+                    [&](std::size_t, const char* name_first, const char* name_last) {
+                        names.push_back(boost::trim_copy(std::string(name_first, name_last)));
+                    });
+                statistics.resize(names.size());
+                first_record = false;
+                continue;
+            }
+
+            std::size_t count = detail::for_each_csv_field(first, last, options.delimiter, scratch,
+                [&](std::size_t index, const char* value_first, const char* value_last) {
+                    if (index >= statistics.size()) { statistics.resize(index + 1); }
+                    statistics[index].add(value_first, value_last);
+                });
+            if (first_record) { names.resize(count); }
+            if (count != names.size()) {
+                throw invalid_cast("Row " + boost::lexical_cast<std::string>(sampled + 1) +
+                    " does not have a field for every column");
+            }
+            first_record = false;
+            if (++sampled == sample_rows) { break; }
+        }
+    }
+
+    std::vector<column> columns;
+    for (std::size_t i = 0; i < names.size(); i++) {
+        columns.emplace_back(statistics[i].form());
+        columns.back().TTYPE(names[i].empty() ? "COL" + boost::lexical_cast<std::string>(i + 1) : names[i]);
+    }
+    return columns;
+}
+
+/**
+ * @brief   Imports a CSV file into a binary table written to a FITS file
+ * @details The rows always become a BINTABLE extension, ASCII tables are not produced. The file is read in blocks of options.block_size bytes whose records are parsed into rows by a pool of
+ *          threads ( chunk_rows records per task ) and appended to the table with binary_table_writer, so the memory
+ *          used does not depend on the size of the file. Numbers are parsed without allocating ( see number_parser ).
+ *          Empty fields become undefined logicals, NaN reals and 0 integers; strings longer than their column are cut
+ * @param[in] csv_path Location of the CSV file
+ * @param[in] fits_path Location of the FITS file
+ * @param[in] columns Columns of the table in the order of the fields ( TTYPE, TFORM and TUNIT are used )
+ * @param[in] options Delimiter, header line, block and chunk sizes and number of threads
+ * @param[in] extname Name of the extension ( EXTNAME is omitted if empty )
+ * @param[in] append Whether the table is appended to an existing FITS file instead of a new file
+ * @return Number of rows imported
+ * @throws file_reading_exception If the CSV file cannot be opened
+ * @throws file_writing_exception If the FITS file cannot be written
+ * @throws invalid_table_colum_format If a column format is not supported
+ * @throws invalid_cast If a record does not have a field per column or a field cannot be converted
+*/
+inline std::size_t read_csv(std::string const& csv_path, std::string const& fits_path, std::vector<column> const& columns,
+    csv_options const& options = csv_options(), std::string const& extname = "", bool append = false) {
+
+    std::vector<csv_field> fields;
+    std::size_t row_width = 0;
+    for (auto const& metadata : columns) {
+        column positioned = metadata;
+        positioned.TBCOL(row_width);
+        fields.push_back(detail::make_binary_table_field(positioned));
+        row_width += fields.back().width;
+    }
+
+    detail::csv_record_reader reader(csv_path);
+    binary_table_writer writer(fits_path, columns, extname, append);
+
+    std::size_t threads = detail::resolve_threads(options.threads);
+    std::size_t chunk_rows = std::max<std::size_t>(options.chunk_rows, 1);
+    std::vector<detail::csv_record_reader::record> records;
+    std::string rows;
+    bool skip_header = options.header;
+    std::size_t rows_read = 0;
+
+    while (reader.next_records(options.block_size, records)) {
+        std::size_t first_record = skip_header ? 1 : 0;
+        skip_header = false;
+        std::size_t count = records.size() - first_record;
+        rows.resize(count * row_width);
+
+        detail::run_parallel((count + chunk_rows - 1) / chunk_rows, threads, [&](std::size_t task) {
+            std::string scratch;
+            std::size_t last_row = std::min(count, (task + 1) * chunk_rows);
+            for (std::size_t row = task * chunk_rows; row < last_row; row++) {
+                auto const& record = records[first_record + row];
+                detail::parse_csv_record(reader.data() + record.first, reader.data() + record.second,
+                    &rows[row * row_width], fields, options.delimiter, scratch, rows_read + row + 1);
+            }
+        });
+
+        writer.write_raw_rows(rows.data(), count);
+        rows_read += count;
+    }
+    writer.close();
+    return rows_read;
+}
+
+/**
+ * @brief   Imports a CSV file into a binary table ( BINTABLE ) whose columns are inferred from the first 1000 rows
+ * @details A later value that does not fit its inferred column ( e.g. an integer beyond 32 bits in a J column or
+ *          text in a D column ) makes the import start over with the columns inferred from the whole file, which
+ *          widens them to K, D or A as needed. Tables appended to an existing file cannot be started over, so
+ *          their columns are inferred from the whole file at once
+ * @throws invalid_cast If a record does not have a field per column or a value fits none of the column types
+ * @see infer_csv_columns
+*/
+inline std::size_t read_csv(std::string const& csv_path, std::string const& fits_path,
+    csv_options const& options = csv_options(), std::string const& extname = "", bool append = false) {
+    if (append) {
+        return read_csv(csv_path, fits_path, infer_csv_columns(csv_path, options, 0), options, extname, true);
+    }
+
+    std::vector<column> columns = infer_csv_columns(csv_path, options);
+    try {
+        return read_csv(csv_path, fits_path, columns, options, extname);
+    }
+    catch (invalid_cast&) {
+        std::vector<column> widened = infer_csv_columns(csv_path, options, 0);
+        bool same_columns = std::equal(columns.begin(), columns.end(), widened.begin(), widened.end(),
+            [](column const& sampled, column const& whole) { return sampled.TFORM() == whole.TFORM(); });
+        if (same_columns) { throw; }
+        return read_csv(csv_path, fits_path, widened, options, extname);
+    }
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_CSV_HPP
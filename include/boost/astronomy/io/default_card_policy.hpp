@@ -12,21 +12,25 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include <vector>
 #include <map>
 #include <algorithm>
+#include <iterator>
 #include <sstream>
 #include <complex>
+#include <type_traits>
 #include <boost/lexical_cast.hpp>
 #include <boost/astronomy/exception/fits_exception.hpp>
 #include <boost/astronomy/io/string_conversion_utility.hpp>
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/blank.hpp>
 #include <boost/mpl/vector.hpp>
+#include <boost/utility/string_view.hpp>
 
 namespace boost{namespace astronomy{namespace io{
 
+/**
+ * @brief   Default policy used by card for validating, parsing and serializing the cards
+ * @details The policy is stateless, so a card deriving from it occupies only the 80 bytes of its content
+*/
 class card_policy {
-
-    std::vector<std::string> reserved_keywords;
-
 public:
     typedef boost::mpl::vector<
         boost::blank,
@@ -45,21 +49,11 @@ public:
     >  supported_types;
 
 
-    /**
-     * @brief Constructs a default object of card and initializes the reserved keyword list
-    */
-    card_policy() {
-        reserved_keywords.push_back("COMMENT");
-        reserved_keywords.push_back("HISTORY");
-        reserved_keywords.push_back("END");
-    }
-
-
     /**
      * @brief Returns true if the keyword length is less than or equal to 8
      * @param[in] keyword Keyword string to be validated
     */
-    bool is_key_valid(const std::string& keyword) const {
+    bool is_key_valid(boost::string_view keyword) const {
         return keyword.length() <= 8;
     }
 
@@ -67,11 +61,11 @@ public:
      * @brief Returns true if the card follows the specification of FITS standard
      * @param[in] fits_card card string to be validated
     */
-    bool is_card_valid(const std::string& fits_card) const {
+    bool is_card_valid(boost::string_view fits_card) const {
 
         if (fits_card.length() <= 80)
         {
-            if (in_proper_format(fits_card) || is_reserved_keyword(boost::trim_copy(fits_card.substr(0, 7)))|| is_blank(fits_card))
+            if (in_proper_format(fits_card) || is_reserved_keyword(trim_view(fits_card.substr(0, 7))) || is_blank(fits_card))
                 return true;
         }
         return false;
@@ -80,7 +74,7 @@ public:
     /**
      * @brief Returns true if the parameters follow the specifications of being a card
     */
-    bool is_card_valid(const std::string& keyword, const std::string& value, const std::string& comment) const  {
+    bool is_card_valid(boost::string_view keyword, boost::string_view value, boost::string_view comment) const  {
 
         if (is_key_valid(keyword)) {
             if (comment.empty()) { return value.length() <= 70; }
@@ -143,62 +137,60 @@ public:
     */
     template<typename T>
     std::string serialize_to_fits_format(T value) const {
-        std::string val;
-
-        std::stringstream value_stream;
-        value_stream << value;
-        val = value_stream.str();
-
-        val.insert(0, 20 - val.length(), ' ');
-        return val;
+        char buffer[70];
+        return std::string(buffer, serialize_to_fits_format(value, buffer, sizeof(buffer)));
     }
 
     /**
-     * @brief Pads the string according to the requirements in FITS standard
-     * @param[in] value Value to be serialized and padded according to requirements
+     * @brief Serializes the value directly into the value field of a card
+     * @details Numbers are right justified in the first 20 characters ( fixed format ) and
+     *          floating point numbers use the shortest representation that reads back exactly
+     * @param[in] value The value to be serialized
+     * @param[out] buffer Value field of the card ( starting from the 11th character )
+     * @param[in] capacity Number of characters available in buffer
+     * @return Number of characters written
+     * @throws invalid_card If the serialized value does not fit in the buffer
     */
-    std::string serialize_to_fits_format(const std::string& value) const {
-        std::string generated_string="";
-        generated_string += '\'';
-        generated_string += value;
-        generated_string += '\'';
-        return generated_string;
+    template<typename T>
+    std::size_t serialize_to_fits_format(T value, char* buffer, std::size_t capacity) const {
+        return serialize_value(value, buffer, capacity, std::is_arithmetic<T>());
     }
 
     /**
-     * @brief Serializes a boolean to string and pads it according to requirements in FITS standard
-     * @param[in] value Boolean value to serialize to
+     * @brief Encloses the string in quotes according to the requirements in FITS standard
     */
-    std::string serialize_to_fits_format(bool value) const {
-
-        return std::string(value == true ? "T" : "F").insert(0, 19, ' ');
+    std::size_t serialize_to_fits_format(const std::string& value, char* buffer, std::size_t capacity) const {
+        if (value.length() + 2 > capacity) { throw invalid_card(); }
+        buffer[0] = '\'';
+        std::copy(value.begin(), value.end(), buffer + 1);
+        buffer[value.length() + 1] = '\'';
+        return value.length() + 2;
     }
 
     /**
-     * @brief Serializes a long long value to string and pads it according to requirements in FITS standard
-     * @param[in] value long long value to serialize to
+     * @brief Serializes a boolean and pads it according to requirements in FITS standard
     */
-    std::string serialize_to_fits_format(long long value)const {
-        std::string val = std::to_string(value);
-        return val.insert(0, 20 - val.length(), ' ');
+    std::size_t serialize_to_fits_format(bool value, char* buffer, std::size_t capacity) const {
+        const char text = value ? 'T' : 'F';
+        return right_justify(&text, 1, buffer, capacity);
     }
 
     /**
-     * @brief Serializes a complex number to string and pads it according to requirements in FITS standard
-     * @param[in] value complex number to serialize to
+     * @brief Serializes the real and imaginary parts of a complex number one after the other
      * @tparam Type of complex number
     */
     template<typename T>
-    std::string serialize_to_fits_format(std::complex<T> value)const {
-        return serialize_to_fits_format(value.real())+ serialize_to_fits_format(value.imag());        
+    std::size_t serialize_to_fits_format(std::complex<T> value, char* buffer, std::size_t capacity) const {
+        std::size_t length = serialize_to_fits_format(value.real(), buffer, capacity);
+        return length + serialize_to_fits_format(value.imag(), buffer + length, capacity - length);
     }
 
     /**
      * @brief Extracts the key from the fits_card
      * @param[in] The card from which the keyword needs to be extracted
     */
-    std::string extract_keyword(const std::string& fits_card)const {
-        return fits_card.substr(0, 8);
+    std::string extract_keyword(boost::string_view fits_card)const {
+        return fits_card.substr(0, 8).to_string();
     }
 
     /**
@@ -213,31 +205,69 @@ public:
      * @brief Returns the value associated with keyword from the fits_card
      * @param[in] fits_card fits card from where the value needs to be extracted
     */
-    std::string extract_value(const std::string& fits_card) const {
-        return fits_card.substr(9, fits_card.find('/') - 10);
+    std::string extract_value(boost::string_view fits_card) const {
+        return fits_card.substr(9, fits_card.find('/') - 10).to_string();
     }
 
 private:
 
+    /**
+     * @brief Writes the number right justified in a field of 20 characters
+    */
+    template<typename T>
+    static std::size_t serialize_value(T value, char* buffer, std::size_t capacity, std::true_type) {
+        char number[number_formatter::max_length];
+        return right_justify(number, number_formatter::format(value, number), buffer, capacity);
+    }
+
+    /**
+     * @brief Writes the value of any other type using its extraction operator
+    */
+    template<typename T>
+    static std::size_t serialize_value(const T& value, char* buffer, std::size_t capacity, std::false_type) {
+        std::stringstream value_stream;
+        value_stream << value;
+        std::string text = value_stream.str();
+        return right_justify(text.data(), text.length(), buffer, capacity);
+    }
+
+    static std::size_t right_justify(const char* text, std::size_t length, char* buffer, std::size_t capacity) {
+        std::size_t padding = length < 20 ? 20 - length : 0;
+        if (padding + length > capacity) { throw invalid_card(); }
+        std::fill(buffer, buffer + padding, ' ');
+        std::copy(text, text + length, buffer + padding);
+        return padding + length;
+    }
+
     /**
      * @brief Checks whether the keyword is in list of reserved keywords
     */
-    bool is_reserved_keyword(const std::string& keyword) const {
-        return std::find(reserved_keywords.begin(), reserved_keywords.end(), keyword) != reserved_keywords.end();
+    static bool is_reserved_keyword(boost::string_view keyword) {
+        static const char* const reserved_keywords[] = { "COMMENT", "HISTORY", "END" };
+        return std::find(std::begin(reserved_keywords), std::end(reserved_keywords), keyword) != std::end(reserved_keywords);
+    }
+
+    /**
+     * @brief Removes the leading and trailing spaces without copying
+    */
+    static boost::string_view trim_view(boost::string_view value) {
+        auto first = value.find_first_not_of(' ');
+        if (first == boost::string_view::npos) { return boost::string_view(); }
+        return value.substr(first, value.find_last_not_of(' ') - first + 1);
     }
 
     /**
      * @brief Checks whether the card follows the standard specification for cards with non reserved keywords
     */
-    bool in_proper_format(const std::string& fits_card)const {
-        return fits_card.substr(8, 2) == "= ";
+    static bool in_proper_format(boost::string_view fits_card) {
+        return fits_card.length() >= 10 && fits_card.substr(8, 2) == "= ";
     }
 
     /**
      * @brief Checks whether the card has blank field
     */
-    bool is_blank(const std::string& fits_card) const {
-        return fits_card.substr(0, 8) == std::string(8, ' ');
+    static bool is_blank(boost::string_view fits_card) {
+        return fits_card.length() >= 8 && fits_card.substr(0, 8) == "        ";
     }
 };
 
@@ -14,6 +14,7 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include<boost/astronomy/io/primary_hdu.hpp>
 #include<boost/astronomy/io/binary_table.hpp>
 #include<boost/astronomy/io/ascii_table.hpp>
+#include<boost/astronomy/exception/fits_exception.hpp>
 #include<boost/variant.hpp>
 
 
@@ -50,6 +51,134 @@ namespace boost { namespace astronomy {namespace io {
         void operator()(Hdu& hdu) { hdu.write_to(writer); }
     };
 
+    /**
+     * @brief Visitor for applying a function to the header of all types of HDU's
+     * @tparam Function Type of function object accepting the header by reference
+    */
+    template<typename Function>
+    struct fits_header_visitor :public boost::static_visitor<> {
+    private:
+        Function& function;
+    public:
+
+        /**
+         * @brief Constructs a visitor object with the function to be applied to headers
+         * @param[in] func Function object accepting the header by reference
+        */
+        fits_header_visitor(Function& func) :function(func) {}
+
+        /**
+         * @brief Special case ( Not to do anything )
+        */
+        void operator()(boost::blank) {}
+
+        /**
+         * @brief Applies the function to the header of given hdu
+         * @tparam Hdu  Type of HDU
+         * @param[in] hdu Hdu object whose header is to be passed
+        */
+        template<typename Hdu>
+        void operator()(Hdu& hdu) { function(hdu.get_header()); }
+    };
+
+    /**
+     * @brief Visitor for overwriting a single field of table HDU's in place
+     * @tparam FileWriter Type of writer object to write data to
+     * @tparam ValueType Type of the new value of field
+    */
+    template<typename FileWriter, typename ValueType>
+    struct fits_cell_writer_visitor :public boost::static_visitor<> {
+    private:
+        FileWriter& writer;
+        std::size_t data_location;
+        const std::string& column_name;
+        std::size_t row;
+        const ValueType& value;
+    public:
+
+        /**
+         * @brief Constructs a visitor object with an associated file_writer and the field to update
+         * @param[in,out] file_writer Object for facilitating the writing of data to the file
+         * @param[in] data_loc Offset of the data unit of HDU in the file
+         * @param[in] col_name Name of the column containing the field
+         * @param[in] row_number Row number of the field
+         * @param[in] new_value New value of the field
+        */
+        fits_cell_writer_visitor(FileWriter& file_writer, std::size_t data_loc,
+            const std::string& col_name, std::size_t row_number, const ValueType& new_value)
+            :writer(file_writer), data_location(data_loc), column_name(col_name), row(row_number), value(new_value) {}
+
+        /**
+         * @brief Overwrites the field of a binary table
+        */
+        template<typename CardPolicy, typename Converter>
+        void operator()(basic_binary_table_extension<CardPolicy, Converter>& hdu) {
+            hdu.write_cell(writer, data_location, column_name, row, value);
+        }
+
+        /**
+         * @brief Overwrites the field of an ascii table
+        */
+        template<typename CardPolicy, typename Converter>
+        void operator()(basic_ascii_table<CardPolicy, Converter>& hdu) {
+            hdu.write_cell(writer, data_location, column_name, row, value);
+        }
+
+        /**
+         * @brief HDU's without tables cannot be updated by field
+        */
+        template<typename Hdu>
+        void operator()(Hdu&) { throw wrong_extension_type(); }
+    };
+
+    /**
+     * @brief Visitor for overwriting a range of pixels of image HDU's in place
+     * @tparam FileWriter Type of writer object to write data to
+     * @tparam PixelType Type of the pixels
+    */
+    template<typename FileWriter, typename PixelType>
+    struct fits_pixel_writer_visitor :public boost::static_visitor<> {
+    private:
+        FileWriter& writer;
+        std::size_t data_location;
+        std::size_t first_pixel;
+        const std::vector<PixelType>& pixels;
+    public:
+
+        /**
+         * @brief Constructs a visitor object with an associated file_writer and the pixels to update
+         * @param[in,out] file_writer Object for facilitating the writing of data to the file
+         * @param[in] data_loc Offset of the data unit of HDU in the file
+         * @param[in] first Position of the first pixel to be updated
+         * @param[in] pixel_values New values of the pixels
+        */
+        fits_pixel_writer_visitor(FileWriter& file_writer, std::size_t data_loc,
+            std::size_t first, const std::vector<PixelType>& pixel_values)
+            :writer(file_writer), data_location(data_loc), first_pixel(first), pixels(pixel_values) {}
+
+        /**
+         * @brief Overwrites the pixels of a primary hdu
+        */
+        template<typename CardPolicy, typename Converter>
+        void operator()(basic_primary_hdu<CardPolicy, Converter>& hdu) {
+            hdu.write_pixels(writer, data_location, first_pixel, pixels);
+        }
+
+        /**
+         * @brief Extensions not held by default_hdu_manager ( IMAGE extensions among them ) cannot be updated by pixels
+        */
+        void operator()(boost::blank) {
+            throw file_writing_exception("Only the pixels of the primary HDU can be updated in place, "
+                "IMAGE extensions are not held by default_hdu_manager");
+        }
+
+        /**
+         * @brief HDU's without images cannot be updated by pixels
+        */
+        template<typename Hdu>
+        void operator()(Hdu&) { throw wrong_extension_type(); }
+    };
+
     /**
      * @brief           Contains factory methods for constructing different type of HDU's
      * @author          Gopi Krishna Menon
@@ -67,6 +196,12 @@ namespace boost { namespace astronomy {namespace io {
 
         template<typename FileWriter>
         using writer_visitor = fits_writer_visitor<FileWriter>;
+        template<typename Function>
+        using header_visitor = fits_header_visitor<Function>;
+        template<typename FileWriter, typename ValueType>
+        using cell_writer_visitor = fits_cell_writer_visitor<FileWriter, ValueType>;
+        template<typename FileWriter, typename PixelType>
+        using pixel_writer_visitor = fits_pixel_writer_visitor<FileWriter, PixelType>;
         typedef header<CardPolicy> header_type;
 
         /**
@@ -43,11 +43,12 @@ namespace boost { namespace astronomy {namespace io {
      * @brief Central class for handling the Reading and Writing Operations
      * @tparam FileReader Represents the reader class for reading related operations
      * @tparam ExtensionsSupported Contains the list of extensions along with their construction methods 
+     * @tparam IoObserver Receives the per HDU measurements of reading ( see io_observer.hpp )
     */
-    template<typename FileReader, typename ExtensionsSupported>
+    template<typename FileReader, typename ExtensionsSupported, typename IoObserver = null_io_observer>
     struct basic_fits {
     private:
-        typedef fits_io<FileReader, ExtensionsSupported> fitsreader;
+        typedef fits_io<FileReader, ExtensionsSupported, IoObserver> fitsreader;
     public:
         /**
          * @brief Constructs a default object of basic_fits
@@ -58,9 +59,11 @@ namespace boost { namespace astronomy {namespace io {
          * @brief Opens a fits file for reading/writing and returns a reader object
          * @param[in] filepath Location of file
          * @param[in] reading_option Mode in which file should be read
+         * @param[in] io_observer Observer receiving the measurements of reading
         */
-        static fitsreader open(const std::string& filepath, reading_options reading_option = reading_options::read_entire_hdus) {
-            fitsreader f_reader(filepath);
+        static fitsreader open(const std::string& filepath, reading_options reading_option = reading_options::read_entire_hdus,
+            IoObserver io_observer = IoObserver()) {
+            fitsreader f_reader(filepath, std::move(io_observer));
             if (reading_option == reading_options::read_only_headers) {
                 f_reader.read_only_headers();
             }
@@ -84,6 +87,7 @@ namespace boost { namespace astronomy {namespace io {
 
     // Some common aliases for easy use
     using fits = basic_fits<fits_stream, default_hdu_manager<card_policy,ascii_converter,binary_data_converter>>;
+    using instrumented_fits = basic_fits<fits_stream, default_hdu_manager<card_policy,ascii_converter,binary_data_converter>, io_statistics>;
     using ascii_table = basic_ascii_table<card_policy, ascii_converter>;
     using binary_table = basic_binary_table_extension<card_policy, binary_data_converter>;
     using primary_hdu = basic_primary_hdu<card_policy,binary_data_converter>;
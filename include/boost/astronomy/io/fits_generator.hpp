@@ -0,0 +1,382 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_FITS_GENERATOR_HPP
+#define BOOST_ASTRONOMY_IO_FITS_GENERATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/endian/conversion.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <boost/astronomy/io/binary_field_layout.hpp>
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <boost/astronomy/io/default_card_policy.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief   Writes deterministic synthetic FITS files of arbitrary size for scale testing
+ * @details Headers are written through header::write_header and the data units are generated
+ *          and written in fixed size chunks, so images and tables much larger than the available
+ *          memory can be produced. Given the same seed and the same sequence of calls the
+ *          generated file is identical byte for byte.
+ * @tparam  FileWriter Provides operations for writing data into the file
+ * @tparam  CardPolicy Policy used for creating the header cards
+ * @author  agent
+*/
+template<typename FileWriter, typename CardPolicy>
+class basic_fits_generator {
+    FileWriter file_writer;
+    std::uint64_t seed;
+    std::uint64_t state;
+    std::size_t hdu_count = 0;
+    std::size_t chunk_size;
+
+public:
+    /**
+     * @brief Creates the file in which the HDUs will be generated
+     * @param[in] path Location of the file
+     * @param[in] generator_seed Seed from which all the data values are derived
+     * @param[in] chunk_bytes Amount of data generated before it is written to the file
+     * @throws file_writing_exception If the file cannot be created
+    */
+    basic_fits_generator(const std::string& path, std::uint64_t generator_seed = 0, std::size_t chunk_bytes = 2880 * 364)
+        : seed(generator_seed), state(generator_seed), chunk_size(chunk_bytes < 2880 ? 2880 : chunk_bytes - chunk_bytes % 2880) {
+        if (!file_writer.create_file(path)) {
+            throw file_writing_exception("Cannot Create File");
+        }
+    }
+
+    /**
+     * @brief Writes a primary HDU without any data
+    */
+    void write_primary_hdu() {
+        write_primary_image(bitpix::B8, std::vector<std::size_t>());
+    }
+
+    /**
+     * @brief Writes a primary HDU containing an image filled with deterministic pixel values
+     * @param[in] bitpix_value Type of the pixels
+     * @param[in] naxis Number of pixels along each axis ( NAXIS1, NAXIS2 ... )
+     * @throws fits_exception If the primary HDU has already been written
+    */
+    void write_primary_image(bitpix bitpix_value, const std::vector<std::size_t>& naxis) {
+        if (hdu_count != 0) { throw fits_exception(); }
+
+        header<CardPolicy> hdu_header;
+        hdu_header.add_card(make_card("SIMPLE", true, "conforms to FITS standard"));
+        add_image_cards(hdu_header, bitpix_value, naxis);
+        hdu_header.add_card(make_card("EXTEND", true));
+        write_image_hdu(hdu_header, bitpix_value, naxis);
+    }
+
+    /**
+     * @brief Writes an IMAGE extension filled with deterministic pixel values
+     * @param[in] bitpix_value Type of the pixels
+     * @param[in] naxis Number of pixels along each axis ( NAXIS1, NAXIS2 ... )
+     * @param[in] extname Name of the extension ( EXTNAME is omitted if empty )
+     * @note  An empty primary HDU is written first if none has been written yet
+    */
+    void write_image_extension(bitpix bitpix_value, const std::vector<std::size_t>& naxis, const std::string& extname = "") {
+        if (hdu_count == 0) { write_primary_hdu(); }
+
+        header<CardPolicy> hdu_header;
+        hdu_header.add_card(make_card("XTENSION", std::string("IMAGE"), "image extension"));
+        add_image_cards(hdu_header, bitpix_value, naxis);
+        hdu_header.add_card(make_card("PCOUNT", 0));
+        hdu_header.add_card(make_card("GCOUNT", 1));
+        if (!extname.empty()) { hdu_header.add_card(make_card("EXTNAME", extname)); }
+        write_image_hdu(hdu_header, bitpix_value, naxis);
+    }
+
+    /**
+     * @brief Writes a BINTABLE extension whose fields are filled with deterministic values
+     * @param[in] rows Number of rows in the table
+     * @param[in] column_forms TFORM of each column ( supported types are L, X, B, I, J, K, A, E, D, C and M )
+     * @param[in] extname Name of the extension ( EXTNAME is omitted if empty )
+     * @param[in] heap_size Size of the heap following the table ( PCOUNT ), filled with deterministic bytes
+     * @throws invalid_table_colum_format If a column form is not supported
+     * @note  An empty primary HDU is written first if none has been written yet
+    */
+    void write_binary_table(std::size_t rows, const std::vector<std::string>& column_forms, const std::string& extname = "",
+        std::size_t heap_size = 0) {
+        if (hdu_count == 0) { write_primary_hdu(); }
+
+        std::vector<binary_field_layout> columns;
+        std::size_t row_width = 0;
+        for (auto const& form : column_forms) {
+            columns.push_back(parse_column_form(form));
+            row_width += columns.back().width;
+        }
+
+        header<CardPolicy> hdu_header;
+        hdu_header.add_card(make_card("XTENSION", std::string("BINTABLE"), "binary table extension"));
+        hdu_header.add_card(make_card("BITPIX", 8));
+        hdu_header.add_card(make_card("NAXIS", 2));
+        hdu_header.add_card(make_card("NAXIS1", static_cast<long long>(row_width), "width of table in bytes"));
+        hdu_header.add_card(make_card("NAXIS2", static_cast<long long>(rows), "number of rows in table"));
+        hdu_header.add_card(make_card("PCOUNT", static_cast<long long>(heap_size), "size of the heap"));
+        hdu_header.add_card(make_card("GCOUNT", 1));
+        hdu_header.add_card(make_card("TFIELDS", static_cast<long long>(columns.size())));
+        for (std::size_t i = 0; i < columns.size(); i++) {
+            std::string index = boost::lexical_cast<std::string>(i + 1);
+            hdu_header.add_card(make_card("TTYPE" + index, "COL" + index));
+            hdu_header.add_card(make_card("TFORM" + index, column_forms[i]));
+        }
+        if (!extname.empty()) { hdu_header.add_card(make_card("EXTNAME", extname)); }
+        write_header(hdu_header);
+
+        std::string chunk;
+        chunk.reserve(chunk_size + row_width);
+        for (std::size_t row = 0; row < rows; row++) {
+            for (auto const& col : columns) {
+                append_field(chunk, col);
+            }
+            if (chunk.size() >= chunk_size) {
+                write_chunk(chunk);
+            }
+        }
+        for (std::size_t byte = 0; byte < heap_size; byte++) {
+            chunk.push_back(static_cast<char>(next_random() & 0xFF));
+            if (chunk.size() >= chunk_size) {
+                write_chunk(chunk);
+            }
+        }
+        write_chunk(chunk);
+        pad_data_unit();
+    }
+
+    /**
+     * @brief Returns TFORMs of count columns cycling through all the column types readable by binary_table
+     * @param[in] count Number of columns
+    */
+    static std::vector<std::string> mixed_column_forms(std::size_t count) {
+        static const char* forms[] = { "J", "E", "D", "I", "L", "B", "16A", "4E", "C", "M", "3J", "2D" };
+        std::vector<std::string> column_forms;
+        for (std::size_t i = 0; i < count; i++) {
+            column_forms.emplace_back(forms[i % (sizeof(forms) / sizeof(forms[0]))]);
+        }
+        return column_forms;
+    }
+
+    /**
+     * @brief Returns the number of HDUs written so far
+    */
+    std::size_t total_hdus() const { return hdu_count; }
+
+    /**
+     * @brief Returns the size of the file generated so far in bytes
+    */
+    std::size_t bytes_written() { return file_writer.get_current_pos(); }
+
+    /**
+     * @brief Flushes all the pending writes and closes the file
+    */
+    void close() {
+        file_writer.flush();
+        file_writer.close();
+    }
+
+private:
+    /**
+     * @brief Creates a card holding the given value
+    */
+    template<typename ValueType>
+    static card<CardPolicy> make_card(const std::string& key, ValueType value, const std::string& comment = "") {
+        card<CardPolicy> new_card;
+        new_card.create_card(key, value, comment);
+        return new_card;
+    }
+
+    /**
+     * @brief Returns the next value of the splitmix64 sequence
+    */
+    std::uint64_t next_random() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Returns a finite value uniformly distributed in [-1000, 1000)
+    */
+    double next_real() {
+        return (static_cast<double>(next_random() >> 11) * (1.0 / 9007199254740992.0)) * 2000.0 - 1000.0;
+    }
+
+    template<typename IntegerType>
+    void append_big_endian(std::string& buffer, IntegerType value) {
+        char bytes[sizeof(IntegerType)];
+        IntegerType big_endian_value = boost::endian::native_to_big(value);
+        std::memcpy(bytes, &big_endian_value, sizeof(IntegerType));
+        buffer.append(bytes, sizeof(IntegerType));
+    }
+
+    void append_float(std::string& buffer) {
+        float value = static_cast<float>(next_real());
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        append_big_endian(buffer, bits);
+    }
+
+    void append_double(std::string& buffer) {
+        double value = next_real();
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        append_big_endian(buffer, bits);
+    }
+
+    /**
+     * @brief Appends a single generated pixel of the given type to the buffer
+    */
+    void append_pixel(std::string& buffer, bitpix bitpix_value) {
+        switch (bitpix_value) {
+        case bitpix::B8:
+            buffer += static_cast<char>(next_random() & 0xFF);
+            break;
+        case bitpix::B16:
+            append_big_endian(buffer, static_cast<std::uint16_t>(next_random()));
+            break;
+        case bitpix::B32:
+            append_big_endian(buffer, static_cast<std::uint32_t>(next_random()));
+            break;
+        case bitpix::_B32:
+            append_float(buffer);
+            break;
+        case bitpix::_B64:
+            append_double(buffer);
+            break;
+        }
+    }
+
+    /**
+     * @brief Appends a single generated field of the column to the buffer
+    */
+    void append_field(std::string& buffer, binary_field_layout const& col) {
+        switch (col.type) {
+        case 'L':
+            for (std::size_t i = 0; i < col.repeat; i++) { buffer += (next_random() & 1) ? 'T' : 'F'; }
+            break;
+        case 'A':
+            for (std::size_t i = 0; i < col.repeat; i++) { buffer += static_cast<char>('A' + next_random() % 26); }
+            break;
+        case 'X':
+        case 'B':
+            for (std::size_t i = 0; i < col.width; i++) { buffer += static_cast<char>(next_random() & 0xFF); }
+            break;
+        case 'I':
+            for (std::size_t i = 0; i < col.repeat; i++) { append_big_endian(buffer, static_cast<std::uint16_t>(next_random())); }
+            break;
+        case 'J':
+            for (std::size_t i = 0; i < col.repeat; i++) { append_big_endian(buffer, static_cast<std::uint32_t>(next_random())); }
+            break;
+        case 'K':
+            for (std::size_t i = 0; i < col.repeat; i++) { append_big_endian(buffer, next_random()); }
+            break;
+        case 'E':
+            for (std::size_t i = 0; i < col.repeat; i++) { append_float(buffer); }
+            break;
+        case 'C':
+            for (std::size_t i = 0; i < 2 * col.repeat; i++) { append_float(buffer); }
+            break;
+        case 'D':
+            for (std::size_t i = 0; i < col.repeat; i++) { append_double(buffer); }
+            break;
+        case 'M':
+            for (std::size_t i = 0; i < 2 * col.repeat; i++) { append_double(buffer); }
+            break;
+        }
+    }
+
+    /**
+     * @brief Extracts the repeat count and type from TFORM and computes the width of the field
+     * @throws invalid_table_colum_format If the type is not supported
+    */
+    static binary_field_layout parse_column_form(const std::string& form) {
+        binary_field_layout col = parse_binary_form(form);
+        if (col.type == 'P' || col.type == 'Q') { throw invalid_table_colum_format(); }
+        return col;
+    }
+
+    /**
+     * @brief Adds the mandatory BITPIX and NAXISn cards of an image
+    */
+    static void add_image_cards(header<CardPolicy>& hdu_header, bitpix bitpix_value, const std::vector<std::size_t>& naxis) {
+        static const int bitpix_values[] = { 8, 16, 32, -32, -64 };
+        hdu_header.add_card(make_card("BITPIX", bitpix_values[static_cast<int>(bitpix_value)]));
+        hdu_header.add_card(make_card("NAXIS", static_cast<long long>(naxis.size())));
+        for (std::size_t i = 0; i < naxis.size(); i++) {
+            hdu_header.add_card(make_card("NAXIS" + boost::lexical_cast<std::string>(i + 1),
+                static_cast<long long>(naxis[i])));
+        }
+    }
+
+    /**
+     * @brief Terminates the header with END card and writes it to the file
+    */
+    void write_header(header<CardPolicy>& hdu_header) {
+        hdu_header.add_card(card<CardPolicy>("END" + std::string(77, ' ')));
+        hdu_header.write_header(file_writer);
+        // Every HDU derives its values from its own seed so HDUs can be regenerated independently
+        state = seed + 0x632BE59BD9B4E019ULL * ++hdu_count;
+    }
+
+    /**
+     * @brief Writes the header followed by the generated pixels of the image
+    */
+    void write_image_hdu(header<CardPolicy>& hdu_header, bitpix bitpix_value, const std::vector<std::size_t>& naxis) {
+        write_header(hdu_header);
+        if (naxis.empty()) { return; }
+
+        std::size_t total_pixels = 1;
+        for (auto axis : naxis) { total_pixels *= axis; }
+
+        std::string chunk;
+        chunk.reserve(chunk_size + 8);
+        for (std::size_t pixel = 0; pixel < total_pixels; pixel++) {
+            append_pixel(chunk, bitpix_value);
+            if (chunk.size() >= chunk_size) {
+                write_chunk(chunk);
+            }
+        }
+        write_chunk(chunk);
+        pad_data_unit();
+    }
+
+    void write_chunk(std::string& chunk) {
+        if (chunk.empty()) { return; }
+        if (!file_writer.write(chunk)) {
+            throw file_writing_exception("Cannot Write To File");
+        }
+        chunk.clear();
+    }
+
+    /**
+     * @brief Fills the rest of the last logical record of the data unit with zeros
+    */
+    void pad_data_unit() {
+        auto current_write_pos = file_writer.get_current_pos();
+        auto logical_record_end_pos = file_writer.find_unit_end();
+        file_writer.write(std::string(logical_record_end_pos - current_write_pos, '\0'));
+    }
+};
+
+using fits_generator = basic_fits_generator<fits_stream, card_policy>;
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_FITS_GENERATOR_HPP
@@ -10,10 +10,17 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #define BOOST_ASTRONOMY_IO_FITS_READER_HPP
 
 #include <deque>
+#include <utility>
 #include <string>
+#include <vector>
 #include <map>
+#include <stdexcept>
+
+#include <boost/variant.hpp>
 
 #include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/io/io_observer.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
 
 namespace boost { namespace astronomy { namespace io {
     /**
@@ -31,6 +38,8 @@ namespace boost { namespace astronomy { namespace io {
             info(std::size_t header_loc, std::size_t data_loc, std::size_t index, std::size_t status) :header_location(header_loc),data_location(data_loc), hdu_index(index), read_status(status) {}
         };
         std::map<std::string, info> hdus_info;
+        //! Information of every HDU in the order of the file ( HDUs sharing a name are all listed )
+        std::vector<info> hdus;
 
         /**
          * @brief Returns the total number of HDU's present in file
@@ -45,21 +54,53 @@ namespace boost { namespace astronomy { namespace io {
         void clear() {
             filepath.clear();
             hdus_info.clear();
-
+            hdus.clear();
         }
     };
 
+    /**
+     * @brief Counters of the cache of decoded HDUs ( see fits_io::set_memory_budget )
+    */
+    struct hdu_cache_statistics {
+        std::size_t hits = 0;           //! Accesses to HDUs whose data was held in memory
+        std::size_t misses = 0;         //! Accesses to evicted HDUs whose data had to be read again
+        std::size_t evictions = 0;      //! Number of times the data of an HDU was released
+        std::size_t resident_bytes = 0; //! Size of the data units held in memory
+    };
+
     /**
      * @brief This class provides services for accessing and manipulating different HDU objects
      * @tparam FileReader Represents the reader class for reading related operations
      * @tparam ExtensionsSupported Contains the list of extensions along with their construction methods   
+     * @tparam IoObserver Receives the per HDU measurements of reading ( see io_observer.hpp )
+     * @note   With a memory budget the data of the least recently used HDUs is released once the data units held
+     *         in memory exceed the budget ( headers always stay in memory ). An evicted HDU is read again from the
+     *         file when it is accessed through operator[], so a reference obtained earlier may lose its data
+     *         when other HDUs are accessed
     */
-    template<typename FileReader, typename ExtensionsSupported>
+    template<typename FileReader, typename ExtensionsSupported, typename IoObserver = null_io_observer>
     struct fits_io {
     private:
+        /**
+         * @brief Whether the data of an HDU was never read, is held in memory or was released
+        */
+        enum class data_state { not_read, resident, evicted };
+
+        struct cached_data {
+            data_state state = data_state::not_read;
+            std::size_t size = 0;       // Size of the data unit without the padding
+            std::size_t last_use = 0;   // Value of use_clock when the HDU was last accessed
+        };
+
         FileReader file_reader;
         std::deque<typename ExtensionsSupported::Extension> hdu_list;
         control_block hdus_control_block;
+        bool opened_for_update = false;
+        IoObserver observer;
+        std::vector<cached_data> cached_hdus;
+        std::size_t budget_bytes = 0;
+        std::size_t use_clock = 0;
+        hdu_cache_statistics cache_statistics;
     public:
         /**
          * @brief Creates a default object of fits_reader
@@ -74,14 +115,54 @@ namespace boost { namespace astronomy { namespace io {
             initialize(filepath);
         }
 
+        /**
+         * @brief Creates a fits_reader object which reports the measurements of reading to the observer
+         * @param[in] filepath Location of file
+         * @param[in] io_observer Observer receiving the measurements
+        */
+        fits_io(const std::string& filepath, IoObserver io_observer) :observer(std::move(io_observer)) {
+            initialize(filepath);
+        }
+
         /**
          * @brief Initializes the file_reader and hdu control block
          * @param[in] filepath Location of file
         */
         void initialize(const std::string& filepath) {
             file_reader.set_file(filepath);
+            opened_for_update = false;
             hdus_control_block.clear();
             hdus_control_block.filepath = filepath;
+            cached_hdus.clear();
+            cache_statistics = hdu_cache_statistics();
+        }
+
+        /**
+         * @brief Limits the size of the data units held in memory, releasing the least recently used ones
+         * @details Set the budget before reading the HDUs to bound the memory used while the file is read. The
+         *          most recently accessed HDU is always kept, even if its data alone exceeds the budget
+         * @param[in] bytes Maximum size of the data units held in memory ( 0 means no limit )
+        */
+        void set_memory_budget(std::size_t bytes) {
+            budget_bytes = bytes;
+            enforce_memory_budget(cached_hdus.size());
+        }
+
+        /**
+         * @brief Returns the memory budget of the data units ( 0 means no limit )
+        */
+        std::size_t get_memory_budget() const { return budget_bytes; }
+
+        /**
+         * @brief Returns the hit, miss and eviction counters of the decoded HDUs
+        */
+        const hdu_cache_statistics& get_cache_statistics() const { return cache_statistics; }
+
+        /**
+         * @brief Returns whether the data of the HDU at given index is held in memory
+        */
+        bool is_data_resident(std::size_t index) const {
+            return index < cached_hdus.size() && cached_hdus[index].state == data_state::resident;
         }
 
         /**
@@ -90,22 +171,26 @@ namespace boost { namespace astronomy { namespace io {
         void read_only_headers() {
             while (!file_reader.at_end()) {
                 auto hdu_position = file_reader.get_current_pos();
+                observer.hdu_started(hdu_list.size(), hdu_position);
 
                 typename ExtensionsSupported::header_type hdu_header = extract_header();
+                std::string hdu_name = hdu_header.get_hdu_name();
 
-                hdus_control_block.hdus_info[hdu_header.get_hdu_name()] = control_block::info(hdu_position,file_reader.get_current_pos(), hdu_list.size(), false);
+                hdus_control_block.hdus_info[hdu_name] = control_block::info(hdu_position,file_reader.get_current_pos(), hdu_list.size(), false);
+                hdus_control_block.hdus.push_back(hdus_control_block.hdus_info[hdu_name]);
 
+                phase_recorder<IoObserver> decode_phase(observer, io_phase::decode);
                 auto hdu_instance = ExtensionsSupported::construct_hdu(hdu_header, "");
-
                 hdu_list.push_back(hdu_instance);
+                cached_hdus.push_back(cached_data());
+                decode_phase.finish();
 
-                if (hdu_header.data_size() != 0) {
-
-                    auto total_elements = hdu_header.data_size();
-                    auto element_size = get_element_size_from_bitpix(hdu_header.bitpix());
-                    file_reader.set_reading_pos(file_reader.get_current_pos() + (total_elements*element_size));
-                    file_reader.set_unit_end();
+                std::size_t data_unit_size = hdu_header.data_unit_size();
+                if (data_unit_size != 0) {
+                    // The data unit ( heap included ) is skipped, which is the only jump made while reading the file
+                    seek_to(logical_record_end(file_reader.get_current_pos() + data_unit_size));
                 }
+                observer.hdu_completed(hdu_name);
             }
         }
 
@@ -117,49 +202,214 @@ namespace boost { namespace astronomy { namespace io {
         void read_entire_hdus() {
             while (!file_reader.at_end()) {
                 auto header_loc = file_reader.get_current_pos();
+                observer.hdu_started(hdu_list.size(), header_loc);
                 typename ExtensionsSupported::header_type hdu_header = extract_header();
                 auto data_loc = file_reader.get_current_pos();
                 std::string hdu_data = extract_data_buffer(hdu_header);
-                hdus_control_block.hdus_info[hdu_header.get_hdu_name()] = control_block::info(header_loc,data_loc, hdu_list.size(), false);
+                std::string hdu_name = hdu_header.get_hdu_name();
+                hdus_control_block.hdus_info[hdu_name] = control_block::info(header_loc,data_loc, hdu_list.size(), false);
+                hdus_control_block.hdus.push_back(hdus_control_block.hdus_info[hdu_name]);
+
+                phase_recorder<IoObserver> decode_phase(observer, io_phase::decode);
                 auto hdu_instance = ExtensionsSupported::construct_hdu(hdu_header, hdu_data);
                 hdu_list.push_back(hdu_instance);
+                cache_read_data(hdu_list.size() - 1, hdu_data.size());
+                decode_phase.finish();
+                observer.hdu_completed(hdu_name);
             }
         }
 
         /**
          * @brief Writes all the HDU's Header and Data information to the file
          * @param[in] file_path Path where the file resides
-         * @note The HDUs are written in the order they are stored
+         * @note The HDUs are written in the order they are stored. Evicted HDUs are read again only for writing
+         *       them, without counting as an access
         */
         void write_to(const std::string& file_path) {
             FileReader file_writer;
             file_writer.create_file(file_path);
             typename ExtensionsSupported::template writer_visitor<FileReader> writer_visitor(file_writer);
 
-            for (auto& hdu : hdu_list) {
-            boost::apply_visitor(writer_visitor, hdu);
+            for (std::size_t index = 0; index < hdu_list.size(); index++) {
+                if (index < cached_hdus.size() && cached_hdus[index].state == data_state::evicted) {
+                    auto hdu = reread_hdu(index);
+                    boost::apply_visitor(writer_visitor, hdu);
+                }
+                else {
+                    boost::apply_visitor(writer_visitor, hdu_list[index]);
+                }
+            }
+        }
+
+
+
+
+        /**
+         * @brief Updates the value of a header card in place without rewriting the file
+         * @details Only the affected card is written back at the offset recorded in the control block.
+         *          A keyword not present in the header is added just before the END card, provided
+         *          the header blocks of the HDU have a free slot for it
+         * @param[in] hdu_name Name of the HDU whose header needs to be updated ( the last one if several HDUs
+         *            share the name )
+         * @param[in] keyword Keyword of the card
+         * @param[in] value New value of the card
+         * @throws structural_keyword_exception If the keyword describes the layout of the HDU ( BITPIX, NAXISn ... )
+         * @throws header_space_exhausted_exception If the new card does not fit in the existing header blocks
+         * @throws file_writing_exception If the card cannot be written to the file
+         * @note The header held in memory ( if any ) is updated as well
+        */
+        template<typename ValueType>
+        void update_card(const std::string& hdu_name, const std::string& keyword, ValueType value) {
+            update_card(hdus_control_block.hdus_info.at(hdu_name).hdu_index, keyword, value);
+        }
+
+        /**
+         * @brief Updates the value of a header card of the HDU at given index in place without rewriting the file
+         * @param[in] hdu_index Position of the HDU in the file
+         * @param[in] keyword Keyword of the card
+         * @param[in] value New value of the card
+         * @throws std::out_of_range If there is no HDU at the given index
+         * @throws structural_keyword_exception If the keyword describes the layout of the HDU ( BITPIX, NAXISn ... )
+         * @throws header_space_exhausted_exception If the new card does not fit in the existing header blocks
+         * @throws file_writing_exception If the card cannot be written to the file
+        */
+        template<typename ValueType>
+        void update_card(std::size_t hdu_index, const std::string& keyword, ValueType value) {
+            const control_block::info& hdu_info = hdus_control_block.hdus.at(hdu_index);
+            if (ExtensionsSupported::header_type::is_structural_keyword(keyword)) {
+                throw structural_keyword_exception(keyword);
+            }
+            open_for_update();
+
+            file_reader.set_reading_pos(hdu_info.header_location);
+            typename ExtensionsSupported::header_type hdu_header;
+            hdu_header.read_header(file_reader);
+
+            typename ExtensionsSupported::header_type::card_type new_card;
+            std::size_t card_position = 0;
+            std::string card_data;
+
+            if (hdu_header.contains_keyword(keyword)) {
+                hdu_header.set_value_of(keyword, value);
+                card_position = hdu_header.card_index(keyword);
+                card_data = hdu_header.get_card(card_position).raw_card().to_string();
+            }
+            else {
+                std::size_t header_capacity = (hdu_info.data_location - hdu_info.header_location) / 80;
+                card_position = hdu_header.card_count();
+                if (card_position + 2 > header_capacity) {
+                    throw header_space_exhausted_exception();
+                }
+
+                new_card.create_card(keyword, value);
+                hdu_header.add_card(new_card);
+                card_data = new_card.raw_card().to_string() + hdu_header.get_card(card_position + 1).raw_card().to_string();
+            }
+
+            if (!file_reader.write(card_data, hdu_info.header_location + card_position * 80)) {
+                throw file_writing_exception("Cannot write the card");
             }
+            file_reader.flush();
+
+            auto update_header = [&](typename ExtensionsSupported::header_type& held_header) {
+                if (held_header.contains_keyword(keyword)) { held_header.set_value_of(keyword, value); }
+                else { held_header.add_card(new_card); }
+            };
+            typename ExtensionsSupported::template header_visitor<decltype(update_header)> header_visit(update_header);
+            boost::apply_visitor(header_visit, hdu_list[hdu_info.hdu_index]);
+        }
+
+        /**
+         * @brief Updates a single field of a table HDU in place without rewriting the file
+         * @param[in] hdu_name Name of the table HDU ( the last one if several HDUs share the name )
+         * @param[in] column_name Name of the column containing the field
+         * @param[in] row Row number ( 0 based ) of the field
+         * @param[in] value New value of the field
+         * @throws wrong_extension_type If the HDU is not a table
+         * @note The table data held in memory ( if any ) is updated as well. The update counts as an access of the
+         *       HDU, so evicted data is read again within the memory budget before being updated
+        */
+        template<typename ValueType>
+        void update_cell(const std::string& hdu_name, const std::string& column_name, std::size_t row, ValueType value) {
+            update_cell(hdus_control_block.hdus_info.at(hdu_name).hdu_index, column_name, row, value);
         }
 
+        /**
+         * @brief Updates a single field of the table HDU at given index in place without rewriting the file
+         * @param[in] hdu_index Position of the table HDU in the file
+         * @param[in] column_name Name of the column containing the field
+         * @param[in] row Row number ( 0 based ) of the field
+         * @param[in] value New value of the field
+         * @throws std::out_of_range If there is no HDU at the given index
+         * @throws wrong_extension_type If the HDU is not a table
+        */
+        template<typename ValueType>
+        void update_cell(std::size_t hdu_index, const std::string& column_name, std::size_t row, ValueType value) {
+            const control_block::info& hdu_info = hdus_control_block.hdus.at(hdu_index);
+            open_for_update();
+
+            typename ExtensionsSupported::template cell_writer_visitor<FileReader, ValueType>
+                cell_writer(file_reader, hdu_info.data_location, column_name, row, value);
+            boost::apply_visitor(cell_writer, access_hdu(hdu_info.hdu_index));
+            file_reader.flush();
+        }
 
+        /**
+         * @brief Updates a contiguous range of pixels of an image HDU in place without rewriting the file
+         * @param[in] hdu_name Name of the image HDU ( the last one if several HDUs share the name )
+         * @param[in] first_pixel Position of the first pixel to be updated
+         * @param[in] pixels New values of the pixels
+         * @throws wrong_extension_type If the HDU does not contain an image
+         * @throws file_writing_exception If the HDU is an extension the HDU manager does not hold ( default_hdu_manager
+         *         holds no IMAGE extensions )
+         * @note The image data held in memory ( if any ) is updated as well. The update counts as an access of the
+         *       HDU, so evicted data is read again within the memory budget before being updated
+        */
+        template<typename PixelType>
+        void update_pixels(const std::string& hdu_name, std::size_t first_pixel, const std::vector<PixelType>& pixels) {
+            update_pixels(hdus_control_block.hdus_info.at(hdu_name).hdu_index, first_pixel, pixels);
+        }
 
+        /**
+         * @brief Updates a contiguous range of pixels of the image HDU at given index in place without rewriting the file
+         * @param[in] hdu_index Position of the image HDU in the file
+         * @param[in] first_pixel Position of the first pixel to be updated
+         * @param[in] pixels New values of the pixels
+         * @throws std::out_of_range If there is no HDU at the given index
+         * @throws wrong_extension_type If the HDU does not contain an image
+        */
+        template<typename PixelType>
+        void update_pixels(std::size_t hdu_index, std::size_t first_pixel, const std::vector<PixelType>& pixels) {
+            const control_block::info& hdu_info = hdus_control_block.hdus.at(hdu_index);
+            open_for_update();
+
+            typename ExtensionsSupported::template pixel_writer_visitor<FileReader, PixelType>
+                pixel_writer(file_reader, hdu_info.data_location, first_pixel, pixels);
+            boost::apply_visitor(pixel_writer, access_hdu(hdu_info.hdu_index));
+            file_reader.flush();
+        }
 
         /**
-         * @brief Returns the HDU at given index
+         * @brief Returns the HDU at given index ( reading its data again if it was evicted )
+         * @throws std::out_of_range If there is no HDU at the given index
         */
         typename ExtensionsSupported::Extension& operator [](int index) {
-            return hdu_list.at(index);
+            if (index < 0 || static_cast<std::size_t>(index) >= hdu_list.size()) {
+                throw std::out_of_range("No HDU at the given index");
+            }
+            return access_hdu(static_cast<std::size_t>(index));
         }
 
         /**
-         * @brief Returns the HDU based on the hdu_name 
+         * @brief Returns the HDU based on the hdu_name ( reading its data again if it was evicted )
         */
         typename ExtensionsSupported::Extension& operator [](const std::string& hdu_name) {
-            return hdu_list[hdus_control_block.hdus_info.at(hdu_name).hdu_index];
+            return access_hdu(hdus_control_block.hdus_info.at(hdu_name).hdu_index);
         }
 
         /**
          * @brief Returns the list of hdu objects associated with a FITS file
+         * @note Evicted HDUs are returned without their data
         */
         std::deque<typename ExtensionsSupported::Extension> get_hdu_list() const {
             return hdu_list;
@@ -172,33 +422,172 @@ namespace boost { namespace astronomy { namespace io {
             return hdus_control_block;
         }
 
+        /**
+         * @brief Returns the observer holding the measurements of reading
+        */
+        IoObserver& get_observer() { return observer; }
+
+        /**
+         * @brief Returns the observer holding the measurements of reading
+        */
+        const IoObserver& get_observer() const { return observer; }
+
 
     private:
+        /**
+         * @brief Records the access to an HDU, reading its data again if it was evicted
+        */
+        typename ExtensionsSupported::Extension& access_hdu(std::size_t index) {
+            if (index < cached_hdus.size()) {
+                cached_data& entry = cached_hdus[index];
+                if (entry.state == data_state::resident) {
+                    cache_statistics.hits++;
+                    entry.last_use = ++use_clock;
+                }
+                else if (entry.state == data_state::evicted) {
+                    cache_statistics.misses++;
+                    hdu_list[index] = reread_hdu(index);
+                    entry.state = data_state::resident;
+                    entry.last_use = ++use_clock;
+                    cache_statistics.resident_bytes += entry.size;
+                    enforce_memory_budget(index);
+                }
+            }
+            return hdu_list[index];
+        }
+
+        /**
+         * @brief Starts tracking the data of a newly read HDU ( HDUs without a header or data are not tracked )
+        */
+        void cache_read_data(std::size_t index, std::size_t size) {
+            cached_data entry;
+            if (size != 0 && has_header(hdu_list[index])) {
+                entry.state = data_state::resident;
+                entry.size = size;
+                entry.last_use = ++use_clock;
+                cache_statistics.resident_bytes += size;
+            }
+            cached_hdus.push_back(entry);
+            enforce_memory_budget(index);
+        }
+
+        /**
+         * @brief Evicts the least recently used HDUs other than keep until the data held fits in the budget
+        */
+        void enforce_memory_budget(std::size_t keep) {
+            while (budget_bytes != 0 && cache_statistics.resident_bytes > budget_bytes) {
+                std::size_t victim = cached_hdus.size();
+                for (std::size_t i = 0; i < cached_hdus.size(); i++) {
+                    if (i == keep || cached_hdus[i].state != data_state::resident) { continue; }
+                    if (victim == cached_hdus.size() || cached_hdus[i].last_use < cached_hdus[victim].last_use) {
+                        victim = i;
+                    }
+                }
+                if (victim == cached_hdus.size()) { break; }
+
+                typename ExtensionsSupported::header_type victim_header = held_header(victim);
+                hdu_list[victim] = ExtensionsSupported::construct_hdu(victim_header, "");
+                cached_hdus[victim].state = data_state::evicted;
+                cache_statistics.resident_bytes -= cached_hdus[victim].size;
+                cache_statistics.evictions++;
+            }
+        }
+
+        /**
+         * @brief Reads the data unit of an HDU again using the offset recorded in the control block
+         * @throws file_reading_exception If the data unit cannot be read completely
+        */
+        typename ExtensionsSupported::Extension reread_hdu(std::size_t index) {
+            typename ExtensionsSupported::header_type hdu_header = held_header(index);
+            std::size_t data_location = hdus_control_block.hdus[index].data_location;
+            file_reader.set_reading_pos(data_location);
+            // The stream pads short reads, so the data unit is checked against the file before reading it
+            if (data_location + hdu_header.data_unit_size() > file_reader.file_size()) {
+                throw file_reading_exception("Cannot read the data unit of the HDU again");
+            }
+            std::string hdu_data = file_reader.read(cached_hdus[index].size);
+            return ExtensionsSupported::construct_hdu(hdu_header, hdu_data);
+        }
+
+        /**
+         * @brief Returns a copy of the header held in memory for the HDU at given index
+        */
+        typename ExtensionsSupported::header_type held_header(std::size_t index) {
+            typename ExtensionsSupported::header_type hdu_header;
+            auto copy_header = [&hdu_header](typename ExtensionsSupported::header_type& held) { hdu_header = held; };
+            typename ExtensionsSupported::template header_visitor<decltype(copy_header)> header_visit(copy_header);
+            boost::apply_visitor(header_visit, hdu_list[index]);
+            return hdu_header;
+        }
+
+        static bool has_header(typename ExtensionsSupported::Extension& hdu) {
+            bool found = false;
+            auto mark_found = [&found](typename ExtensionsSupported::header_type&) { found = true; };
+            typename ExtensionsSupported::template header_visitor<decltype(mark_found)> header_visit(mark_found);
+            boost::apply_visitor(header_visit, hdu);
+            return found;
+        }
+
+        /**
+         * @brief Reopens the file associated with the reader for updating its contents in place
+        */
+        void open_for_update() {
+            if (!opened_for_update) {
+                file_reader.set_file_for_update(hdus_control_block.filepath);
+                opened_for_update = true;
+            }
+        }
+
+        /**
+         * @brief Moves the file pointer to the given position and reports the seek to the observer
+         * @note  Only jumps over unread bytes are reported, stepping over the padding that ends a header or
+         *        data unit continues the sequential reading and moves the file pointer directly
+        */
+        void seek_to(std::size_t position) {
+            observer.seeked(position);
+            file_reader.set_reading_pos(position);
+        }
+
         /**
          * @brief Extracts the header from the FITS file
         */
         typename ExtensionsSupported::header_type extract_header() {
             typename ExtensionsSupported::header_type hdu_header;
+            phase_recorder<IoObserver> header_phase(observer, io_phase::header_parse);
+            auto header_start = file_reader.get_current_pos();
             hdu_header.read_header(file_reader);
+            header_phase.finish(file_reader.get_current_pos() - header_start);
             file_reader.set_unit_end();
             return hdu_header;
         }
 
         /**
          * @brief Extracts the data associated with a perticular HDU from the FITS file
+         * @details The heap of tables ( PCOUNT ) is not decoded, the file pointer skips it to the next HDU
          * @param[in] hdu_header Header information related to the current HDU
         */
         std::string extract_data_buffer(typename ExtensionsSupported::header_type& hdu_header) {
-            if (hdu_header.data_size() == 0) {
-                return "";
-            }
-            else {
+            std::size_t data_location = file_reader.get_current_pos();
+            std::size_t data_unit_size = hdu_header.data_unit_size();
+            std::string data_buffer;
+            if (hdu_header.data_size() != 0) {
                 auto total_elements = hdu_header.data_size();
                 auto element_size = get_element_size_from_bitpix(hdu_header.bitpix());
-                std::string data_buffer = file_reader.read(total_elements * element_size);
-                file_reader.set_unit_end();
-                return data_buffer;
+                phase_recorder<IoObserver> data_phase(observer, io_phase::data_read);
+                data_buffer = file_reader.read(total_elements * element_size);
+                data_phase.finish(data_buffer.size());
             }
+
+            if (data_unit_size > data_buffer.size()) { seek_to(logical_record_end(data_location + data_unit_size)); }
+            else { file_reader.set_unit_end(); }
+            return data_buffer;
+        }
+
+        /**
+         * @brief Returns the start of the logical record following position ( position itself at a boundary )
+        */
+        static std::size_t logical_record_end(std::size_t position) {
+            return (position + 2879) / 2880 * 2880;
         }
     };
 }}}
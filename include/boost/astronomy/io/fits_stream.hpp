@@ -38,6 +38,21 @@ namespace boost {namespace astronomy {namespace io {
             }
         }
 
+        /**
+         * @brief Opens an existing file for both reading and writing without truncating it
+         * @param[in] path Location of the file
+         * @throw file_reading_exception
+         * @note Used for updating the contents of a file in place
+        */
+        void set_file_for_update(const std::string& path) {
+            this->file.close();
+            this->file.clear();
+            this->file.open(path, std::ios::binary | std::ios::in | std::ios::out);
+            if (!this->file.good()) {
+                throw file_reading_exception("Cannot Open File For Update");
+            }
+        }
+
         /**
          * @brief Creates an empty file for reading/writing in the path specified
          * @param[in] path The path where the file needs to be created
@@ -45,7 +60,7 @@ namespace boost {namespace astronomy {namespace io {
         bool create_file(const std::string& path) {
             this->file.close();
             this->file.clear();
-            this->file.open(path, std::ios::in | std::ios::out | std::ios::trunc);
+            this->file.open(path, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
             return this->file.good();
         }
 
@@ -82,6 +97,17 @@ namespace boost {namespace astronomy {namespace io {
             return this->file.tellg();
         }
 
+        /**
+         * @brief Returns the size of the file in bytes without changing the reading position
+        */
+        std::size_t file_size() {
+            auto current_pos = this->file.tellg();
+            this->file.seekg(0, std::ios::end);
+            std::size_t size = this->file.tellg();
+            this->file.seekg(current_pos);
+            return size;
+        }
+
         /**
          * @brief Writes the data to the file at the current file pointer position
          * @param[in] data Data to be written into file
@@ -97,9 +123,19 @@ namespace boost {namespace astronomy {namespace io {
          * @param[in] data Data to be written into file
         */
         bool write(const std::string& data,std::size_t position) {
+            return write(data.c_str(), data.size(), position);
+        }
+
+        /**
+         * @brief Writes size bytes starting at data to the file at the given position
+         * @param[in] data Start of the bytes to be written
+         * @param[in] size Number of bytes
+         * @param[in] position Offset in the file where the bytes are written
+        */
+        bool write(const char* data, std::size_t size, std::size_t position) {
             this->file.seekp(position);
             if (this->file.good()) {
-                this->file.write(data.c_str(), sizeof(char) * data.size());
+                this->file.write(data, static_cast<std::streamsize>(size));
             }
             return this->file.good();
         }
@@ -122,6 +158,14 @@ namespace boost {namespace astronomy {namespace io {
             return (this->file.peek(), this->file.eof());
         }
 
+        /**
+         * @brief Flushes all the pending writes to the file
+        */
+        bool flush() {
+            this->file.flush();
+            return this->file.good();
+        }
+
         /**
          * @brief Closes the file if opened
         */
@@ -143,12 +187,13 @@ namespace boost {namespace astronomy {namespace io {
 
         /**
          * @brief Finds the end of current logical record ( or beginning of next record )
+         * @note  If the file pointer is already at the boundary of a logical record its position is returned
         */
         std::size_t find_unit_end() {
             std::size_t current_pos = this->file.tellg();
             std::size_t logical_record_size = 2880;
 
-            std::size_t offset = logical_record_size - (current_pos % logical_record_size);
+            std::size_t offset = (logical_record_size - (current_pos % logical_record_size)) % logical_record_size;
             std::size_t newpos = (current_pos + offset);
             return newpos;
         }
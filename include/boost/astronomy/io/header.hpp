@@ -9,11 +9,15 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #ifndef BOOST_ASTRONOMY_IO_HDU_HPP
 #define BOOST_ASTRONOMY_IO_HDU_HPP
 
+#include <algorithm>
+#include <array>
 #include <string>
 #include <vector>
 #include <cstddef>
-#include <unordered_map>
+#include <functional>
 #include <memory>
+#include <numeric>
+#include <stdexcept>
 #include <fstream>
 
 #include <boost/algorithm/string/trim.hpp>
@@ -31,7 +35,10 @@ namespace boost { namespace astronomy { namespace io {
 /**
  * @brief   Used to store Header Related Information of FITS HDU ( Header Data Unit )
  * @details This structure also provides additional methods for querying some of the common but important keyword values
- *          along with a general function ( value_of ) for querying the value associated with any  keyword in an HDU
+ *          along with a general function ( value_of ) for querying the value associated with any  keyword in an HDU.
+ *          The raw logical records of the header are kept in a single contiguous arena and the cards are addressed
+ *          by their position in it. The arena is shared between the copies of a header and is copied only when
+ *          one of them is modified, so copying a header costs no more than copying a pointer
  * @author  Pranam Lashkari
  * @author  Sarthak Singhal
  * @note    To learn more about HDU please refer
@@ -40,74 +47,114 @@ namespace boost { namespace astronomy { namespace io {
 template<typename CardPolicy>
 struct header
 {
+public:
+    typedef card<CardPolicy> card_type;
+
 protected:
-    boost::astronomy::io::bitpix bitpix_value; //! stores the BITPIX value (enum bitpix)
-    std::vector<std::size_t> naxis_; //! values of all naxis (NAXIS, NAXIS1, NAXIS2...)
-    std::string hdu_name;
+    //! Entry of the keyword index, keyword is stored as in the card ( padded with blanks to 8 characters )
+    struct keyword_entry {
+        std::array<char, 8> keyword;
+        std::size_t index;
+    };
+
+    //! Storage shared between the copies of a header
+    struct header_storage {
+        boost::astronomy::io::bitpix bitpix_value = io::bitpix::B8; //! stores the BITPIX value (enum bitpix)
+        std::vector<std::size_t> naxis_; //! values of all naxis (NAXIS, NAXIS1, NAXIS2...)
+
+        //! Raw logical records of the header, the cards following END are blank
+        std::string records;
 
-    //! Stores the each card in header unit (80 char key value pair)
-    std::vector<card<CardPolicy>> cards;
+        //! Number of cards in use ( including the END card )
+        std::size_t total_cards = 0;
 
-    //! stores the card-key index (used for faster searching)
-    std::unordered_map<std::string, std::size_t> key_index;
+        //! Position of the END card ( npos if header has no END card yet )
+        std::size_t end_index = std::string::npos;
+
+        //! card-key index sorted by keyword ( used for faster searching )
+        std::vector<keyword_entry> key_index;
+    };
+
+    std::shared_ptr<header_storage> storage;
 
 public:
 
    /**
      * @todo Take note of whether to make it templated or not
     */
-   bool operator == (const header& other) {
-       return bitpix_value == other.bitpix_value &&
-           this->naxis_ == other.naxis_ &&
-           this->hdu_name == other.hdu_name &&
-           this->cards == other.cards &&
-           this->key_index == other.key_index;
+   bool operator == (const header& other) const {
+       const header_storage& lhs = get_storage();
+       const header_storage& rhs = other.get_storage();
+       return lhs.bitpix_value == rhs.bitpix_value &&
+           lhs.naxis_ == rhs.naxis_ &&
+           lhs.total_cards == rhs.total_cards &&
+           lhs.records.compare(0, lhs.total_cards * 80, rhs.records, 0, rhs.total_cards * 80) == 0;
    }
 
     /**
      * @brief Reads the header portion of an HDU using file reader
+     * @details The header is read one logical record ( 2880 bytes ) at a time until the END card is found,
+     *          leaving the file reader at the end of the last header record
      * @param[in] file_reader Reader used to access the FITS file
+     * @throws fits_exception If the file ends before the END card or BITPIX has an invalid value
+     * @throws invalid_card If any card of the header is not valid
     */
     template<typename FileReader>
     void read_header(FileReader& file_reader) {
+        auto new_storage = std::make_shared<header_storage>();
+        header_storage& hdu_storage = *new_storage;
 
-        cards.reserve(36); //reserves the space of atleast 1 HDU unit
-        std::string card_buffer;
-
-        //reading file card by card until END card is found
-        while (true)
+        //reading file record by record until END card is found
+        while (hdu_storage.end_index == std::string::npos)
         {
-            //read from file and create push card into the vector
-            card_buffer = file_reader.read(80);
-            cards.emplace_back(card_buffer);
+            if (file_reader.at_end()) {
+                throw fits_exception();
+            }
 
-            //store the index of the card in map
-            this->key_index[this->cards.back().keyword()] = this->cards.size() - 1;
+            std::size_t record_start = hdu_storage.records.size();
+            hdu_storage.records.append(file_reader.read(logical_record_size));
 
-            //check if end card is found
-            if (this->cards.back().keyword(true) == "END     ")
+            for (std::size_t offset = record_start; offset < hdu_storage.records.size(); offset += 80)
             {
-                break;
+                // validates the card
+                card_type header_card(boost::string_view(hdu_storage.records).substr(offset, 80));
+
+                hdu_storage.key_index.push_back(make_entry(header_card.raw_card(), hdu_storage.total_cards));
+                hdu_storage.total_cards++;
+
+                //check if end card is found
+                if (header_card.raw_card().substr(0, 8) == "END     ")
+                {
+                    hdu_storage.end_index = hdu_storage.total_cards - 1;
+                    // Rest of the record is padding
+                    std::fill(hdu_storage.records.begin() + offset + 80, hdu_storage.records.end(), ' ');
+                    break;
+                }
             }
         }
-        //finding and storing bitpix value
 
-        switch (cards[key_index["BITPIX"]]. template value<int>())
+        std::stable_sort(hdu_storage.key_index.begin(), hdu_storage.key_index.end(),
+            [](const keyword_entry& lhs, const keyword_entry& rhs) { return lhs.keyword < rhs.keyword; });
+
+        storage = std::move(new_storage);
+
+        //finding and storing bitpix value
+        switch (value_of<int>("BITPIX"))
         {
         case 8:
-            this->bitpix_value = io::bitpix::B8;
+            hdu_storage.bitpix_value = io::bitpix::B8;
             break;
         case 16:
-            this->bitpix_value = io::bitpix::B16;
+            hdu_storage.bitpix_value = io::bitpix::B16;
             break;
         case 32:
-            this->bitpix_value = io::bitpix::B32;
+            hdu_storage.bitpix_value = io::bitpix::B32;
             break;
         case -32:
-            this->bitpix_value = io::bitpix::_B32;
+            hdu_storage.bitpix_value = io::bitpix::_B32;
             break;
         case -64:
-            this->bitpix_value = io::bitpix::_B64;
+            hdu_storage.bitpix_value = io::bitpix::_B64;
             break;
         default:
             throw fits_exception();
@@ -115,34 +162,32 @@ public:
         }
 
         //setting naxis values
-        std::size_t total_dimensions = cards[key_index["NAXIS"]].template value<std::size_t>();
-        naxis_.reserve(total_dimensions);
+        std::size_t total_dimensions = value_of<std::size_t>("NAXIS");
+        hdu_storage.naxis_.reserve(total_dimensions);
 
         for (std::size_t i = 1; i <= total_dimensions; i++)
         {
-            naxis_.emplace_back(cards[key_index["NAXIS" +
-                boost::lexical_cast<std::string>(i)]].template value<std::size_t>());
+            hdu_storage.naxis_.emplace_back(value_of<std::size_t>("NAXIS" + boost::lexical_cast<std::string>(i)));
         }
 
     }
 
     /**
      * @brief Writes the entire HDU header into the file
+     * @details The arena already holds whole logical records, so the header is written with a single write
      * @param[in] file_writer  File Writer object for facilitating the writing of data
      * @tparam FileWriter Type of file_writer object
     */
     template<typename FileWriter>
     void write_header(FileWriter& file_writer) {
-        std::string temp_buffer;
-        for (auto& header_card : this->cards) {
-            temp_buffer += header_card.raw_card();
-            
-        }
-        file_writer.write(temp_buffer);
-        auto current_write_pos = file_writer.get_current_pos();
-        auto logical_record_end_pos = file_writer.find_unit_end();
+        file_writer.write(get_storage().records);
+    }
 
-        file_writer.write(std::string(logical_record_end_pos - current_write_pos, ' '));
+    /**
+     * @brief Returns the raw logical records of the header ( padded with blanks )
+    */
+    const std::string& raw_records() const {
+        return get_storage().records;
     }
 
     /**
@@ -150,12 +195,9 @@ public:
     */
     std::string get_hdu_name() {
         // Check if its a extension
-        try {
-
-            hdu_name = value_of < std::string>("XTENSION");
-            return hdu_name;
+        if (contains_keyword("XTENSION")) {
+            return value_of<std::string>("XTENSION");
         }
-        catch (...) {}
 
         // Test if its primary header ( otherwise exception propagated)
         value_of<bool>("SIMPLE");
@@ -166,11 +208,8 @@ public:
      * @brief Searches for the given keyword  is present in the Header
      * @param[in] keyword Keyword to be searched for 
     */
-    bool contains_keyword(const std::string& keyword) {
-        auto keyword_found = std::find_if(cards.begin(), cards.end(), [&keyword](const card<CardPolicy>& h_card) {
-            return h_card.keyword() == keyword;
-            });
-        return keyword_found != cards.end();
+    bool contains_keyword(const std::string& keyword) const {
+        return find_card(keyword) != std::string::npos;
     }
 
     /**
@@ -179,7 +218,7 @@ public:
     */
     io::bitpix bitpix() const
     {
-        return this->bitpix_value;
+        return get_storage().bitpix_value;
     }
 
     /**
@@ -188,7 +227,7 @@ public:
     */
     std::vector<std::size_t> all_naxis() const
     {
-        return this->naxis_;
+        return get_storage().naxis_;
     }
 
     /**
@@ -197,21 +236,67 @@ public:
     */
     std::size_t naxis(std::size_t n = 0) const
     {
-        return this->naxis_[n - 1]; // 1 Based indexing
+        return get_storage().naxis_[n - 1]; // 1 Based indexing
     }
 
     /**
      * @brief       Returns the total number of dimensions of an HDU data
     */
-    std::size_t total_dimensions() const { return all_naxis().size(); }
+    std::size_t total_dimensions() const { return get_storage().naxis_.size(); }
 
 
     /**
      * @brief   Returns the total number of elements in HDU data
     */
-    std::size_t data_size() {
-        if (naxis_.empty()) { return 0; }
-        return std::accumulate(naxis_.begin(), naxis_.end(), static_cast<std::size_t > (1), std::multiplies<std::size_t>());
+    std::size_t data_size() const {
+        const std::vector<std::size_t>& naxis_values = get_storage().naxis_;
+        if (naxis_values.empty()) { return 0; }
+        return std::accumulate(naxis_values.begin(), naxis_values.end(), static_cast<std::size_t > (1), std::multiplies<std::size_t>());
+    }
+
+    /**
+     * @brief   Returns the size of the data unit in bytes ( excluding the padding of the last logical record )
+     * @details Unlike data_size this includes the heap of tables ( PCOUNT ) and the groups of random groups
+     *          ( GCOUNT ), so it gives the exact distance between the end of the header and the next HDU
+    */
+    std::size_t data_unit_size() const {
+        const std::vector<std::size_t>& naxis_values = get_storage().naxis_;
+        if (naxis_values.empty()) { return 0; }
+
+        std::size_t pcount = contains_keyword("PCOUNT") ? value_of<std::size_t>("PCOUNT") : 0;
+        std::size_t gcount = contains_keyword("GCOUNT") ? value_of<std::size_t>("GCOUNT") : 1;
+
+        // First axis of random groups ( NAXIS1 = 0 ) does not count
+        bool random_groups = contains_keyword("GROUPS") && value_of<bool>("GROUPS");
+        std::size_t elements = std::accumulate(naxis_values.begin() + (random_groups ? 1 : 0), naxis_values.end(),
+            static_cast<std::size_t>(1), std::multiplies<std::size_t>());
+
+        return static_cast<std::size_t>(get_element_size_from_bitpix(get_storage().bitpix_value)) * gcount * (pcount + elements);
+    }
+
+    /**
+     * @brief   Checks whether the keyword describes the layout of the HDU
+     * @details SIMPLE, XTENSION, BITPIX, NAXIS, NAXISn, PCOUNT, GCOUNT, GROUPS, TFIELDS, TFORMn, TBCOLn, THEAP and END
+     *          locate the data unit and its fields, so changing one of them without rewriting the data unit leaves
+     *          the data inconsistent with the header
+     * @param[in] keyword Keyword without trailing blanks
+    */
+    static bool is_structural_keyword(const std::string& keyword) {
+        static const char* fixed_keywords[] = { "SIMPLE", "XTENSION", "BITPIX", "NAXIS", "PCOUNT", "GCOUNT", "GROUPS",
+            "TFIELDS", "THEAP", "END" };
+        for (const char* fixed_keyword : fixed_keywords) {
+            if (keyword == fixed_keyword) { return true; }
+        }
+
+        for (const char* indexed_keyword : { "NAXIS", "TFORM", "TBCOL" }) {
+            std::size_t prefix_length = std::char_traits<char>::length(indexed_keyword);
+            if (keyword.size() > prefix_length && keyword.compare(0, prefix_length, indexed_keyword) == 0 &&
+                std::all_of(keyword.begin() + static_cast<std::ptrdiff_t>(prefix_length), keyword.end(),
+                    [](char c) { return c >= '0' && c <= '9'; })) {
+                return true;
+            }
+        }
+        return false;
     }
 
     /**
@@ -219,26 +304,202 @@ public:
      * @param[in]   key Keyword whose value is to be queried
      * @tparam      ReturnType The type in which the value associated with the keyword needs to be obtained
      * @return      Returns the value associated with keyword in the required type
+     * @throws      std::out_of_range If the keyword is not present in the header
      * @throws      boost::bad_lexical_cast If the conversion of value to the specific type was not successul
     */
     template <typename ReturnType>
-    ReturnType value_of(std::string const& key)// const
+    ReturnType value_of(std::string const& key) const
+    {
+        return get_card(card_index(key)).template value<ReturnType>();
+    }
+
+    /**
+     * @brief       Sets the value associated with a perticular keyword
+     * @param[in]   key Keyword whose value is to be updated
+     * @param[in]   value New value of the keyword
+     * @throws      std::out_of_range If the keyword is not present in the header
+     * @throws      invalid_card If the value does not fit in the card
+    */
+    template <typename ValueType>
+    void set_value_of(std::string const& key, ValueType value)
     {
-        return this->cards[key_index.at(key)].template value<ReturnType>();
+        std::size_t index = card_index(key);
+        card_type updated_card = get_card(index);
+        updated_card.set_value(value);
+        store_card(get_mutable_storage(), index, updated_card);
+    }
+
+    /**
+     * @brief       Inserts a new card just before the END card of the header
+     * @details     The END card is moved to the next free slot, a new logical record is added to the
+     *              arena only if the last one is full
+     * @param[in]   new_card Card to be inserted
+    */
+    void add_card(card<CardPolicy> const& new_card)
+    {
+        header_storage& hdu_storage = get_mutable_storage();
+        std::size_t index = hdu_storage.total_cards;
+
+        if (hdu_storage.total_cards * 80 == hdu_storage.records.size()) {
+            hdu_storage.records.append(logical_record_size, ' ');
+        }
+
+        if (hdu_storage.end_index != std::string::npos) {
+            index = hdu_storage.end_index;
+            std::copy_n(hdu_storage.records.begin() + index * 80, 80, hdu_storage.records.begin() + (index + 1) * 80);
+            hdu_storage.end_index++;
+            for (auto& entry : hdu_storage.key_index) {
+                if (entry.index == index) { entry.index = hdu_storage.end_index; }
+            }
+        }
+        else if (new_card.raw_card().substr(0, 8) == "END     ") {
+            hdu_storage.end_index = index;
+        }
+
+        store_card(hdu_storage, index, new_card);
+        hdu_storage.total_cards++;
+
+        keyword_entry entry = make_entry(new_card.raw_card(), index);
+        auto position = std::upper_bound(hdu_storage.key_index.begin(), hdu_storage.key_index.end(), entry,
+            [](const keyword_entry& lhs, const keyword_entry& rhs) { return lhs.keyword < rhs.keyword; });
+        hdu_storage.key_index.insert(position, entry);
+    }
+
+    /**
+     * @brief       Replaces the card present at the given position in the header
+     * @param[in]   index Position of the card ( 0 based )
+     * @param[in]   new_card Card replacing the existing one
+     * @throws      std::out_of_range If there is no card at the given position
+    */
+    void set_card(std::size_t index, card<CardPolicy> const& new_card)
+    {
+        if (index >= get_storage().total_cards) {
+            throw std::out_of_range("card index is out of range");
+        }
+
+        header_storage& hdu_storage = get_mutable_storage();
+        keyword_entry entry = make_entry(new_card.raw_card(), index);
+        auto by_keyword = [](const keyword_entry& lhs, const keyword_entry& rhs) { return lhs.keyword < rhs.keyword; };
+
+        auto old_entry = std::find_if(hdu_storage.key_index.begin(), hdu_storage.key_index.end(),
+            [index](const keyword_entry& existing) { return existing.index == index; });
+        if (old_entry->keyword != entry.keyword) {
+            hdu_storage.key_index.erase(old_entry);
+            // Entries of same keyword must remain in the order of their position
+            auto position = std::upper_bound(hdu_storage.key_index.begin(), hdu_storage.key_index.end(), entry, by_keyword);
+            while (position != hdu_storage.key_index.begin() && (position - 1)->keyword == entry.keyword &&
+                (position - 1)->index > index) {
+                --position;
+            }
+            hdu_storage.key_index.insert(position, entry);
+        }
+
+        store_card(hdu_storage, index, new_card);
+    }
+
+    /**
+     * @brief       Returns the position of the card associated with the keyword
+     * @details     The byte offset of the card from the start of the header is position * 80
+     * @param[in]   key Keyword whose position is to be queried
+     * @throws      std::out_of_range If the keyword is not present in the header
+    */
+    std::size_t card_index(std::string const& key) const
+    {
+        std::size_t index = find_card(key);
+        if (index == std::string::npos) {
+            throw std::out_of_range("keyword " + key + " is not present in the header");
+        }
+        return index;
+    }
+
+    /**
+     * @brief       Returns the card present at the given position in the header
+     * @param[in]   index Position of the card ( 0 based )
+     * @throws      std::out_of_range If there is no card at the given position
+    */
+    card_type get_card(std::size_t index) const
+    {
+        const header_storage& hdu_storage = get_storage();
+        if (index >= hdu_storage.total_cards) {
+            throw std::out_of_range("card index is out of range");
+        }
+        return card_type(boost::string_view(hdu_storage.records).substr(index * 80, 80));
     }
 
     /**
      * @brief      Gets the number of cards in HDU header
      * @return     total number of cards in HDU header
     */
-    std::size_t card_count() {
-        return cards.size() - 1; // Last one is END Card ( It will not be counted )
+    std::size_t card_count() const {
+        return get_storage().total_cards - 1; // Last one is END Card ( It will not be counted )
+
+    }
+
+private:
+    static constexpr std::size_t logical_record_size = 2880;
+
+    /**
+     * @brief Returns the storage of the header ( an empty one for default constructed headers )
+    */
+    const header_storage& get_storage() const {
+        static const header_storage empty_storage;
+        return storage ? *storage : empty_storage;
+    }
+
+    /**
+     * @brief Returns the storage for modification, copying it first if it is shared with other headers
+    */
+    header_storage& get_mutable_storage() {
+        if (!storage) {
+            storage = std::make_shared<header_storage>();
+        }
+        else if (storage.use_count() > 1) {
+            storage = std::make_shared<header_storage>(*storage);
+        }
+        return *storage;
+    }
 
+    /**
+     * @brief Copies the content of card into the slot of arena at the given position
+    */
+    static void store_card(header_storage& hdu_storage, std::size_t index, const card_type& header_card) {
+        auto raw_card = header_card.raw_card();
+        hdu_storage.records.replace(index * 80, 80, raw_card.data(), raw_card.size());
     }
 
-    friend bool operator == (const header<CardPolicy>& lhs, const header<CardPolicy>& rhs);
+    /**
+     * @brief Creates the index entry for the card present at the given position
+    */
+    static keyword_entry make_entry(boost::string_view raw_card, std::size_t index) {
+        keyword_entry entry;
+        std::copy(raw_card.begin(), raw_card.begin() + 8, entry.keyword.begin());
+        entry.index = index;
+        return entry;
+    }
 
+    /**
+     * @brief Returns the position of the last card with the given keyword ( npos if not found )
+    */
+    std::size_t find_card(boost::string_view key) const {
+        if (key.length() > 8) { return std::string::npos; }
+
+        keyword_entry search_entry;
+        search_entry.keyword.fill(' ');
+        std::copy(key.begin(), key.end(), search_entry.keyword.begin());
+
+        const std::vector<keyword_entry>& key_index = get_storage().key_index;
+        auto position = std::upper_bound(key_index.begin(), key_index.end(), search_entry,
+            [](const keyword_entry& lhs, const keyword_entry& rhs) { return lhs.keyword < rhs.keyword; });
+        if (position == key_index.begin() || (position - 1)->keyword != search_entry.keyword) {
+            return std::string::npos;
+        }
+        return (position - 1)->index;
+    }
 };
+
+template<typename CardPolicy>
+constexpr std::size_t header<CardPolicy>::logical_record_size;
+
 }}} //namespace boost::astronomy::io
 
 #endif // !BOOST_ASTRONOMY_IO_HDU_HPP
@@ -0,0 +1,212 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_HEADER_EDITOR_HPP
+#define BOOST_ASTRONOMY_IO_HEADER_EDITOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <vector>
+
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/io/default_card_policy.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/io/parallel.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief Outcome of editing the header of a single file
+*/
+struct header_edit_result {
+    std::string path;
+    bool success = false;
+    bool in_place = false;           //! The edits fitted in the existing header records
+    std::size_t records_inserted = 0; //! Number of logical records by which the rest of the file was shifted
+    std::string error;               //! Reason of failure when success is false
+};
+
+/**
+ * @brief   Edits the header of an HDU in existing FITS files without rewriting their data
+ * @details The edits are applied to the header read from the file. If the edited header still fits in the
+ *          logical records it occupied, only the header is written back. Otherwise everything following
+ *          the header is shifted towards the end of file by whole logical records ( copying chunk_bytes at a
+ *          time, starting from the end ) and the grown header is written in the space made.
+ *          A card whose keyword is already present replaces it, COMMENT, HISTORY and blank cards and cards
+ *          with new keywords are added just before END
+ * @tparam  FileStream Stream used for reading and writing the file ( e.g fits_stream )
+ * @tparam  CardPolicy Policy of the header cards
+ * @note    Shifting the data is not atomic, a failure during it leaves the file damaged
+ * @author  agent
+*/
+template<typename FileStream, typename CardPolicy>
+class basic_header_editor {
+public:
+    typedef card<CardPolicy> card_type;
+
+private:
+    std::vector<card_type> edits;
+    std::size_t chunk_size;
+
+public:
+    /**
+     * @brief Creates an editor without any edits
+     * @param[in] chunk_bytes Amount of data copied at once when the data needs to be shifted
+    */
+    explicit basic_header_editor(std::size_t chunk_bytes = 2880 * 364) :chunk_size(std::max<std::size_t>(chunk_bytes, 1)) {}
+
+    /**
+     * @brief Adds a card to be set in the header
+     * @details A later card with the same keyword ( other than commentary keywords ) replaces the earlier one
+     * @param[in] new_card Card to be set
+     * @throws structural_keyword_exception If the keyword describes the layout of the HDU ( BITPIX, NAXISn ... ),
+     *         since the data unit is never rewritten to match
+    */
+    basic_header_editor& set_card(card_type const& new_card) {
+        if (header<CardPolicy>::is_structural_keyword(new_card.keyword())) {
+            throw structural_keyword_exception(new_card.keyword());
+        }
+        if (!is_commentary(new_card)) {
+            auto existing = std::find_if(edits.begin(), edits.end(), [&new_card](const card_type& edit) {
+                return edit.keyword() == new_card.keyword();
+            });
+            if (existing != edits.end()) {
+                *existing = new_card;
+                return *this;
+            }
+        }
+        edits.push_back(new_card);
+        return *this;
+    }
+
+    /**
+     * @brief Adds a card with given keyword, value and comment to be set in the header
+     * @throws invalid_card If the card cannot be created from the arguments
+     * @throws structural_keyword_exception If the keyword describes the layout of the HDU
+    */
+    template<typename ValueType>
+    basic_header_editor& set_value(std::string const& key, ValueType value, std::string const& comment = "") {
+        card_type new_card;
+        new_card.create_card(key, value, comment);
+        return set_card(new_card);
+    }
+
+    /**
+     * @brief Returns the number of cards to be set
+    */
+    std::size_t total_edits() const { return edits.size(); }
+
+    /**
+     * @brief Applies the edits to the header of an HDU in the file
+     * @param[in] path Path of the FITS file
+     * @param[in] hdu_index Position of the HDU in the file ( 0 for primary HDU )
+     * @throws file_reading_exception If the file cannot be opened for update
+     * @throws fits_exception If the file does not contain the HDU
+    */
+    header_edit_result apply(std::string const& path, std::size_t hdu_index = 0) const {
+        header_edit_result result;
+        result.path = path;
+
+        FileStream file;
+        file.set_file_for_update(path);
+
+        std::size_t header_location = 0;
+        header<CardPolicy> hdu_header;
+        for (std::size_t index = 0; ; index++) {
+            file.set_reading_pos(header_location);
+            hdu_header.read_header(file);
+            if (index == hdu_index) { break; }
+            header_location += hdu_header.raw_records().size() + padded_size(hdu_header.data_unit_size());
+        }
+
+        std::size_t original_size = hdu_header.raw_records().size();
+        for (auto const& edit : edits) {
+            if (!is_commentary(edit) && hdu_header.contains_keyword(edit.keyword())) {
+                hdu_header.set_card(hdu_header.card_index(edit.keyword()), edit);
+            }
+            else {
+                hdu_header.add_card(edit);
+            }
+        }
+
+        std::size_t edited_size = hdu_header.raw_records().size();
+        if (edited_size > original_size) {
+            shift_tail(file, header_location + original_size, edited_size - original_size);
+        }
+
+        if (!file.write(hdu_header.raw_records(), header_location)) {
+            throw file_writing_exception("Cannot write the header");
+        }
+        file.flush();
+
+        result.success = true;
+        result.in_place = edited_size == original_size;
+        result.records_inserted = (edited_size - original_size) / 2880;
+        return result;
+    }
+
+    /**
+     * @brief Applies the edits to the header of an HDU in all the files using multiple threads
+     * @details Failures are reported in the result of the file instead of being thrown
+     * @param[in] paths Paths of the FITS files
+     * @param[in] hdu_index Position of the HDU in the files ( 0 for primary HDU )
+     * @param[in] threads Number of threads to use ( 0 uses the number of hardware threads )
+     * @return Result of each file in the same order as paths
+    */
+    std::vector<header_edit_result> apply_all(std::vector<std::string> const& paths, std::size_t hdu_index = 0,
+        std::size_t threads = 0) const {
+
+        std::vector<header_edit_result> results(paths.size());
+        detail::run_parallel(paths.size(), threads, [&](std::size_t i) {
+            try {
+                results[i] = apply(paths[i], hdu_index);
+            }
+            catch (std::exception& e) {
+                results[i].path = paths[i];
+                results[i].error = e.what();
+            }
+        });
+        return results;
+    }
+
+private:
+    static bool is_commentary(card_type const& header_card) {
+        std::string keyword = header_card.keyword();
+        return keyword.empty() || keyword == "COMMENT" || keyword == "HISTORY";
+    }
+
+    static std::size_t padded_size(std::size_t size) {
+        return (size + 2879) / 2880 * 2880;
+    }
+
+    /**
+     * @brief Moves everything from tail_start to the end of file forward by shift bytes
+    */
+    void shift_tail(FileStream& file, std::size_t tail_start, std::size_t shift) const {
+        std::size_t remaining = file.file_size() - tail_start;
+        while (remaining > 0) {
+            std::size_t length = std::min(chunk_size, remaining);
+            std::size_t source = tail_start + remaining - length;
+
+            file.set_reading_pos(source);
+            if (!file.write(file.read(length), source + shift)) {
+                throw file_writing_exception("Cannot shift the data");
+            }
+            remaining -= length;
+        }
+    }
+};
+
+using header_editor = basic_header_editor<fits_stream, card_policy>;
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_HEADER_EDITOR_HPP
@@ -16,13 +16,18 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include <string>
 #include <cmath>
 #include <numeric>
+#include <stdexcept>
 #include <valarray>
+#include <vector>
+#include <type_traits>
+#include <utility>
 
 #include <boost/endian/conversion.hpp>
 #include <boost/cstdfloat.hpp>
 #include <boost/variant.hpp>
 
 #include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
 
 
 namespace boost { namespace astronomy { namespace io {
@@ -47,10 +52,12 @@ protected:
     };
 
 public:
+    typedef PixelType pixel_type;
+
     /**
      * @brief       Constructs an standalone object of image_buffer
     */
-    image_buffer() {}
+    image_buffer() :width_(0), height_(0) {}
 
     /**
      * @brief       Constructs an image_buffer object by allocating width*height space for buffer
@@ -143,6 +150,7 @@ public:
      * @brief       Gets the pixel value at specified position
      * @param[in]   x x position of pixel
      * @param[in]   y y position of pixel
+     * @note        The pixel is read at x * width + y, whereas image_view::operator() takes ( column, row )
     */
     PixelType operator() (std::size_t x, std::size_t y)
     {
@@ -152,7 +160,43 @@ public:
     /**
      * @brief       Returns the size of image
     */
-    std::size_t size() { return data_.size(); }
+    std::size_t size() const { return data_.size(); }
+
+    /**
+     * @brief       Returns the number of pixels in a row ( NAXIS1 )
+    */
+    std::size_t width() const { return width_; }
+
+    /**
+     * @brief       Returns the number of rows ( NAXIS2, times the higher axes for cubes )
+    */
+    std::size_t height() const { return height_; }
+
+    /**
+     * @brief       Sets the width and height of an image whose pixels have already been read
+     * @param[in]   width Number of pixels in a row
+     * @param[in]   height Number of rows
+     * @throws      std::invalid_argument If width * height differs from the number of pixels
+    */
+    void set_dimensions(std::size_t width, std::size_t height)
+    {
+        if (width * height != this->data_.size())
+        {
+            throw std::invalid_argument("Image dimensions do not match the number of pixels");
+        }
+        this->width_ = width;
+        this->height_ = height;
+    }
+
+    /**
+     * @brief       Returns the pixels stored row after row ( nullptr for an empty image )
+    */
+    const PixelType* data() const { return this->data_.size() != 0 ? &this->data_[0] : nullptr; }
+
+    /**
+     * @brief       Returns the pixels stored row after row ( nullptr for an empty image )
+    */
+    PixelType* data() { return this->data_.size() != 0 ? &this->data_[0] : nullptr; }
 };
 
 
@@ -170,6 +214,25 @@ struct read_image_visitor :public boost::static_visitor<> {
     void operator()(Image_Type& type) { type.read_image(data_buffer); }
 };
 
+/**
+ * @brief Visitor setting the width and height of the image variants from the axes of the header
+ * @note  Axes beyond the second are folded into the height, so the planes of a cube follow each other
+*/
+struct image_dimensions_visitor :public boost::static_visitor<> {
+
+    std::vector<std::size_t> naxis;
+
+    image_dimensions_visitor(std::vector<std::size_t> axes) :naxis(std::move(axes)) {}
+
+    template<typename Image_Type>
+    void operator()(Image_Type& type) {
+        if (naxis.empty() || type.size() == 0) { return; }
+        std::size_t height = std::accumulate(naxis.begin() + 1, naxis.end(), static_cast<std::size_t>(1),
+            std::multiplies<std::size_t>());
+        type.set_dimensions(naxis[0], height);
+    }
+};
+
 /**
  * @brief Visitor used for writing image data from the image variants onto a buffer
 */
@@ -181,6 +244,24 @@ struct write_image_visitor : public boost::static_visitor<std::string> {
 
 };
 
+/**
+ * @brief Visitor used for updating a range of pixels of the image variants
+ * @tparam PixelType Type of the pixels supplied for the update
+ * @note  Returns the serialized form of the updated pixels
+*/
+template<typename PixelType>
+struct update_pixels_visitor : public boost::static_visitor<std::string> {
+
+    std::size_t first_pixel;
+    const std::vector<PixelType>& pixels;
+
+    update_pixels_visitor(std::size_t first, const std::vector<PixelType>& pixel_values)
+        :first_pixel(first), pixels(pixel_values) {}
+
+    template<typename Image_Type>
+    std::string operator()(Image_Type& type) { return type.update_pixels(first_pixel, pixels); }
+};
+
 /**
  * @brief   Stores image data associated with the perticular HDU
  * @tparam  args Specifies the number of bits that represents a data value in image.
@@ -231,6 +312,38 @@ public:
         return "";
     }
 
+    /**
+     * @brief Updates a contiguous range of pixels and returns them in serialized form
+     * @param[in] first_pixel Position of the first pixel to be updated
+     * @param[in] pixels New values of the pixels
+     * @throws invalid_cast If the type of pixels does not match the BITPIX of the image
+     * @note  The image data is only updated if it has been read into memory
+    */
+    template<typename PixelType>
+    std::string update_pixels(std::size_t first_pixel, const std::vector<PixelType>& pixels) {
+        return update_pixels_impl(first_pixel, pixels,
+            std::is_same<PixelType, typename image::pixel_type>());
+    }
+
+private:
+    template<typename PixelType>
+    std::string update_pixels_impl(std::size_t first_pixel, const std::vector<PixelType>& pixels, std::true_type) {
+        std::string temp_buffer;
+        temp_buffer.reserve(pixels.size() * sizeof(PixelType));
+
+        for (std::size_t i = 0; i < pixels.size(); i++) {
+            if (this->data_.size() != 0) {
+                this->data_[first_pixel + i] = pixels[i];
+            }
+            temp_buffer += Converter::template serialize(pixels[i]);
+        }
+        return temp_buffer;
+    }
+
+    template<typename PixelType>
+    std::string update_pixels_impl(std::size_t, const std::vector<PixelType>&, std::false_type) {
+        throw boost::astronomy::invalid_cast("Pixel type does not match the BITPIX of the image");
+    }
 };
 }}} //namespace boost::astronomy::io
 
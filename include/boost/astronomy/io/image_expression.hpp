@@ -0,0 +1,466 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_EXPRESSION_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_EXPRESSION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_view.hpp>
+
+/**
+ * @file    image_expression.hpp
+ * @details Lazy pixel by pixel arithmetic between images, for calibration steps such as (raw - bias) / flat * gain.
+ *          The operators, clamp and where only record the operation; evaluate then computes the whole expression
+ *          in one pass over the rows, a block of pixels at a time, without any intermediate image.
+ *          Images take part as image_view or image_buffer and may hold different pixel types. Pixels are combined
+ *          as float when every image holds float pixels and as double otherwise, and the result is rounded and
+ *          saturated to the type of the destination. An expression refers to the pixels of its images, which must
+ *          outlive it
+*/
+
+namespace boost { namespace astronomy { namespace io {
+
+namespace detail {
+
+    /**
+     * @brief Base of the nodes of an image expression
+    */
+    struct expression_node {};
+
+    template<typename T>
+    std::true_type is_image_buffer(const image_buffer<T>*);
+
+    std::false_type is_image_buffer(...);
+
+    /**
+     * @brief Whether T takes part in an expression as an image ( a node, an image_view or an image_buffer )
+    */
+    template<typename T>
+    struct is_image_operand : std::integral_constant<bool, std::is_base_of<expression_node, T>::value ||
+        decltype(is_image_buffer(static_cast<const T*>(nullptr)))::value> {};
+
+    template<typename T>
+    struct is_image_operand<image_view<T>> : std::true_type {};
+
+    /**
+     * @brief Type in which pixels of type T are combined
+    */
+    template<typename T>
+    struct expression_value {
+        typedef typename std::conditional<std::is_same<T, float>::value, float, double>::type type;
+    };
+
+    /**
+     * @brief Whether a value counts as true for where, which like numpy takes NaN as true
+    */
+    template<typename T>
+    inline bool nonzero(T value) { return !(value >= 0 && value <= 0); }
+
+    /**
+     * @brief Leaf of an expression reading the pixels of a view
+    */
+    template<typename PixelType>
+    class view_operand : public expression_node {
+        image_view<PixelType> view;
+
+    public:
+        typedef typename expression_value<PixelType>::type value_type;
+        enum { scalar = 0 };
+
+        struct row_type {
+            const PixelType* pixels;
+            value_type operator[](std::size_t x) const { return static_cast<value_type>(pixels[x]); }
+        };
+
+        explicit view_operand(image_view<PixelType> source) :view(source) {}
+
+        std::size_t width() const { return view.width; }
+        std::size_t height() const { return view.height; }
+        row_type row(std::size_t y) const { return row_type{ view.row(y) }; }
+    };
+
+    /**
+     * @brief Leaf of an expression with the same value at every pixel
+    */
+    template<typename Value>
+    class scalar_operand : public expression_node {
+        Value value;
+
+    public:
+        typedef Value value_type;
+        enum { scalar = 1 };
+
+        struct row_type {
+            Value value;
+            Value operator[](std::size_t) const { return value; }
+        };
+
+        explicit scalar_operand(Value constant) :value(constant) {}
+
+        std::size_t width() const { return 0; }
+        std::size_t height() const { return 0; }
+        row_type row(std::size_t) const { return row_type{ value }; }
+    };
+
+    template<typename Expression, typename std::enable_if<std::is_base_of<expression_node, Expression>::value, int>::type = 0>
+    inline Expression as_operand(Expression const& expression) { return expression; }
+
+    template<typename PixelType>
+    inline view_operand<PixelType> as_operand(image_view<PixelType> view) { return view_operand<PixelType>(view); }
+
+    template<typename PixelType>
+    inline view_operand<PixelType> as_operand(const image_buffer<PixelType>& image) {
+        return view_operand<PixelType>(make_image_view(image));
+    }
+
+    /**
+     * @brief Type in which a scalar combined with Other is taken, the value type of Other if it is an image
+    */
+    template<typename Other, bool Image = is_image_operand<Other>::value>
+    struct scalar_value {
+        typedef double type;
+    };
+
+    template<typename Other>
+    struct scalar_value<Other, true> {
+        typedef typename decltype(as_operand(std::declval<Other const&>()))::value_type type;
+    };
+
+    /**
+     * @brief Node standing for an operand T of an expression whose other operand is Other
+    */
+    template<typename T, typename Other, bool Image = is_image_operand<T>::value>
+    struct operand_of {
+        typedef decltype(as_operand(std::declval<T const&>())) type;
+        static type make(T const& operand) { return as_operand(operand); }
+    };
+
+    template<typename T, typename Other>
+    struct operand_of<T, Other, false> {
+        typedef scalar_operand<typename scalar_value<Other>::type> type;
+        static type make(T const& operand) { return type(static_cast<typename type::value_type>(operand)); }
+    };
+
+    /**
+     * @throws std::invalid_argument If node is an image of other dimensions than width x height
+    */
+    template<typename Node>
+    inline void check_dimensions(Node const& node, std::size_t width, std::size_t height) {
+        if (!Node::scalar && (node.width() != width || node.height() != height)) {
+            throw std::invalid_argument("Images of an expression differ in dimensions");
+        }
+    }
+
+    /**
+     * @brief Common dimensions of two nodes, of which scalars have none
+    */
+    template<typename Left, typename Right>
+    inline std::pair<std::size_t, std::size_t> common_dimensions(Left const& left, Right const& right) {
+        if (Left::scalar) { return std::make_pair(right.width(), right.height()); }
+        check_dimensions(right, left.width(), left.height());
+        return std::make_pair(left.width(), left.height());
+    }
+
+    struct add_operation {
+        template<typename T> static T apply(T left, T right) { return left + right; }
+    };
+
+    struct subtract_operation {
+        template<typename T> static T apply(T left, T right) { return left - right; }
+    };
+
+    struct multiply_operation {
+        template<typename T> static T apply(T left, T right) { return left * right; }
+    };
+
+    struct divide_operation {
+        template<typename T> static T apply(T left, T right) { return left / right; }
+    };
+
+    /**
+     * @brief Node combining two nodes pixel by pixel
+    */
+    template<typename Operation, typename Left, typename Right>
+    class binary_expression : public expression_node {
+        Left left;
+        Right right;
+        std::pair<std::size_t, std::size_t> dimensions;
+
+    public:
+        typedef typename std::common_type<typename Left::value_type, typename Right::value_type>::type value_type;
+        enum { scalar = Left::scalar && Right::scalar };
+
+        struct row_type {
+            typename Left::row_type left;
+            typename Right::row_type right;
+
+            value_type operator[](std::size_t x) const {
+                return Operation::apply(static_cast<value_type>(left[x]), static_cast<value_type>(right[x]));
+            }
+        };
+
+        binary_expression(Left left_operand, Right right_operand)
+            :left(left_operand), right(right_operand), dimensions(common_dimensions(left, right)) {}
+
+        std::size_t width() const { return dimensions.first; }
+        std::size_t height() const { return dimensions.second; }
+        row_type row(std::size_t y) const { return row_type{ left.row(y), right.row(y) }; }
+    };
+
+    /**
+     * @brief Node negating a node
+    */
+    template<typename Operand>
+    class negate_expression : public expression_node {
+        Operand operand;
+
+    public:
+        typedef typename Operand::value_type value_type;
+        enum { scalar = 0 };
+
+        struct row_type {
+            typename Operand::row_type operand;
+            value_type operator[](std::size_t x) const { return -operand[x]; }
+        };
+
+        explicit negate_expression(Operand node) :operand(node) {}
+
+        std::size_t width() const { return operand.width(); }
+        std::size_t height() const { return operand.height(); }
+        row_type row(std::size_t y) const { return row_type{ operand.row(y) }; }
+    };
+
+    /**
+     * @brief Node limiting a node to [lower, upper], NaN is kept
+    */
+    template<typename Operand>
+    class clamp_expression : public expression_node {
+        Operand operand;
+        typename Operand::value_type lower;
+        typename Operand::value_type upper;
+
+    public:
+        typedef typename Operand::value_type value_type;
+        enum { scalar = 0 };
+
+        struct row_type {
+            typename Operand::row_type operand;
+            value_type lower;
+            value_type upper;
+
+            value_type operator[](std::size_t x) const {
+                value_type value = operand[x];
+                return value < lower ? lower : (upper < value ? upper : value);
+            }
+        };
+
+        clamp_expression(Operand node, value_type lower_limit, value_type upper_limit)
+            :operand(node), lower(lower_limit), upper(upper_limit) {}
+
+        std::size_t width() const { return operand.width(); }
+        std::size_t height() const { return operand.height(); }
+        row_type row(std::size_t y) const { return row_type{ operand.row(y), lower, upper }; }
+    };
+
+    /**
+     * @brief Node choosing between two nodes pixel by pixel by a mask
+    */
+    template<typename Mask, typename IfTrue, typename IfFalse>
+    class where_expression : public expression_node {
+        Mask mask;
+        IfTrue if_true;
+        IfFalse if_false;
+        std::pair<std::size_t, std::size_t> dimensions;
+
+    public:
+        typedef typename std::common_type<typename IfTrue::value_type, typename IfFalse::value_type>::type value_type;
+        enum { scalar = 0 };
+
+        struct row_type {
+            typename Mask::row_type mask;
+            typename IfTrue::row_type if_true;
+            typename IfFalse::row_type if_false;
+
+            // Both choices are computed so that the selection needs no branch
+            value_type operator[](std::size_t x) const {
+                value_type chosen = static_cast<value_type>(if_true[x]);
+                value_type otherwise = static_cast<value_type>(if_false[x]);
+                return nonzero(mask[x]) ? chosen : otherwise;
+            }
+        };
+
+        where_expression(Mask mask_node, IfTrue true_node, IfFalse false_node)
+            :mask(mask_node), if_true(true_node), if_false(false_node), dimensions(mask.width(), mask.height()) {
+            check_dimensions(if_true, dimensions.first, dimensions.second);
+            check_dimensions(if_false, dimensions.first, dimensions.second);
+        }
+
+        std::size_t width() const { return dimensions.first; }
+        std::size_t height() const { return dimensions.second; }
+        row_type row(std::size_t y) const { return row_type{ mask.row(y), if_true.row(y), if_false.row(y) }; }
+    };
+
+    /**
+     * @brief Builds the node of a binary operation, of which at least one operand is an image
+    */
+    template<typename Operation, typename Left, typename Right>
+    struct binary_operation {
+        typedef operand_of<Left, Right> left_operand;
+        typedef operand_of<Right, Left> right_operand;
+        typedef binary_expression<Operation, typename left_operand::type, typename right_operand::type> type;
+
+        static type make(Left const& left, Right const& right) {
+            return type(left_operand::make(left), right_operand::make(right));
+        }
+    };
+
+    /**
+     * @brief Whether Left and Right may be combined: both images or scalars, at least one of them an image
+    */
+    template<typename Left, typename Right>
+    struct image_operands : std::integral_constant<bool,
+        (is_image_operand<Left>::value || std::is_arithmetic<Left>::value) &&
+        (is_image_operand<Right>::value || std::is_arithmetic<Right>::value) &&
+        (is_image_operand<Left>::value || is_image_operand<Right>::value)> {};
+
+    /**
+     * @brief Whether the choices of where may be combined: each an image or a scalar
+    */
+    template<typename IfTrue, typename IfFalse>
+    struct where_choices : std::integral_constant<bool,
+        (is_image_operand<IfTrue>::value || std::is_arithmetic<IfTrue>::value) &&
+        (is_image_operand<IfFalse>::value || std::is_arithmetic<IfFalse>::value)> {};
+
+    /**
+     * @brief Computes the rows first_row to last_row of an expression into destination
+    */
+    template<typename Result, typename Expression>
+    inline void evaluate_rows(Expression const& expression, std::size_t first_row, std::size_t last_row,
+        Result* destination) {
+        typedef typename Expression::value_type value_type;
+        enum : std::size_t { block_pixels = 256 };
+
+        // Computing a block into local storage first lets the compiler vectorize the expression without
+        // having to check whether the destination overlaps the images
+        value_type block[block_pixels];
+        std::size_t width = expression.width();
+        for (std::size_t y = first_row; y < last_row; y++) {
+            typename Expression::row_type row = expression.row(y);
+            Result* output = destination + y * width;
+            for (std::size_t x = 0; x < width; x += block_pixels) {
+                std::size_t count = std::min<std::size_t>(block_pixels, width - x);
+                for (std::size_t i = 0; i < count; i++) { block[i] = row[x + i]; }
+                for (std::size_t i = 0; i < count; i++) { output[x + i] = pixel_cast<Result>(block[i]); }
+            }
+        }
+    }
+}
+
+template<typename Left, typename Right, typename std::enable_if<detail::image_operands<Left, Right>::value, int>::type = 0>
+typename detail::binary_operation<detail::add_operation, Left, Right>::type operator+(Left const& left, Right const& right) {
+    return detail::binary_operation<detail::add_operation, Left, Right>::make(left, right);
+}
+
+template<typename Left, typename Right, typename std::enable_if<detail::image_operands<Left, Right>::value, int>::type = 0>
+typename detail::binary_operation<detail::subtract_operation, Left, Right>::type operator-(Left const& left, Right const& right) {
+    return detail::binary_operation<detail::subtract_operation, Left, Right>::make(left, right);
+}
+
+template<typename Left, typename Right, typename std::enable_if<detail::image_operands<Left, Right>::value, int>::type = 0>
+typename detail::binary_operation<detail::multiply_operation, Left, Right>::type operator*(Left const& left, Right const& right) {
+    return detail::binary_operation<detail::multiply_operation, Left, Right>::make(left, right);
+}
+
+template<typename Left, typename Right, typename std::enable_if<detail::image_operands<Left, Right>::value, int>::type = 0>
+typename detail::binary_operation<detail::divide_operation, Left, Right>::type operator/(Left const& left, Right const& right) {
+    return detail::binary_operation<detail::divide_operation, Left, Right>::make(left, right);
+}
+
+template<typename Operand, typename std::enable_if<detail::is_image_operand<Operand>::value, int>::type = 0>
+detail::negate_expression<typename detail::operand_of<Operand, Operand>::type> operator-(Operand const& operand) {
+    return detail::negate_expression<typename detail::operand_of<Operand, Operand>::type>(detail::as_operand(operand));
+}
+
+/**
+ * @brief Limits the pixels of an image or expression to [lower, upper], NaN pixels are left as they are
+*/
+template<typename Operand, typename std::enable_if<detail::is_image_operand<Operand>::value, int>::type = 0>
+detail::clamp_expression<typename detail::operand_of<Operand, Operand>::type> clamp(Operand const& operand,
+    double lower, double upper) {
+    typedef typename detail::operand_of<Operand, Operand>::type node_type;
+    typedef typename node_type::value_type value_type;
+    return detail::clamp_expression<node_type>(detail::as_operand(operand), static_cast<value_type>(lower),
+        static_cast<value_type>(upper));
+}
+
+/**
+ * @brief   Takes each pixel from if_true where the mask is not zero and from if_false elsewhere
+ * @details Either choice may be a scalar. As in numpy a NaN mask pixel counts as not zero
+ * @throws  std::invalid_argument If the images differ in dimensions
+*/
+template<typename Mask, typename IfTrue, typename IfFalse, typename std::enable_if<
+    detail::is_image_operand<Mask>::value && detail::where_choices<IfTrue, IfFalse>::value, int>::type = 0>
+detail::where_expression<typename detail::operand_of<Mask, Mask>::type, typename detail::operand_of<IfTrue, IfFalse>::type,
+    typename detail::operand_of<IfFalse, IfTrue>::type>
+where(Mask const& mask, IfTrue const& if_true, IfFalse const& if_false) {
+    return detail::where_expression<typename detail::operand_of<Mask, Mask>::type,
+        typename detail::operand_of<IfTrue, IfFalse>::type, typename detail::operand_of<IfFalse, IfTrue>::type>(
+            detail::as_operand(mask), detail::operand_of<IfTrue, IfFalse>::make(if_true),
+            detail::operand_of<IfFalse, IfTrue>::make(if_false));
+}
+
+/**
+ * @brief   Computes an image expression into destination in a single pass
+ * @details Every pixel is computed from the pixels at the same position only, so destination may hold the
+ *          pixels of one of the images of the expression
+ * @param[in] expression Expression, image_view or image_buffer to be computed
+ * @param[out] destination Storage for width x height pixels, stored row after row
+ * @param[in] threads Number of threads to use ( 0 uses the number of hardware threads )
+*/
+template<typename Result, typename Expression, typename std::enable_if<detail::is_image_operand<Expression>::value, int>::type = 0>
+void evaluate(Expression const& expression, Result* destination, std::size_t threads = 0) {
+    auto node = detail::as_operand(expression);
+    detail::run_row_bands(node.height(), 0, node.width(), threads, [&](std::size_t first_row, std::size_t last_row) {
+        detail::evaluate_rows(node, first_row, last_row, destination);
+    });
+}
+
+/**
+ * @brief Computes an image expression into an image, which takes the dimensions of the expression ( see above )
+*/
+template<typename Result, typename Expression, typename std::enable_if<detail::is_image_operand<Expression>::value, int>::type = 0>
+void evaluate(Expression const& expression, image_buffer<Result>& destination, std::size_t threads = 0) {
+    auto node = detail::as_operand(expression);
+    if (destination.size() != node.width() * node.height()) {
+        destination = image_buffer<Result>(node.width(), node.height());
+    }
+    else {
+        destination.set_dimensions(node.width(), node.height());
+    }
+    evaluate(node, destination.data(), threads);
+}
+
+/**
+ * @brief Computes an image expression into a new image of pixels of type Result ( see above )
+*/
+template<typename Result = double, typename Expression, typename std::enable_if<detail::is_image_operand<Expression>::value, int>::type = 0>
+image_buffer<Result> evaluate(Expression const& expression, std::size_t threads = 0) {
+    image_buffer<Result> result;
+    evaluate(expression, result, threads);
+    return result;
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_EXPRESSION_HPP
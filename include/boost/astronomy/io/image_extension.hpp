@@ -12,6 +12,7 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include <string>
 #include <vector>
 #include <cstddef>
+#include <stdexcept>
 #include <valarray>
 
 #include <boost/astronomy/io/header.hpp>
@@ -60,6 +61,13 @@ public:
         return this->hdu_header;
     }
 
+    /**
+     * @brief Returns a reference to the header associated with the currently held hdu
+    */
+    header<CardPolicy>& get_header() {
+        return this->hdu_header;
+    }
+
     /**
      * @brief   Gets the image data associated with the primary HDU
      * @see     image.hpp
@@ -71,6 +79,30 @@ public:
 
 
 
+    /**
+     * @brief Overwrites a contiguous range of pixels in place, both in the file and in memory
+     * @param[in,out] file_writer Provides operations for writing data into the file
+     * @param[in] data_location Offset of the data unit of this HDU in the file
+     * @param[in] first_pixel Position of the first pixel to be updated
+     * @param[in] pixels New values of the pixels
+     * @throws std::out_of_range If the range of pixels lies outside the image
+     * @throws invalid_cast If the type of pixels does not match the BITPIX of the image
+     * @throws file_writing_exception If the pixels cannot be written to the file
+    */
+    template<typename PixelType, typename FileWriter>
+    void write_pixels(FileWriter& file_writer, std::size_t data_location,
+        std::size_t first_pixel, const std::vector<PixelType>& pixels) {
+
+        if (first_pixel + pixels.size() > this->hdu_header.data_size()) {
+            throw std::out_of_range("Pixel range lies outside the image");
+        }
+        update_pixels_visitor<PixelType> update_pixels_visit(first_pixel, pixels);
+        auto pixel_data = boost::apply_visitor(update_pixels_visit, data);
+        if (!file_writer.write(pixel_data, data_location + first_pixel * sizeof(PixelType))) {
+            throw file_writing_exception("Cannot write the pixels");
+        }
+    }
+
     /**
     * @brief Writes the entire HDU ( header, image_data ) into the file
     * @param[in,out] file_writer Provides operations for writing data into the file
@@ -96,6 +128,8 @@ private:
     void set_image_data(const std::string& data_buffer) {
         read_image_visitor read_image_visit(data_buffer);
         boost::apply_visitor(read_image_visit, data);
+        image_dimensions_visitor image_dimensions_visit(this->hdu_header.all_naxis());
+        boost::apply_visitor(image_dimensions_visit, data);
     }
 
     /**
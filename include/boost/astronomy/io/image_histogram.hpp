@@ -0,0 +1,807 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_HISTOGRAM_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/integer.hpp>
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_view.hpp>
+
+/**
+ * @file    image_histogram.hpp
+ * @details Histograms, quantiles and display ranges of images.
+ *          Histograms adapt their bins to the pixels: integer pixels use power of two wide bins ( one bin per
+ *          value when the range allows it ) and floating point pixels use equal bins over their finite range.
+ *          Quantiles are either approximated from a histogram, optionally of a strided subsample of the image,
+ *          or found exactly by radix selection, which never copies or sorts the image
+*/
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief Controls how a histogram is built
+*/
+struct histogram_options {
+    std::size_t max_bins = 1 << 16;     //! Upper limit on the number of bins ( also limited to the pixels counted )
+    std::size_t max_samples = 0;        //! Pixels sampled at an even stride ( 0 counts every pixel )
+    std::size_t threads = 0;            //! Number of threads ( 0 uses the number of hardware threads )
+};
+
+/**
+ * @brief Range of pixel values mapped onto the display, from black to white
+*/
+struct display_range {
+    double lower = 0;
+    double upper = 0;
+};
+
+/**
+ * @brief Controls the zscale algorithm ( the defaults are the ones used by IRAF and astropy )
+*/
+struct zscale_options {
+    std::size_t samples = 1000;         //! Number of pixels sampled from the image
+    double contrast = 0.25;             //! Scales the slope of the fitted line, smaller values widen the range
+    double rejection = 2.5;             //! Pixels further than rejection standard deviations from the line are rejected
+    double max_reject = 0.5;            //! Fraction of the samples that must survive rejection for the fit to be used
+    std::size_t min_pixels = 5;         //! Minimum number of samples that must survive rejection
+    std::size_t max_iterations = 5;     //! Number of rejection iterations
+};
+
+namespace detail {
+
+    /**
+     * @brief Calls visit for every pixel whose position in the row after row order is a multiple of
+     *        sample_stride and lies in [first, last)
+    */
+    template<typename PixelType, typename Visitor>
+    inline void visit_pixels(image_view<PixelType> view, std::size_t first, std::size_t last,
+        std::size_t sample_stride, Visitor&& visit) {
+        first = (first + sample_stride - 1) / sample_stride * sample_stride;
+        while (first < last) {
+            std::size_t y = first / view.width;
+            std::size_t row_start = y * view.width;
+            std::size_t row_end = std::min(last, row_start + view.width);
+            const PixelType* row = view.row(y) - row_start;
+            if (sample_stride == 1) {
+                for (std::size_t i = first; i < row_end; i++) { visit(row[i]); }
+                first = row_end;
+            }
+            else {
+                for (; first < row_end; first += sample_stride) { visit(row[first]); }
+            }
+        }
+    }
+
+    /**
+     * @brief Splits the pixels of a view into one range per thread and calls task( band, first, last ) for each
+     * @return Number of bands
+    */
+    template<typename PixelType, typename Task>
+    inline std::size_t run_pixel_bands(image_view<PixelType> view, std::size_t threads, Task const& task) {
+        std::size_t total = view.size();
+        if (total == 0) { return 0; }
+        threads = parallel_threads(threads, std::max<std::size_t>(1, total >> 16));
+        std::size_t band_pixels = (total + threads - 1) / threads;
+        run_row_bands(total, band_pixels, 1, threads, [&](std::size_t first, std::size_t last) {
+            task(first / band_pixels, first, last);
+        });
+        return (total + band_pixels - 1) / band_pixels;
+    }
+
+    /**
+     * @brief Whether a pixel takes part in statistics ( NaN and infinite pixels do not )
+    */
+    template<typename T>
+    inline bool usable_pixel(T value, std::true_type /*integer*/) { (void)value; return true; }
+
+    template<typename T>
+    inline bool usable_pixel(T value, std::false_type /*floating point*/) { return std::isfinite(value); }
+
+    template<typename T>
+    inline bool usable_pixel(T value) { return usable_pixel(value, std::is_integral<T>()); }
+
+    /**
+     * @brief   Bins of a histogram of integer pixels, 2^shift values wide starting at the minimum
+     * @details between covers the integers lying within real bounds ( as sigma clipping needs ). Values outside
+     *          the bins fall into the first or the last one
+    */
+    template<typename T, bool Integer = std::is_integral<T>::value>
+    struct histogram_binning {
+        std::int64_t minimum = 0;
+        unsigned shift = 0;
+        std::size_t bins = 1;
+
+        histogram_binning() {}
+
+        histogram_binning(T min_value, T max_value, std::size_t max_bins) {
+            cover(static_cast<std::int64_t>(min_value), static_cast<std::int64_t>(max_value), max_bins);
+        }
+
+        static histogram_binning between(double low, double high, std::size_t max_bins) {
+            double first = std::ceil(low);
+            histogram_binning binning;
+            binning.cover(static_cast<std::int64_t>(first), static_cast<std::int64_t>(std::max(first, std::floor(high))),
+                max_bins);
+            return binning;
+        }
+
+        std::size_t operator()(T value) const {
+            std::int64_t offset = static_cast<std::int64_t>(value) - minimum;
+            if (offset < 0) { return 0; }
+            std::size_t bin = static_cast<std::size_t>(static_cast<std::uint64_t>(offset) >> shift);
+            return bin < bins ? bin : bins - 1;
+        }
+
+        double lower() const { return static_cast<double>(minimum); }
+        double width() const { return static_cast<double>(std::uint64_t(1) << shift); }
+        bool exact() const { return shift == 0; }
+
+        //! Smallest and largest value of a bin
+        double lower_edge(std::size_t bin) const { return lower() + static_cast<double>(std::uint64_t(bin) << shift); }
+        double upper_edge(std::size_t bin) const { return lower_edge(bin + 1) - 1; }
+
+    private:
+        void cover(std::int64_t first, std::int64_t last, std::size_t max_bins) {
+            minimum = first;
+            std::uint64_t range = static_cast<std::uint64_t>(last - first);
+            while ((range >> shift) >= max_bins) { shift++; }
+            bins = static_cast<std::size_t>(range >> shift) + 1;
+        }
+    };
+
+    /**
+     * @brief Bins of a histogram of floating point pixels, equally wide between the minimum and the maximum
+    */
+    template<typename T>
+    struct histogram_binning<T, false> {
+        double minimum = 0;
+        double scale = 0;
+        double bin_width = 0;
+        std::size_t bins = 1;
+
+        histogram_binning() {}
+
+        histogram_binning(T min_value, T max_value, std::size_t max_bins) {
+            cover(static_cast<double>(min_value), static_cast<double>(max_value), max_bins);
+        }
+
+        static histogram_binning between(double low, double high, std::size_t max_bins) {
+            histogram_binning binning;
+            binning.cover(low, high, max_bins);
+            return binning;
+        }
+
+        std::size_t operator()(T value) const {
+            double position = (static_cast<double>(value) - minimum) * scale;
+            if (!(position > 0)) { return 0; }
+            std::size_t bin = static_cast<std::size_t>(position);
+            return bin < bins ? bin : bins - 1;
+        }
+
+        double lower() const { return minimum; }
+        double width() const { return bin_width; }
+        bool exact() const { return bins == 1; }
+
+        //! Edges of a bin
+        double lower_edge(std::size_t bin) const { return minimum + static_cast<double>(bin) * bin_width; }
+        double upper_edge(std::size_t bin) const { return lower_edge(bin + 1); }
+
+    private:
+        void cover(double low, double high, std::size_t max_bins) {
+            minimum = low;
+            double range = high - low;
+            if (range > 0) {
+                bins = max_bins;
+                scale = static_cast<double>(bins) / range;
+                bin_width = range / static_cast<double>(bins);
+            }
+        }
+    };
+
+    /**
+     * @brief   Maps pixels onto unsigned keys of the same size whose order is the order of the pixels
+     * @details Signed integers have their sign bit flipped. Floating point numbers have every bit flipped when
+     *          negative and the sign bit set otherwise
+    */
+    template<typename T, bool Integer = std::is_integral<T>::value>
+    struct order_key {
+        typedef typename boost::uint_t<8 * sizeof(T)>::exact type;
+
+        static type flip() { return std::is_signed<T>::value ? static_cast<type>(type(1) << (8 * sizeof(T) - 1)) : type(0); }
+        static type encode(T value) { return static_cast<type>(static_cast<type>(value) ^ flip()); }
+        static T decode(type key) { return static_cast<T>(static_cast<type>(key ^ flip())); }
+    };
+
+    template<typename T>
+    struct order_key<T, false> {
+        typedef typename boost::uint_t<8 * sizeof(T)>::exact type;
+
+        static type sign() { return static_cast<type>(type(1) << (8 * sizeof(T) - 1)); }
+
+        static type encode(T value) {
+            type bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            return (bits & sign()) ? static_cast<type>(~bits) : static_cast<type>(bits | sign());
+        }
+
+        static T decode(type key) {
+            type bits = (key & sign()) ? static_cast<type>(key & ~sign()) : static_cast<type>(~key);
+            T value;
+            std::memcpy(&value, &bits, sizeof(T));
+            return value;
+        }
+    };
+
+    /**
+     * @brief   Finds order statistics of the usable pixels of a view by radix selection
+     * @details Each pass counts the next 16 bits of the keys of the pixels sharing the bits found so far.
+     *          Once few enough pixels share those bits they are gathered and the statistic is selected among
+     *          them, so the memory used stays bounded whatever the distribution of the pixels
+    */
+    template<typename PixelType>
+    class rank_selector {
+        typedef order_key<PixelType> key_traits;
+        typedef typename key_traits::type key_type;
+        enum : unsigned { key_bits = 8 * sizeof(PixelType), digit_limit = 16 };
+        enum : std::size_t { gather_limit = std::size_t(1) << 18 };
+
+        image_view<PixelType> view;
+        std::size_t threads;
+
+    public:
+        struct rank_request {
+            std::uint64_t rank;     // Rank among the pixels sharing the prefix
+            std::size_t slot;       // Position of the result
+        };
+
+        rank_selector(image_view<PixelType> source, std::size_t thread_count) :view(source), threads(thread_count) {}
+
+        /**
+         * @brief Counts the usable pixels of the view by the top bits of their keys
+        */
+        std::vector<std::uint64_t> first_histogram() const { return digit_histogram(0, 0, first_digit_bits()); }
+
+        unsigned first_digit_bits() const { return std::min<unsigned>(digit_limit, key_bits); }
+
+        /**
+         * @brief Resolves ranks ( sorted ascending ) among pixels sharing prefix, given their digit histogram
+        */
+        void select(std::vector<std::uint64_t> const& counts, std::uint64_t prefix, unsigned known_bits,
+            unsigned digit_bits, std::vector<rank_request> const& ranks, std::vector<PixelType>& results) const {
+            std::size_t next = 0;
+            std::uint64_t before = 0;
+            for (std::size_t digit = 0; digit < counts.size() && next < ranks.size(); digit++) {
+                std::vector<rank_request> group;
+                for (; next < ranks.size() && ranks[next].rank < before + counts[digit]; next++) {
+                    group.push_back(rank_request{ ranks[next].rank - before, ranks[next].slot });
+                }
+                if (!group.empty()) {
+                    resolve((prefix << digit_bits) | digit, known_bits + digit_bits, counts[digit], group, results);
+                }
+                before += counts[digit];
+            }
+        }
+
+    private:
+        bool shares_prefix(key_type key, std::uint64_t prefix, unsigned known_bits) const {
+            return known_bits == 0 || (static_cast<std::uint64_t>(key) >> (key_bits - known_bits)) == prefix;
+        }
+
+        void resolve(std::uint64_t prefix, unsigned known_bits, std::uint64_t count,
+            std::vector<rank_request> const& ranks, std::vector<PixelType>& results) const {
+            if (known_bits == key_bits) {
+                for (auto const& request : ranks) { results[request.slot] = key_traits::decode(static_cast<key_type>(prefix)); }
+            }
+            else if (count <= gather_limit) {
+                std::vector<key_type> keys = gather(prefix, known_bits);
+                if (ranks.size() == 1) {
+                    std::nth_element(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(ranks[0].rank), keys.end());
+                }
+                else {
+                    std::sort(keys.begin(), keys.end());
+                }
+                for (auto const& request : ranks) {
+                    results[request.slot] = key_traits::decode(keys[static_cast<std::size_t>(request.rank)]);
+                }
+            }
+            else {
+                unsigned digit_bits = std::min<unsigned>(digit_limit, key_bits - known_bits);
+                select(digit_histogram(prefix, known_bits, digit_bits), prefix, known_bits, digit_bits, ranks, results);
+            }
+        }
+
+        std::vector<std::uint64_t> digit_histogram(std::uint64_t prefix, unsigned known_bits, unsigned digit_bits) const {
+            std::size_t digits = std::size_t(1) << digit_bits;
+            unsigned shift = key_bits - known_bits - digit_bits;
+            std::vector<std::vector<std::uint64_t>> band_counts(parallel_threads(threads, view.size()));
+
+            std::size_t bands = run_pixel_bands(view, threads, [&](std::size_t band, std::size_t first, std::size_t last) {
+                std::vector<std::uint64_t> counts(digits, 0);
+                visit_pixels(view, first, last, 1, [&](PixelType value) {
+                    if (!usable_pixel(value)) { return; }
+                    key_type key = key_traits::encode(value);
+                    if (shares_prefix(key, prefix, known_bits)) {
+                        counts[static_cast<std::size_t>((static_cast<std::uint64_t>(key) >> shift) & (digits - 1))]++;
+                    }
+                });
+                band_counts[band] = std::move(counts);
+            });
+
+            std::vector<std::uint64_t> counts(digits, 0);
+            for (std::size_t band = 0; band < bands; band++) {
+                for (std::size_t digit = 0; digit < digits; digit++) { counts[digit] += band_counts[band][digit]; }
+            }
+            return counts;
+        }
+
+        std::vector<key_type> gather(std::uint64_t prefix, unsigned known_bits) const {
+            std::vector<std::vector<key_type>> band_keys(parallel_threads(threads, view.size()));
+            std::size_t bands = run_pixel_bands(view, threads, [&](std::size_t band, std::size_t first, std::size_t last) {
+                std::vector<key_type> keys;
+                visit_pixels(view, first, last, 1, [&](PixelType value) {
+                    if (!usable_pixel(value)) { return; }
+                    key_type key = key_traits::encode(value);
+                    if (shares_prefix(key, prefix, known_bits)) { keys.push_back(key); }
+                });
+                band_keys[band] = std::move(keys);
+            });
+
+            std::vector<key_type> keys;
+            for (std::size_t band = 0; band < bands; band++) {
+                keys.insert(keys.end(), band_keys[band].begin(), band_keys[band].end());
+            }
+            return keys;
+        }
+    };
+
+    inline void check_probability(double probability) {
+        if (!(probability >= 0 && probability <= 1)) {
+            throw std::invalid_argument("Quantile probability must lie in [0, 1]");
+        }
+    }
+
+    /**
+     * @brief Copies the usable pixels at every sample_stride-th position of a view
+    */
+    template<typename PixelType>
+    inline std::vector<PixelType> sample_pixels(image_view<PixelType> view, std::size_t sample_stride, std::size_t threads) {
+        std::vector<std::vector<PixelType>> band_samples(parallel_threads(threads, view.size()));
+        std::size_t bands = run_pixel_bands(view, threads, [&](std::size_t band, std::size_t first, std::size_t last) {
+            std::vector<PixelType> samples;
+            samples.reserve((last - first) / sample_stride + 1);
+            visit_pixels(view, first, last, sample_stride, [&](PixelType value) {
+                if (usable_pixel(value)) { samples.push_back(value); }
+            });
+            band_samples[band] = std::move(samples);
+        });
+
+        std::vector<PixelType> samples;
+        for (std::size_t band = 0; band < bands; band++) {
+            samples.insert(samples.end(), band_samples[band].begin(), band_samples[band].end());
+        }
+        return samples;
+    }
+
+    /**
+     * @brief Stride between samples so that at most max_samples of total pixels are sampled ( 0 samples all )
+    */
+    inline std::size_t sample_stride_for(std::size_t total, std::size_t max_samples) {
+        if (max_samples == 0 || total <= max_samples) { return 1; }
+        return (total + max_samples - 1) / max_samples;
+    }
+}
+
+/**
+ * @brief   Histogram of the pixels of an image
+ * @details Bin b holds the pixels from lower_edge( b ) up to lower_edge( b + 1 ), the last bin also holds the
+ *          maximum. NaN and infinite pixels are not counted. When the histogram was built from a subsample each
+ *          count stands for sample_stride() pixels of the image
+*/
+class pixel_histogram {
+    double first_edge = 0;
+    double bin_width = 0;
+    bool exact_bins = false;
+    bool integer_pixels = false;
+    double min_value = 0;
+    double max_value = 0;
+    std::size_t stride = 1;
+    std::vector<std::uint64_t> bin_counts;
+    std::vector<std::uint64_t> cumulative;
+
+public:
+    /**
+     * @brief Creates an empty histogram
+    */
+    pixel_histogram() {}
+
+    /**
+     * @brief   Creates a histogram from its bins
+     * @param[in] lower Lower edge of the first bin
+     * @param[in] width Width of each bin
+     * @param[in] exact Whether every bin holds a single value
+     * @param[in] integer Whether the pixels are integers, so a bin of width w holds w values
+     * @param[in] minimum Smallest pixel counted
+     * @param[in] maximum Largest pixel counted
+     * @param[in] sample_stride Number of pixels of the image each count stands for
+     * @param[in] counts Number of pixels in each bin
+    */
+    pixel_histogram(double lower, double width, bool exact, bool integer, double minimum, double maximum,
+        std::size_t sample_stride, std::vector<std::uint64_t> counts)
+        :first_edge(lower), bin_width(width), exact_bins(exact), integer_pixels(integer), min_value(minimum),
+        max_value(maximum), stride(sample_stride), bin_counts(std::move(counts)), cumulative(bin_counts.size()) {
+        std::partial_sum(bin_counts.begin(), bin_counts.end(), cumulative.begin());
+    }
+
+    /**
+     * @brief Returns the number of bins
+    */
+    std::size_t bins() const { return bin_counts.size(); }
+
+    /**
+     * @brief Returns the number of pixels counted in each bin
+    */
+    std::vector<std::uint64_t> const& counts() const { return bin_counts; }
+
+    /**
+     * @brief Returns the number of pixels counted
+    */
+    std::uint64_t total() const { return cumulative.empty() ? 0 : cumulative.back(); }
+
+    /**
+     * @brief Returns the lower edge of bin
+    */
+    double lower_edge(std::size_t bin) const { return first_edge + static_cast<double>(bin) * bin_width; }
+
+    /**
+     * @brief Returns the width of every bin
+    */
+    double width() const { return bin_width; }
+
+    /**
+     * @brief Returns whether every bin holds a single value, in which case the quantiles are exact
+    */
+    bool exact() const { return exact_bins; }
+
+    /**
+     * @brief Returns the smallest pixel counted
+    */
+    double minimum() const { return min_value; }
+
+    /**
+     * @brief Returns the largest pixel counted
+    */
+    double maximum() const { return max_value; }
+
+    /**
+     * @brief Returns the number of pixels of the image each count stands for
+    */
+    std::size_t sample_stride() const { return stride; }
+
+    /**
+     * @brief Returns the index of the bin holding the pixel of given rank ( 0 for the smallest pixel )
+     * @throws std::out_of_range If rank is not below total()
+    */
+    std::size_t bin_of_rank(std::uint64_t rank) const {
+        if (rank >= total()) { throw std::out_of_range("Rank exceeds the number of pixels"); }
+        return static_cast<std::size_t>(std::upper_bound(cumulative.begin(), cumulative.end(), rank) - cumulative.begin());
+    }
+
+    /**
+     * @brief   Estimates the pixel of given rank ( 0 for the smallest pixel )
+     * @details The pixels of a bin are assumed to be spread evenly over the bin, unless the bin holds a single value
+     * @throws  std::out_of_range If rank is not below total()
+    */
+    double order_statistic(std::uint64_t rank) const {
+        std::size_t bin = bin_of_rank(rank);
+        if (exact_bins) { return bins() == 1 ? min_value : lower_edge(bin); }
+
+        std::uint64_t before = bin == 0 ? 0 : cumulative[bin - 1];
+        double position = (static_cast<double>(rank - before) + 0.5) / static_cast<double>(bin_counts[bin]);
+        double value = lower_edge(bin) + position * bin_width - (integer_pixels ? 0.5 : 0.0);
+        return std::min(std::max(value, min_value), max_value);
+    }
+
+    /**
+     * @brief   Estimates the quantile of the pixels at given probability
+     * @details Interpolates linearly between the two pixels whose ranks surround probability * ( total() - 1 ),
+     *          which is the definition used by numpy.quantile
+     * @throws  std::invalid_argument If probability does not lie in [0, 1] or the histogram is empty
+    */
+    double quantile(double probability) const {
+        detail::check_probability(probability);
+        if (total() == 0) { throw std::invalid_argument("Histogram holds no pixels"); }
+
+        double position = probability * static_cast<double>(total() - 1);
+        std::uint64_t rank = static_cast<std::uint64_t>(position);
+        double fraction = position - static_cast<double>(rank);
+        double value = order_statistic(rank);
+        if (fraction > 0 && rank + 1 < total()) {
+            value += fraction * (order_statistic(rank + 1) - value);
+        }
+        return value;
+    }
+};
+
+/**
+ * @brief   Builds the histogram of the usable pixels of a view
+ * @details One pass finds the range of the pixels and a second one counts them, both on a pool of threads which
+ *          count into separate histograms merged at the end. When options.max_samples limits the number of
+ *          pixels, the sampled pixels are gathered first and both passes run over them
+ * @param[in] view Pixels to be counted
+ * @param[in] options Number of bins, sampling and threads
+*/
+template<typename PixelType>
+pixel_histogram make_histogram(image_view<PixelType> view, histogram_options const& options = histogram_options()) {
+    std::size_t max_bins = std::max<std::size_t>(1, options.max_bins);
+    std::size_t stride = detail::sample_stride_for(view.size(), options.max_samples);
+    std::vector<PixelType> samples;
+    if (stride > 1) {
+        samples = detail::sample_pixels(view, stride, options.threads);
+        view = image_view<PixelType>(samples.data(), samples.size(), samples.empty() ? 0 : 1);
+    }
+
+    std::size_t band_slots = detail::parallel_threads(options.threads, view.size());
+    std::vector<std::pair<PixelType, PixelType>> band_ranges(band_slots);
+    std::vector<char> band_used(band_slots, 0);
+    std::size_t bands = detail::run_pixel_bands(view, options.threads, [&](std::size_t band, std::size_t first, std::size_t last) {
+        PixelType low = std::numeric_limits<PixelType>::max(), high = std::numeric_limits<PixelType>::lowest();
+        bool used = false;
+        detail::visit_pixels(view, first, last, 1, [&](PixelType value) {
+            if (!detail::usable_pixel(value)) { return; }
+            low = std::min(low, value);
+            high = std::max(high, value);
+            used = true;
+        });
+        band_ranges[band] = std::make_pair(low, high);
+        band_used[band] = used ? 1 : 0;
+    });
+
+    bool any = false;
+    PixelType low = PixelType(), high = PixelType();
+    for (std::size_t band = 0; band < bands; band++) {
+        if (!band_used[band]) { continue; }
+        low = any ? std::min(low, band_ranges[band].first) : band_ranges[band].first;
+        high = any ? std::max(high, band_ranges[band].second) : band_ranges[band].second;
+        any = true;
+    }
+    if (!any) { return pixel_histogram(); }
+
+    // More bins than pixels would only spread the counts thinner
+    detail::histogram_binning<PixelType> binning(low, high, std::min(max_bins, view.size()));
+    std::vector<std::vector<std::uint64_t>> band_counts(band_slots);
+    detail::run_pixel_bands(view, options.threads, [&](std::size_t band, std::size_t first, std::size_t last) {
+        std::vector<std::uint64_t> counts(binning.bins, 0);
+        detail::visit_pixels(view, first, last, 1, [&](PixelType value) {
+            if (detail::usable_pixel(value)) { counts[binning(value)]++; }
+        });
+        band_counts[band] = std::move(counts);
+    });
+
+    std::vector<std::uint64_t> counts(binning.bins, 0);
+    for (std::size_t band = 0; band < bands; band++) {
+        for (std::size_t bin = 0; bin < counts.size(); bin++) { counts[bin] += band_counts[band][bin]; }
+    }
+    return pixel_histogram(binning.lower(), binning.width(), binning.exact(), std::is_integral<PixelType>::value,
+        static_cast<double>(low), static_cast<double>(high), stride, std::move(counts));
+}
+
+/**
+ * @brief Builds the histogram of the usable pixels of an image ( see above )
+ * @note  The dimensions of the image need not be known
+*/
+template<typename PixelType>
+pixel_histogram make_histogram(const image_buffer<PixelType>& image, histogram_options const& options = histogram_options()) {
+    return make_histogram(image_view<PixelType>(image.data(), image.size(), image.size() == 0 ? 0 : 1), options);
+}
+
+/**
+ * @brief   Computes exact quantiles of the usable pixels of a view
+ * @details The pixels of the two ranks surrounding probability * ( count - 1 ) are found by radix selection and
+ *          interpolated linearly, as numpy.quantile does. The image is scanned a few times ( twice for most
+ *          images ) but never copied or sorted
+ * @param[in] view Pixels whose quantiles are computed
+ * @param[in] probabilities Probabilities of the quantiles, each in [0, 1]
+ * @param[in] threads Number of threads to use ( 0 uses the number of hardware threads )
+ * @return Quantile for each probability
+ * @throws std::invalid_argument If a probability lies outside [0, 1] or the view has no usable pixel
+*/
+template<typename PixelType>
+std::vector<double> exact_quantiles(image_view<PixelType> view, std::vector<double> const& probabilities,
+    std::size_t threads = 0) {
+    typedef detail::rank_selector<PixelType> selector_type;
+    for (double probability : probabilities) { detail::check_probability(probability); }
+    if (probabilities.empty()) { return std::vector<double>(); }
+
+    selector_type selector(view, threads);
+    std::vector<std::uint64_t> counts = selector.first_histogram();
+    std::uint64_t total = std::accumulate(counts.begin(), counts.end(), std::uint64_t(0));
+    if (total == 0) { throw std::invalid_argument("Image holds no usable pixels"); }
+
+    // Each probability needs the pixels of two neighbouring ranks
+    std::vector<std::uint64_t> ranks;
+    for (double probability : probabilities) {
+        std::uint64_t rank = static_cast<std::uint64_t>(probability * static_cast<double>(total - 1));
+        ranks.push_back(rank);
+        ranks.push_back(std::min(rank + 1, total - 1));
+    }
+    std::vector<std::uint64_t> distinct_ranks = ranks;
+    std::sort(distinct_ranks.begin(), distinct_ranks.end());
+    distinct_ranks.erase(std::unique(distinct_ranks.begin(), distinct_ranks.end()), distinct_ranks.end());
+
+    std::vector<typename selector_type::rank_request> requests;
+    for (std::size_t slot = 0; slot < distinct_ranks.size(); slot++) {
+        requests.push_back(typename selector_type::rank_request{ distinct_ranks[slot], slot });
+    }
+    std::vector<PixelType> pixels(distinct_ranks.size());
+    selector.select(counts, 0, 0, selector.first_digit_bits(), requests, pixels);
+
+    std::vector<double> quantiles;
+    for (std::size_t i = 0; i < probabilities.size(); i++) {
+        auto slot_of = [&](std::uint64_t rank) {
+            return static_cast<std::size_t>(std::lower_bound(distinct_ranks.begin(), distinct_ranks.end(), rank) -
+                distinct_ranks.begin());
+        };
+        double lower = static_cast<double>(pixels[slot_of(ranks[2 * i])]);
+        double upper = static_cast<double>(pixels[slot_of(ranks[2 * i + 1])]);
+        double fraction = probabilities[i] * static_cast<double>(total - 1) - static_cast<double>(ranks[2 * i]);
+        quantiles.push_back(fraction > 0 ? lower + fraction * (upper - lower) : lower);
+    }
+    return quantiles;
+}
+
+/**
+ * @brief Computes an exact quantile of the usable pixels of a view ( see exact_quantiles )
+*/
+template<typename PixelType>
+double exact_quantile(image_view<PixelType> view, double probability, std::size_t threads = 0) {
+    return exact_quantiles(view, { probability }, threads)[0];
+}
+
+/**
+ * @brief Computes exact quantiles of the usable pixels of an image ( see above )
+ * @note  The dimensions of the image need not be known
+*/
+template<typename PixelType>
+std::vector<double> exact_quantiles(const image_buffer<PixelType>& image, std::vector<double> const& probabilities,
+    std::size_t threads = 0) {
+    return exact_quantiles(image_view<PixelType>(image.data(), image.size(), image.size() == 0 ? 0 : 1),
+        probabilities, threads);
+}
+
+/**
+ * @brief   Estimates the display range between two quantiles, for example the 1% and 99% percentiles
+ * @details The quantiles are estimated from a histogram of a strided subsample of options.max_samples pixels
+ *          ( 16384 when left 0 ), so the cost hardly depends on the size of the image
+ * @throws  std::invalid_argument If a probability lies outside [0, 1] or the view has no usable pixel
+*/
+template<typename PixelType>
+display_range percentile_range(image_view<PixelType> view, double lower_probability = 0.01,
+    double upper_probability = 0.99, histogram_options options = histogram_options()) {
+    if (options.max_samples == 0) { options.max_samples = std::size_t(1) << 14; }
+    pixel_histogram histogram = make_histogram(view, options);
+    display_range range;
+    range.lower = histogram.quantile(lower_probability);
+    range.upper = histogram.quantile(upper_probability);
+    return range;
+}
+
+/**
+ * @brief   Computes the display range of an image with the zscale algorithm of IRAF
+ * @details About options.samples usable pixels are taken at an even stride through the image and sorted.
+ *          A line is fitted to the sorted samples against their rank, rejecting samples far from the line along
+ *          with their neighbours. The range spans the median plus and minus the slope of the line divided by
+ *          the contrast, limited to the range of the samples. If too many samples are rejected the range of
+ *          the samples is returned
+ * @throws  std::invalid_argument If the view has no usable pixel
+*/
+template<typename PixelType>
+display_range zscale(image_view<PixelType> view, zscale_options const& options = zscale_options()) {
+    std::size_t stride = std::max<std::size_t>(1, view.size() / std::max<std::size_t>(1, options.samples));
+    std::vector<PixelType> sampled = detail::sample_pixels(view, stride, 1);
+    if (sampled.size() > options.samples) { sampled.resize(options.samples); }
+    if (sampled.empty()) { throw std::invalid_argument("Image holds no usable pixels"); }
+
+    std::vector<double> samples(sampled.begin(), sampled.end());
+    std::sort(samples.begin(), samples.end());
+    std::size_t count = samples.size();
+
+    display_range range;
+    range.lower = samples.front();
+    range.upper = samples.back();
+
+    std::size_t min_pixels = std::max(options.min_pixels, static_cast<std::size_t>(static_cast<double>(count) * options.max_reject));
+    std::size_t grow = std::max<std::size_t>(1, static_cast<std::size_t>(static_cast<double>(count) * 0.01));
+    std::vector<char> rejected(count, 0), grown(count, 0);
+    std::size_t good = count, last_good = count + 1;
+    double slope = 0;
+    bool fitted = false;
+
+    for (std::size_t iteration = 0; iteration < options.max_iterations; iteration++) {
+        if (good >= last_good || good < min_pixels) { break; }
+
+        // Least squares line through the samples not rejected, against their rank
+        double sum_x = 0, sum_y = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            if (!rejected[i]) { sum_x += static_cast<double>(i); sum_y += samples[i]; }
+        }
+        double mean_x = sum_x / static_cast<double>(good), mean_y = sum_y / static_cast<double>(good);
+        double sxx = 0, sxy = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            if (rejected[i]) { continue; }
+            double dx = static_cast<double>(i) - mean_x;
+            sxx += dx * dx;
+            sxy += dx * (samples[i] - mean_y);
+        }
+        slope = sxx > 0 ? sxy / sxx : 0.0;
+        double intercept = mean_y - slope * mean_x;
+        fitted = true;
+
+        double sum_squares = 0, sum_residuals = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            if (rejected[i]) { continue; }
+            double residual = samples[i] - (intercept + slope * static_cast<double>(i));
+            sum_residuals += residual;
+            sum_squares += residual * residual;
+        }
+        double mean_residual = sum_residuals / static_cast<double>(good);
+        double threshold = options.rejection *
+            std::sqrt(std::max(0.0, sum_squares / static_cast<double>(good) - mean_residual * mean_residual));
+
+        for (std::size_t i = 0; i < count; i++) {
+            double residual = samples[i] - (intercept + slope * static_cast<double>(i));
+            if (residual < -threshold || residual > threshold) { rejected[i] = 1; }
+        }
+
+        // Rejection spreads to the neighbours of each rejected sample
+        std::fill(grown.begin(), grown.end(), 0);
+        for (std::size_t i = 0; i < count; i++) {
+            if (!rejected[i]) { continue; }
+            std::size_t first = i >= (grow - 1) / 2 ? i - (grow - 1) / 2 : 0;
+            std::size_t last = std::min(count - 1, i + grow / 2);
+            std::fill(grown.begin() + static_cast<std::ptrdiff_t>(first), grown.begin() + static_cast<std::ptrdiff_t>(last) + 1, 1);
+        }
+        rejected.swap(grown);
+
+        last_good = good;
+        good = static_cast<std::size_t>(std::count(rejected.begin(), rejected.end(), 0));
+    }
+
+    if (fitted && good >= min_pixels) {
+        if (options.contrast > 0) { slope /= options.contrast; }
+        std::size_t center = (count - 1) / 2;
+        double median = count % 2 == 1 ? samples[count / 2] : 0.5 * (samples[count / 2 - 1] + samples[count / 2]);
+        range.lower = std::max(range.lower, median - (static_cast<double>(center) - 1) * slope);
+        range.upper = std::min(range.upper, median + static_cast<double>(count - center) * slope);
+    }
+    return range;
+}
+
+/**
+ * @brief Computes the display range of an image with the zscale algorithm of IRAF ( see above )
+ * @throws std::invalid_argument If the dimensions of the image are not known or it has no usable pixel
+*/
+template<typename PixelType>
+display_range zscale(const image_buffer<PixelType>& image, zscale_options const& options = zscale_options()) {
+    return zscale(make_image_view(image), options);
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_HISTOGRAM_HPP
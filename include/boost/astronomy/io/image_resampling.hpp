@@ -0,0 +1,713 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_RESAMPLING_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_RESAMPLING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/integer.hpp>
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_view.hpp>
+#include <boost/astronomy/io/image_writer.hpp>
+#include <boost/astronomy/io/positional_file.hpp>
+#include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/io/default_card_policy.hpp>
+#include <boost/astronomy/io/table_schema.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+/**
+ * @file    image_resampling.hpp
+ * @details Binning, integer factor downsampling and interpolating resampling of images.
+ *          Every kernel walks rows contiguously so the compiler can vectorize the inner loops, splits the output
+ *          into bands of rows processed by a pool of threads, and is also provided as a streaming object which
+ *          accepts the source a block of rows at a time for images which do not fit in memory
+*/
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief How the pixels of a block are combined by binning
+*/
+enum class binning_mode {
+    sum,    //! Sum of the pixels of the block
+    mean    //! Average of the pixels of the block
+};
+
+/**
+ * @brief Kernel used for resampling an image to arbitrary dimensions
+*/
+enum class interpolation {
+    bilinear,   //! Linear interpolation between the two nearest pixels along each axis
+    lanczos3    //! Lanczos kernel with three lobes, widened when shrinking to avoid aliasing
+};
+
+namespace detail {
+
+    inline void check_binning_factors(std::size_t factor_x, std::size_t factor_y) {
+        if (factor_x == 0 || factor_y == 0) {
+            throw std::invalid_argument("Binning factors must be greater than zero");
+        }
+    }
+
+    /**
+     * @brief Adds count pixels of a row to the running sums of the columns
+    */
+    template<typename T, typename Accumulator>
+    inline void accumulate_row(const T* row, std::size_t count, Accumulator* sums) {
+        for (std::size_t x = 0; x < count; x++) { sums[x] += static_cast<Accumulator>(row[x]); }
+    }
+
+    /**
+     * @brief Combines the column sums of every block of factor_x columns into a pixel of the output row
+    */
+    template<typename Result, typename Accumulator>
+    inline void reduce_binned_row(const Accumulator* sums, std::size_t output_width, std::size_t factor_x,
+        bool mean, double scale, Result* output) {
+        for (std::size_t x = 0; x < output_width; x++) {
+            const Accumulator* block = sums + x * factor_x;
+            Accumulator total = Accumulator(0);
+            for (std::size_t k = 0; k < factor_x; k++) { total += block[k]; }
+            output[x] = mean ? pixel_cast<Result>(static_cast<double>(total) * scale) : pixel_cast<Result>(total);
+        }
+    }
+
+    /**
+     * @brief   Bins the output rows [first_row, last_row) of an image
+     * @details The columns are processed in strips so that the sums of a strip stay in the first level cache
+     *          while the factor_y source rows of an output row are added to them
+    */
+    template<typename Result, typename PixelType>
+    inline void bin_band(image_view<PixelType> source, std::size_t factor_x, std::size_t factor_y, bool mean,
+        std::size_t output_width, std::size_t first_row, std::size_t last_row, Result* destination) {
+        typedef typename pixel_accumulator<PixelType>::type accumulator_type;
+        std::size_t strip_width = std::max<std::size_t>(1, 2048 / factor_x);
+        std::vector<accumulator_type> sums(std::min(strip_width, output_width) * factor_x);
+        double scale = 1.0 / static_cast<double>(factor_x * factor_y);
+
+        for (std::size_t y = first_row; y < last_row; y++) {
+            for (std::size_t strip = 0; strip < output_width; strip += strip_width) {
+                std::size_t columns = std::min(strip_width, output_width - strip);
+                std::fill(sums.begin(), sums.begin() + columns * factor_x, accumulator_type(0));
+                for (std::size_t k = 0; k < factor_y; k++) {
+                    accumulate_row(source.row(y * factor_y + k) + strip * factor_x, columns * factor_x, sums.data());
+                }
+                reduce_binned_row(sums.data(), columns, factor_x, mean, scale, destination + y * output_width + strip);
+            }
+        }
+    }
+
+    /**
+     * @brief Weights of a one dimensional resampling, the output pixel i is the sum of
+     *        weights[i * max_taps + k] * source[first[i] + k] for k below taps[i]
+    */
+    struct resampling_filter {
+        std::vector<std::size_t> first;
+        std::vector<std::size_t> taps;
+        std::vector<double> weights;
+        std::size_t max_taps = 0;
+    };
+
+    inline double lanczos3_kernel(double x) {
+        const double pi = 3.14159265358979323846;
+        x = std::fabs(x);
+        if (x < 1e-8) { return 1.0; }
+        if (x >= 3.0) { return 0.0; }
+        return 3.0 * std::sin(pi * x) * std::sin(pi * x / 3.0) / (pi * pi * x * x);
+    }
+
+    /**
+     * @brief   Computes the weights for resampling source_size pixels to output_size pixels
+     * @details Pixel centers are aligned, so the output pixel i samples the source at (i + 0.5) * scale - 0.5.
+     *          Taps falling outside the source are clamped onto the edge pixels and the weights of each output
+     *          pixel are normalized to sum to one, so a constant image stays constant
+    */
+    inline resampling_filter make_resampling_filter(std::size_t source_size, std::size_t output_size,
+        interpolation method) {
+        resampling_filter filter;
+        if (source_size == 0 || output_size == 0) { return filter; }
+
+        double scale = static_cast<double>(source_size) / static_cast<double>(output_size);
+        double kernel_scale = method == interpolation::lanczos3 ? std::max(1.0, scale) : 1.0;
+        double support = (method == interpolation::lanczos3 ? 3.0 : 1.0) * kernel_scale;
+        double last_pixel = static_cast<double>(source_size - 1);
+
+        std::vector<double> pixel_weights;
+        filter.first.resize(output_size);
+        filter.taps.resize(output_size);
+        std::vector<std::vector<double>> all_weights(output_size);
+
+        for (std::size_t i = 0; i < output_size; i++) {
+            double center = (static_cast<double>(i) + 0.5) * scale - 0.5;
+            double low = std::min(std::max(std::ceil(center - support), 0.0), last_pixel);
+            double high = std::min(std::max(std::floor(center + support), 0.0), last_pixel);
+            std::size_t first = static_cast<std::size_t>(low);
+            pixel_weights.assign(static_cast<std::size_t>(high) - first + 1, 0.0);
+
+            double total = 0;
+            for (double s = std::ceil(center - support); s <= std::floor(center + support); s += 1.0) {
+                double distance = (s - center) / kernel_scale;
+                double weight = method == interpolation::lanczos3 ? lanczos3_kernel(distance) :
+                    std::max(0.0, 1.0 - std::fabs(distance));
+                std::size_t tap = static_cast<std::size_t>(std::min(std::max(s, 0.0), last_pixel)) - first;
+                pixel_weights[tap] += weight;
+                total += weight;
+            }
+            for (double& weight : pixel_weights) { weight /= total; }
+
+            filter.first[i] = first;
+            filter.taps[i] = pixel_weights.size();
+            filter.max_taps = std::max(filter.max_taps, pixel_weights.size());
+            all_weights[i] = pixel_weights;
+        }
+
+        filter.weights.assign(output_size * filter.max_taps, 0.0);
+        for (std::size_t i = 0; i < output_size; i++) {
+            std::copy(all_weights[i].begin(), all_weights[i].end(), filter.weights.begin() + i * filter.max_taps);
+        }
+        return filter;
+    }
+
+    /**
+     * @brief Resamples a source row along its length into output ( filter.first.size() values )
+    */
+    template<typename PixelType>
+    inline void resample_row(const PixelType* row, resampling_filter const& filter, double* output) {
+        std::size_t output_size = filter.first.size();
+        for (std::size_t i = 0; i < output_size; i++) {
+            const PixelType* taps = row + filter.first[i];
+            const double* weights = &filter.weights[i * filter.max_taps];
+            std::size_t count = filter.taps[i], k = 0;
+
+            // Independent partial sums let the multiplications of consecutive taps overlap
+            double sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+            for (; k + 4 <= count; k += 4) {
+                sum0 += weights[k] * static_cast<double>(taps[k]);
+                sum1 += weights[k + 1] * static_cast<double>(taps[k + 1]);
+                sum2 += weights[k + 2] * static_cast<double>(taps[k + 2]);
+                sum3 += weights[k + 3] * static_cast<double>(taps[k + 3]);
+            }
+            for (; k < count; k++) { sum0 += weights[k] * static_cast<double>(taps[k]); }
+            output[i] = (sum0 + sum1) + (sum2 + sum3);
+        }
+    }
+
+    /**
+     * @brief Adds weight times a row to the output row ( the vertical pass of the resampling )
+    */
+    inline void add_weighted_row(const double* row, double weight, std::size_t count, double* output) {
+        for (std::size_t x = 0; x < count; x++) { output[x] += weight * row[x]; }
+    }
+
+    /**
+     * @brief Resamples the output rows [first_row, last_row) of an image
+    */
+    template<typename Result, typename PixelType>
+    inline void resample_band(image_view<PixelType> source, resampling_filter const& horizontal,
+        resampling_filter const& vertical, std::size_t first_row, std::size_t last_row, Result* destination) {
+        std::size_t output_width = horizontal.first.size();
+        std::size_t first_source = vertical.first[first_row];
+        std::size_t last_source = vertical.first[last_row - 1] + vertical.taps[last_row - 1];
+
+        // Every source row used by the band is resampled along its length once
+        std::vector<double> rows((last_source - first_source) * output_width);
+        for (std::size_t y = first_source; y < last_source; y++) {
+            resample_row(source.row(y), horizontal, &rows[(y - first_source) * output_width]);
+        }
+
+        std::vector<double> output_row(output_width);
+        for (std::size_t y = first_row; y < last_row; y++) {
+            std::fill(output_row.begin(), output_row.end(), 0.0);
+            const double* weights = &vertical.weights[y * vertical.max_taps];
+            for (std::size_t k = 0; k < vertical.taps[y]; k++) {
+                add_weighted_row(&rows[(vertical.first[y] + k - first_source) * output_width], weights[k],
+                    output_width, output_row.data());
+            }
+            Result* output = destination + y * output_width;
+            for (std::size_t x = 0; x < output_width; x++) { output[x] = pixel_cast<Result>(output_row[x]); }
+        }
+    }
+}
+
+/**
+ * @brief   Bins an image by summing or averaging blocks of factor_x x factor_y pixels
+ * @details The output has source.width / factor_x columns and source.height / factor_y rows, the pixels of
+ *          incomplete blocks at the right and bottom edges are dropped. Integer pixels are summed without overflow
+ *          and every result is rounded and saturated to Result
+ * @param[in] source Pixels to be binned
+ * @param[in] factor_x Number of columns in a block
+ * @param[in] factor_y Number of rows in a block
+ * @param[in] mode Whether a block is summed or averaged
+ * @param[out] destination Storage for the output pixels, stored row after row
+ * @param[in] threads Number of threads to use ( 0 uses the number of hardware threads )
+ * @throws std::invalid_argument If a factor is zero
+*/
+template<typename Result, typename PixelType>
+void bin_image(image_view<PixelType> source, std::size_t factor_x, std::size_t factor_y, binning_mode mode,
+    Result* destination, std::size_t threads = 0) {
+    detail::check_binning_factors(factor_x, factor_y);
+    std::size_t output_width = source.width / factor_x;
+    std::size_t output_height = source.height / factor_y;
+    if (output_width == 0) { return; }
+
+    detail::run_row_bands(output_height, 0, output_width * factor_x * factor_y, threads,
+        [&](std::size_t first_row, std::size_t last_row) {
+            detail::bin_band(source, factor_x, factor_y, mode == binning_mode::mean, output_width, first_row,
+                last_row, destination);
+        });
+}
+
+/**
+ * @brief Bins an image by summing or averaging blocks of factor_x x factor_y pixels ( see above )
+ * @return Binned image of pixels of type Result
+ * @throws std::invalid_argument If a factor is zero or the dimensions of the image are not known
+*/
+template<typename Result = double, typename PixelType>
+image_buffer<Result> bin_image(const image_buffer<PixelType>& source, std::size_t factor_x, std::size_t factor_y,
+    binning_mode mode = binning_mode::mean, std::size_t threads = 0) {
+    detail::check_binning_factors(factor_x, factor_y);
+    image_view<PixelType> view = make_image_view(source);
+    image_buffer<Result> binned(view.width / factor_x, view.height / factor_y);
+    bin_image(view, factor_x, factor_y, mode, binned.data(), threads);
+    return binned;
+}
+
+/**
+ * @brief   Downsamples an image by an integer factor along each axis, keeping every factor_x-th pixel of every
+ *          factor_y-th row without combining pixels
+ * @details The output has the same dimensions as bin_image gives, with the first pixel of each block
+ * @param[in] source Pixels to be downsampled
+ * @param[in] factor_x Number of columns in a block
+ * @param[in] factor_y Number of rows in a block
+ * @param[out] destination Storage for the output pixels, stored row after row
+ * @param[in] threads Number of threads to use ( 0 uses the number of hardware threads )
+ * @throws std::invalid_argument If a factor is zero
+*/
+template<typename PixelType>
+void downsample_image(image_view<PixelType> source, std::size_t factor_x, std::size_t factor_y,
+    PixelType* destination, std::size_t threads = 0) {
+    detail::check_binning_factors(factor_x, factor_y);
+    std::size_t output_width = source.width / factor_x;
+    std::size_t output_height = source.height / factor_y;
+
+    detail::run_row_bands(output_height, 0, output_width, threads, [&](std::size_t first_row, std::size_t last_row) {
+        for (std::size_t y = first_row; y < last_row; y++) {
+            const PixelType* row = source.row(y * factor_y);
+            PixelType* output = destination + y * output_width;
+            for (std::size_t x = 0; x < output_width; x++) { output[x] = row[x * factor_x]; }
+        }
+    });
+}
+
+/**
+ * @brief Downsamples an image by an integer factor along each axis ( see above )
+ * @return Downsampled image with pixels of the same type
+ * @throws std::invalid_argument If a factor is zero or the dimensions of the image are not known
+*/
+template<typename PixelType>
+image_buffer<PixelType> downsample_image(const image_buffer<PixelType>& source, std::size_t factor_x,
+    std::size_t factor_y, std::size_t threads = 0) {
+    detail::check_binning_factors(factor_x, factor_y);
+    image_view<PixelType> view = make_image_view(source);
+    image_buffer<PixelType> downsampled(view.width / factor_x, view.height / factor_y);
+    downsample_image(view, factor_x, factor_y, downsampled.data(), threads);
+    return downsampled;
+}
+
+/**
+ * @brief   Resamples an image to output_width x output_height pixels
+ * @details The resampling is separable: rows are first resampled along their length and the results are then
+ *          combined along the columns. Pixels beyond the edges repeat the edge pixels and the results are rounded
+ *          and saturated to Result
+ * @param[in] source Pixels to be resampled
+ * @param[in] output_width Number of columns of the output
+ * @param[in] output_height Number of rows of the output
+ * @param[in] method Interpolation kernel
+ * @param[out] destination Storage for the output pixels, stored row after row
+ * @param[in] threads Number of threads to use ( 0 uses the number of hardware threads )
+ * @throws std::invalid_argument If the source is empty while the output is not
+*/
+template<typename Result, typename PixelType>
+void resample_image(image_view<PixelType> source, std::size_t output_width, std::size_t output_height,
+    interpolation method, Result* destination, std::size_t threads = 0) {
+    if (output_width == 0 || output_height == 0) { return; }
+    if (source.width == 0 || source.height == 0) {
+        throw std::invalid_argument("Cannot resample an empty image");
+    }
+    detail::resampling_filter horizontal = detail::make_resampling_filter(source.width, output_width, method);
+    detail::resampling_filter vertical = detail::make_resampling_filter(source.height, output_height, method);
+
+    // Neighbouring bands both resample the source rows under the kernel at their boundary, so bands span
+    // several kernel heights to keep that repeated work small, while still giving every thread some bands
+    std::size_t band_rows = std::max<std::size_t>(16, 8 * vertical.max_taps * output_height / source.height);
+    std::size_t workers = detail::parallel_threads(threads, output_height);
+    band_rows = std::min(band_rows, (output_height + 2 * workers - 1) / (2 * workers));
+
+    detail::run_row_bands(output_height, band_rows, output_width, workers,
+        [&](std::size_t first_row, std::size_t last_row) {
+            detail::resample_band(source, horizontal, vertical, first_row, last_row, destination);
+        });
+}
+
+/**
+ * @brief Resamples an image to output_width x output_height pixels ( see above )
+ * @return Resampled image of pixels of type Result
+ * @throws std::invalid_argument If the source is empty or its dimensions are not known
+*/
+template<typename Result = double, typename PixelType>
+image_buffer<Result> resample_image(const image_buffer<PixelType>& source, std::size_t output_width,
+    std::size_t output_height, interpolation method = interpolation::bilinear, std::size_t threads = 0) {
+    image_view<PixelType> view = make_image_view(source);
+    image_buffer<Result> resampled(output_width, output_height);
+    resample_image(view, output_width, output_height, method, resampled.data(), threads);
+    return resampled;
+}
+
+/**
+ * @brief   Bins an image received a block of rows at a time
+ * @details Only the sums of the rows of the current block are kept, so the memory used does not depend on the
+ *          height of the image. Rows left over at the bottom that do not fill a block are dropped
+ * @tparam  Result Type of the output pixels
+*/
+template<typename Result = double>
+class image_binner {
+    std::size_t source_width;
+    std::size_t factor_x;
+    std::size_t factor_y;
+    bool mean;
+    std::size_t pending_rows = 0;
+    std::vector<double> sums;
+    std::vector<Result> output_row;
+
+public:
+    /**
+     * @brief Creates a binner for rows of source_width pixels
+     * @throws std::invalid_argument If a factor is zero
+    */
+    image_binner(std::size_t width, std::size_t block_width, std::size_t block_height,
+        binning_mode mode = binning_mode::mean)
+        :source_width(width), factor_x(block_width), factor_y(block_height), mean(mode == binning_mode::mean) {
+        detail::check_binning_factors(factor_x, factor_y);
+        sums.assign(output_width() * factor_x, 0.0);
+        output_row.resize(output_width());
+    }
+
+    /**
+     * @brief Returns the number of pixels in an output row
+    */
+    std::size_t output_width() const { return source_width / factor_x; }
+
+    /**
+     * @brief Returns the number of output rows produced from source_height rows
+    */
+    std::size_t output_height(std::size_t source_height) const { return source_height / factor_y; }
+
+    /**
+     * @brief Adds rows to the current block and emits each completed output row
+     * @param[in] rows First pixel of count rows of source_width pixels each
+     * @param[in] count Number of rows
+     * @param[in] sink Called with a pointer to output_width() pixels for every output row completed
+    */
+    template<typename PixelType, typename RowSink>
+    void push_rows(const PixelType* rows, std::size_t count, RowSink&& sink) {
+        double scale = 1.0 / static_cast<double>(factor_x * factor_y);
+        for (std::size_t y = 0; y < count; y++) {
+            detail::accumulate_row(rows + y * source_width, sums.size(), sums.data());
+            if (++pending_rows < factor_y) { continue; }
+
+            detail::reduce_binned_row(sums.data(), output_row.size(), factor_x, mean, scale, output_row.data());
+            sink(static_cast<const Result*>(output_row.data()));
+            std::fill(sums.begin(), sums.end(), 0.0);
+            pending_rows = 0;
+        }
+    }
+};
+
+/**
+ * @brief   Resamples an image received a block of rows at a time
+ * @details A source row is resampled along its length once it arrives and kept only while an output row
+ *          still needs it, so the memory used depends on the width of the image and the size of the kernel
+ * @tparam  Result Type of the output pixels
+*/
+template<typename Result = double>
+class image_resampler {
+    std::size_t source_width;
+    detail::resampling_filter horizontal;
+    detail::resampling_filter vertical;
+    std::size_t rows_received = 0;
+    std::size_t next_output_row = 0;
+    std::size_t window_first = 0;                   // Source row held at the front of the window
+    std::deque<std::vector<double>> window;
+    std::vector<std::vector<double>> spare_rows;
+    std::vector<double> output_values;
+    std::vector<Result> output_row;
+
+public:
+    /**
+     * @brief Creates a resampler from width x source_height pixels to output_width x output_height pixels
+     * @throws std::invalid_argument If the source is empty while the output is not
+    */
+    image_resampler(std::size_t width, std::size_t source_height, std::size_t output_width,
+        std::size_t output_height, interpolation method = interpolation::bilinear)
+        :source_width(width), horizontal(detail::make_resampling_filter(width, output_width, method)),
+        vertical(detail::make_resampling_filter(source_height, output_height, method)),
+        output_values(output_width), output_row(output_width) {
+        if ((width == 0 || source_height == 0) && output_width != 0 && output_height != 0) {
+            throw std::invalid_argument("Cannot resample an empty image");
+        }
+        if (output_width == 0) { vertical = detail::resampling_filter(); }
+        if (!vertical.first.empty()) { window_first = vertical.first[0]; }
+    }
+
+    /**
+     * @brief Returns whether every output row has been emitted
+    */
+    bool finished() const { return next_output_row == vertical.first.size(); }
+
+    /**
+     * @brief Adds the next rows of the source and emits every output row which can be completed
+     * @param[in] rows First pixel of count rows of width pixels each
+     * @param[in] count Number of rows
+     * @param[in] sink Called with a pointer to output_width pixels for every output row completed
+    */
+    template<typename PixelType, typename RowSink>
+    void push_rows(const PixelType* rows, std::size_t count, RowSink&& sink) {
+        for (std::size_t y = 0; y < count; y++, rows_received++) {
+            if (finished() || rows_received < window_first) { continue; }
+
+            std::vector<double> row;
+            if (!spare_rows.empty()) {
+                row = std::move(spare_rows.back());
+                spare_rows.pop_back();
+            }
+            row.resize(output_values.size());
+            detail::resample_row(rows + y * source_width, horizontal, row.data());
+            window.push_back(std::move(row));
+            emit_rows(sink);
+        }
+    }
+
+private:
+    template<typename RowSink>
+    void emit_rows(RowSink& sink) {
+        while (!finished() && vertical.first[next_output_row] + vertical.taps[next_output_row] <=
+            window_first + window.size()) {
+            std::fill(output_values.begin(), output_values.end(), 0.0);
+            const double* weights = &vertical.weights[next_output_row * vertical.max_taps];
+            std::size_t offset = vertical.first[next_output_row] - window_first;
+            for (std::size_t k = 0; k < vertical.taps[next_output_row]; k++) {
+                detail::add_weighted_row(window[offset + k].data(), weights[k], output_values.size(),
+                    output_values.data());
+            }
+            for (std::size_t x = 0; x < output_row.size(); x++) {
+                output_row[x] = detail::pixel_cast<Result>(output_values[x]);
+            }
+            sink(static_cast<const Result*>(output_row.data()));
+            next_output_row++;
+
+            // Rows no longer used by the remaining output rows are recycled
+            std::size_t needed = finished() ? window_first + window.size() : vertical.first[next_output_row];
+            while (window_first < needed && !window.empty()) {
+                spare_rows.push_back(std::move(window.front()));
+                window.pop_front();
+                window_first++;
+            }
+            window_first = std::max(window_first, needed);
+        }
+    }
+};
+
+namespace detail {
+
+    /**
+     * @brief Converts count big endian pixels of a data unit to native values of type T
+    */
+    template<typename PixelType, typename T>
+    inline void decode_big_endian_pixels(const char* data, std::size_t count, T* pixels) {
+        typedef typename boost::uint_t<8 * sizeof(PixelType)>::exact bits_type;
+        for (std::size_t i = 0; i < count; i++) {
+            pixels[i] = static_cast<T>(load_big_endian<PixelType, bits_type>(data + i * sizeof(PixelType)));
+        }
+    }
+
+    /**
+     * @brief   Reads the image of an HDU a block of rows at a time with positional reads
+     * @details The HDU is located by walking the headers and skipping every data unit by its exact size ( heap and
+     *          groups included ), without building the HDUs in between. Tables without EXTNAME or with a heap may
+     *          therefore precede the image. The callback of for_each_block receives a pointer to the decoded rows
+     *          ( of the type given by BITPIX ) and their count
+    */
+    class image_row_reader {
+        positional_file file;
+        header<card_policy> image_header;
+        std::size_t data_location = 0;
+        std::size_t image_width = 0;
+        std::size_t image_height = 0;
+
+    public:
+        /**
+         * @throws file_reading_exception If the file cannot be opened or has no HDU at hdu_index
+         * @throws std::invalid_argument If the HDU does not hold an image
+        */
+        image_row_reader(const std::string& path, std::size_t hdu_index) :file(path) {
+            positional_cursor cursor(file);
+            for (std::size_t index = 0; ; index++) {
+                if (cursor.at_end()) { throw file_reading_exception("No HDU at the given index"); }
+                image_header.read_header(cursor);
+                data_location = cursor.get_current_pos();
+                if (index == hdu_index) { break; }
+                cursor.set_reading_pos(data_location + image_header.data_unit_size());
+                cursor.set_unit_end();
+            }
+
+            std::vector<std::size_t> axes = image_header.all_naxis();
+            if (axes.empty() || image_header.data_size() == 0 || image_header.contains_keyword("TFIELDS")) {
+                throw std::invalid_argument("HDU does not hold an image");
+            }
+            image_width = axes[0];
+            image_height = image_header.data_size() / image_width;
+        }
+
+        std::size_t width() const { return image_width; }
+        std::size_t height() const { return image_height; }
+        bitpix pixel_bitpix() const { return image_header.bitpix(); }
+
+        template<typename Callback>
+        void for_each_block(std::size_t block_rows, Callback&& callback) const {
+            block_rows = std::max<std::size_t>(1, block_rows);
+            visit_bitpix(pixel_bitpix(), [&](auto pixel) {
+                typedef decltype(pixel) pixel_type;
+                std::size_t row_size = image_width * sizeof(pixel_type);
+                std::string raw(block_rows * row_size, ' ');
+                std::vector<pixel_type> pixels(block_rows * image_width);
+
+                for (std::size_t y = 0; y < image_height; y += block_rows) {
+                    std::size_t rows = std::min(block_rows, image_height - y);
+                    if (file.read_at(data_location + y * row_size, &raw[0], rows * row_size) != rows * row_size) {
+                        throw file_reading_exception("Cannot read the data unit of the HDU");
+                    }
+                    decode_big_endian_pixels<pixel_type>(raw.data(), rows * image_width, pixels.data());
+                    callback(static_cast<const pixel_type*>(pixels.data()), rows);
+                }
+            });
+        }
+
+        /**
+         * @brief Reads rows first_row to first_row + rows - 1 wherever they are, converting their pixels to T
+         * @param[out] pixels Receives rows * width() pixels
+         * @param[in,out] raw Buffer for the encoded rows, reused across calls
+         * @throws file_reading_exception If the rows cannot be read
+        */
+        template<typename T>
+        void read_rows(std::size_t first_row, std::size_t rows, T* pixels, std::string& raw) const {
+            visit_bitpix(pixel_bitpix(), [&](auto pixel) {
+                typedef decltype(pixel) pixel_type;
+                std::size_t row_size = image_width * sizeof(pixel_type);
+                raw.resize(std::max<std::size_t>(1, rows * row_size));
+                if (file.read_at(data_location + first_row * row_size, &raw[0], rows * row_size) != rows * row_size) {
+                    throw file_reading_exception("Cannot read the data unit of the HDU");
+                }
+                decode_big_endian_pixels<pixel_type>(raw.data(), rows * image_width, pixels);
+            });
+        }
+    };
+
+    /**
+     * @brief Writes the rows emitted by a streaming kernel to an image file, converting them to the output BITPIX
+    */
+    template<typename Kernel>
+    inline void stream_image_file(image_row_reader const& reader, Kernel&& kernel_factory,
+        const std::string& destination_path, bitpix output_bitpix, std::size_t output_width,
+        std::size_t output_height, std::size_t block_rows) {
+        image_writer writer(destination_path, output_bitpix, { output_width, output_height });
+        visit_bitpix(output_bitpix, [&](auto output_pixel) {
+            typedef decltype(output_pixel) output_type;
+            auto kernel = kernel_factory(output_pixel);
+            std::vector<output_type> block(std::max<std::size_t>(1, block_rows) * output_width);
+            std::size_t block_filled = 0;
+            auto flush = [&]() {
+                writer.write_rows(block.data(), block_filled);
+                block_filled = 0;
+            };
+
+            reader.for_each_block(block_rows, [&](auto const* rows, std::size_t count) {
+                kernel.push_rows(rows, count, [&](const output_type* row) {
+                    std::copy(row, row + output_width, block.begin() + static_cast<std::ptrdiff_t>(block_filled * output_width));
+                    if (++block_filled * output_width == block.size()) { flush(); }
+                });
+            });
+            if (block_filled != 0) { flush(); }
+        });
+        writer.close();
+    }
+}
+
+/**
+ * @brief   Bins the image of an HDU into a new FITS file without loading the whole image
+ * @details The source is read block_rows rows at a time, so images larger than memory can be binned
+ * @param[in] source_path Location of the FITS file holding the image
+ * @param[in] hdu_index Index of the HDU holding the image ( 0 for the primary HDU )
+ * @param[in] destination_path Location of the binned image, written as the primary HDU of a new file
+ * @param[in] factor_x Number of columns in a block
+ * @param[in] factor_y Number of rows in a block
+ * @param[in] mode Whether a block is summed or averaged
+ * @param[in] output_bitpix Type of the pixels of the binned image
+ * @param[in] block_rows Number of source rows read at a time
+ * @throws std::invalid_argument If a factor is zero or the HDU does not hold an image
+ * @throws file_reading_exception If the source cannot be read
+ * @throws file_writing_exception If the destination cannot be written
+*/
+inline void bin_image_file(const std::string& source_path, std::size_t hdu_index, const std::string& destination_path,
+    std::size_t factor_x, std::size_t factor_y, binning_mode mode = binning_mode::mean,
+    bitpix output_bitpix = bitpix::_B32, std::size_t block_rows = 256) {
+    detail::check_binning_factors(factor_x, factor_y);
+    detail::image_row_reader reader(source_path, hdu_index);
+    std::size_t output_width = reader.width() / factor_x;
+    std::size_t output_height = reader.height() / factor_y;
+
+    detail::stream_image_file(reader, [&](auto output_pixel) {
+        return image_binner<decltype(output_pixel)>(reader.width(), factor_x, factor_y, mode);
+    }, destination_path, output_bitpix, output_width, output_height, block_rows);
+}
+
+/**
+ * @brief   Resamples the image of an HDU into a new FITS file without loading the whole image
+ * @details The source is read block_rows rows at a time, so images larger than memory can be resampled
+ * @param[in] source_path Location of the FITS file holding the image
+ * @param[in] hdu_index Index of the HDU holding the image ( 0 for the primary HDU )
+ * @param[in] destination_path Location of the resampled image, written as the primary HDU of a new file
+ * @param[in] output_width Number of columns of the resampled image
+ * @param[in] output_height Number of rows of the resampled image
+ * @param[in] method Interpolation kernel
+ * @param[in] output_bitpix Type of the pixels of the resampled image
+ * @param[in] block_rows Number of source rows read at a time
+ * @throws std::invalid_argument If the HDU does not hold an image
+ * @throws file_reading_exception If the source cannot be read
+ * @throws file_writing_exception If the destination cannot be written
+*/
+inline void resample_image_file(const std::string& source_path, std::size_t hdu_index,
+    const std::string& destination_path, std::size_t output_width, std::size_t output_height,
+    interpolation method = interpolation::bilinear, bitpix output_bitpix = bitpix::_B32,
+    std::size_t block_rows = 256) {
+    detail::image_row_reader reader(source_path, hdu_index);
+
+    detail::stream_image_file(reader, [&](auto output_pixel) {
+        return image_resampler<decltype(output_pixel)>(reader.width(), reader.height(), output_width,
+            output_height, method);
+    }, destination_path, output_bitpix, output_width, output_height, block_rows);
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_RESAMPLING_HPP
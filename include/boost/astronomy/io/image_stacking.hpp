@@ -0,0 +1,418 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_STACKING_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_STACKING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_view.hpp>
+#include <boost/astronomy/io/image_writer.hpp>
+#include <boost/astronomy/io/image_resampling.hpp>
+#include <boost/astronomy/io/sigma_clipping.hpp>
+
+/**
+ * @file    image_stacking.hpp
+ * @details Per pixel combination of a stack of frames of equal dimensions, such as the bias, dark or flat frames
+ *          combined into a master calibration frame.
+ *          Pixels are combined in blocks of 64: the values of a block are laid out frame after frame so that for
+ *          stacks of up to 64 frames a sorting network sorts all 64 pixels at once with vectorized min / max
+ *          operations, taller stacks are sorted pixel by pixel.
+ *          Stacks stored in files are read a band of full rows at a time from every frame, with the band height
+ *          chosen so that the frame rows held at once stay within a memory budget, and the combined band is
+ *          appended to the output before the next one is read
+*/
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief Per pixel statistic combining a stack of frames
+*/
+enum class stack_method {
+    mean,
+    median,
+    sigma_clipped_mean      //! Mean of the values left by iterative sigma clipping ( as sigma_clipped_stats does )
+};
+
+/**
+ * @brief Controls the combination of a stack of frames
+*/
+struct stack_options {
+    stack_method method = stack_method::median;
+    sigma_clip_options clipping;    //! Limits, iterations and center of sigma_clipped_mean ( its threads are unused )
+    std::size_t memory_budget = std::size_t(256) << 20;     //! Bytes of rows held at once when stacking files
+    std::size_t threads = 0;        //! Number of threads ( 0 uses the number of hardware threads )
+};
+
+namespace detail {
+
+    /**
+     * @brief Type in which the values of a stack of PixelType frames are combined
+    */
+    template<typename PixelType>
+    struct stack_value {
+        typedef typename std::conditional<std::is_floating_point<PixelType>::value ? sizeof(PixelType) <= 4 :
+            sizeof(PixelType) <= 2, float, double>::type type;
+    };
+
+    /**
+     * @brief   Comparators of Batcher's odd-even merge sort for a stack of the given height
+     * @details When only the ranks in wanted are needed, the comparators that cannot affect them are left out
+    */
+    inline std::vector<std::pair<std::size_t, std::size_t>> sorting_network(std::size_t height,
+        std::vector<std::size_t> const& wanted = {}) {
+        std::vector<std::pair<std::size_t, std::size_t>> network;
+        for (std::size_t p = 1; p < height; p *= 2) {
+            for (std::size_t k = p; k >= 1; k /= 2) {
+                for (std::size_t j = k % p; j + k < height; j += 2 * k) {
+                    for (std::size_t i = 0; i < std::min(k, height - j - k); i++) {
+                        if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) { network.emplace_back(i + j, i + j + k); }
+                    }
+                }
+            }
+        }
+        if (wanted.empty()) { return network; }
+
+        std::vector<bool> needed(height, false);
+        for (std::size_t rank : wanted) { needed[rank] = true; }
+        std::vector<std::pair<std::size_t, std::size_t>> pruned;
+        for (auto comparator = network.rbegin(); comparator != network.rend(); ++comparator) {
+            if (needed[comparator->first] || needed[comparator->second]) {
+                needed[comparator->first] = needed[comparator->second] = true;
+                pruned.push_back(*comparator);
+            }
+        }
+        std::reverse(pruned.begin(), pruned.end());
+        return pruned;
+    }
+
+    /**
+     * @brief   Combines the values of a stack of frames pixel by pixel
+     * @details The scratch space is sized by the number of frames, so every thread keeps its own combiner
+    */
+    template<typename T>
+    class stack_combiner {
+    public:
+        enum : std::size_t {
+            lanes = 64,             //! Pixels combined at once
+            network_limit = 64      //! Largest stack sorted by a sorting network
+        };
+
+    private:
+        stack_options options;
+        std::size_t frames;
+        std::vector<std::pair<std::size_t, std::size_t>> network;
+        std::vector<T> block;           // lanes values of every frame, frame after frame
+        std::vector<T> column;          // Values of a single pixel
+        std::vector<double> sums;
+        std::vector<double> sums_squares;
+        double totals[lanes];
+
+        /**
+         * @brief Mean of the values left by sigma clipping the ascending values[0, count)
+        */
+        double clipped_mean(const T* values, std::size_t count) {
+            double reference = static_cast<double>(values[count / 2]);
+            sums[0] = sums_squares[0] = 0;
+            for (std::size_t i = 0; i < count; i++) {
+                double deviation = static_cast<double>(values[i]) - reference;
+                sums[i + 1] = sums[i] + deviation;
+                sums_squares[i + 1] = sums_squares[i] + deviation * deviation;
+            }
+
+            // The values left are always a contiguous range of the sorted ones
+            std::size_t low = 0, high = count;
+            sigma_clip_options const& clipping = options.clipping;
+            for (std::size_t iteration = 0; iteration < clipping.max_iterations && low < high; iteration++) {
+                double left = static_cast<double>(high - low);
+                double mean = (sums[high] - sums[low]) / left;
+                double deviation = std::sqrt(std::max(0.0, (sums_squares[high] - sums_squares[low]) / left - mean * mean));
+                double center = clipping.center == clip_center::mean ? reference + mean :
+                    0.5 * (static_cast<double>(values[low + (high - low - 1) / 2]) +
+                        static_cast<double>(values[low + (high - low) / 2]));
+                double lower = center - clipping.sigma_lower * deviation;
+                double upper = center + clipping.sigma_upper * deviation;
+
+                std::size_t kept_low = low, kept_high = high;
+                while (kept_low < kept_high && static_cast<double>(values[kept_low]) < lower) { kept_low++; }
+                while (kept_high > kept_low && static_cast<double>(values[kept_high - 1]) > upper) { kept_high--; }
+                if (kept_low == low && kept_high == high) { break; }
+                low = kept_low;
+                high = kept_high;
+            }
+            if (low == high) { return std::numeric_limits<double>::quiet_NaN(); }
+            return reference + (sums[high] - sums[low]) / static_cast<double>(high - low);
+        }
+
+        /**
+         * @brief Combines the count values of column, which it may reorder
+        */
+        double combine_column(std::size_t count) {
+            if (count == 0) { return std::numeric_limits<double>::quiet_NaN(); }
+            T* values = column.data();
+            switch (options.method) {
+            case stack_method::mean: {
+                double sum = 0;
+                for (std::size_t i = 0; i < count; i++) { sum += static_cast<double>(values[i]); }
+                return sum / static_cast<double>(count);
+            }
+            case stack_method::median: {
+                std::nth_element(values, values + count / 2, values + count);
+                double upper = static_cast<double>(values[count / 2]);
+                if (count % 2 == 1) { return upper; }
+                return 0.5 * (static_cast<double>(*std::max_element(values, values + count / 2)) + upper);
+            }
+            default:
+                std::sort(values, values + count);
+                return clipped_mean(values, count);
+            }
+        }
+
+        /**
+         * @brief Combines the block pixels by pixel, leaving out the values that are NaN or infinite
+        */
+        template<typename Result>
+        void combine_usable(std::size_t count, Result* output) {
+            for (std::size_t x = 0; x < count; x++) {
+                std::size_t usable = 0;
+                for (std::size_t frame = 0; frame < frames; frame++) {
+                    T value = block[frame * lanes + x];
+                    if (std::isfinite(value)) { column[usable++] = value; }
+                }
+                output[x] = pixel_cast<Result>(combine_column(usable));
+            }
+        }
+
+        template<typename Source>
+        static bool all_finite(const T*, std::size_t, std::true_type /*integer source*/) { return true; }
+
+        template<typename Source>
+        static bool all_finite(const T* values, std::size_t count, std::false_type /*floating point source*/) {
+            bool finite = true;
+            for (std::size_t i = 0; i < count; i++) {
+                finite &= std::fabs(values[i]) <= std::numeric_limits<T>::max();
+            }
+            return finite;
+        }
+
+    public:
+        stack_combiner(std::size_t frame_count, stack_options const& stacking)
+            :options(stacking), frames(frame_count), block(frame_count * lanes), column(frame_count),
+            sums(frame_count + 1), sums_squares(frame_count + 1) {
+            if (frames > network_limit || options.method == stack_method::mean) { return; }
+            if (options.method == stack_method::median) {
+                network = sorting_network(frames, { (frames - 1) / 2, frames / 2 });
+            }
+            else {
+                network = sorting_network(frames);
+            }
+        }
+
+        /**
+         * @brief Combines count ( at most lanes ) consecutive pixels, whose values in each frame start at rows[frame]
+        */
+        template<typename Source, typename Result>
+        void combine(const Source* const* rows, std::size_t count, Result* output) {
+            for (std::size_t frame = 0; frame < frames; frame++) {
+                T* values = block.data() + frame * lanes;
+                for (std::size_t x = 0; x < count; x++) { values[x] = static_cast<T>(rows[frame][x]); }
+                std::fill(values + count, values + lanes, T(0));
+            }
+            bool sortable = frames <= network_limit || options.method == stack_method::mean;
+            if (!sortable || !all_finite<Source>(block.data(), block.size(), std::is_integral<Source>())) {
+                combine_usable(count, output);
+                return;
+            }
+
+            if (options.method == stack_method::mean) {
+                std::fill(totals, totals + lanes, 0.0);
+                for (std::size_t frame = 0; frame < frames; frame++) {
+                    const T* values = block.data() + frame * lanes;
+                    for (std::size_t x = 0; x < lanes; x++) { totals[x] += static_cast<double>(values[x]); }
+                }
+                for (std::size_t x = 0; x < count; x++) {
+                    output[x] = pixel_cast<Result>(totals[x] / static_cast<double>(frames));
+                }
+                return;
+            }
+
+            for (auto const& comparator : network) {
+                T* first = block.data() + comparator.first * lanes;
+                T* second = block.data() + comparator.second * lanes;
+                for (std::size_t x = 0; x < lanes; x++) {
+                    T low = std::min(first[x], second[x]);
+                    T high = std::max(first[x], second[x]);
+                    first[x] = low;
+                    second[x] = high;
+                }
+            }
+
+            if (options.method == stack_method::median) {
+                const T* lower = block.data() + (frames - 1) / 2 * lanes;
+                const T* upper = block.data() + frames / 2 * lanes;
+                for (std::size_t x = 0; x < count; x++) {
+                    output[x] = pixel_cast<Result>(0.5 * (static_cast<double>(lower[x]) + static_cast<double>(upper[x])));
+                }
+                return;
+            }
+            for (std::size_t x = 0; x < count; x++) {
+                for (std::size_t frame = 0; frame < frames; frame++) { column[frame] = block[frame * lanes + x]; }
+                output[x] = pixel_cast<Result>(clipped_mean(column.data(), frames));
+            }
+        }
+    };
+
+    inline void check_stack_options(stack_options const& options) {
+        if (options.clipping.sigma_lower < 0 || options.clipping.sigma_upper < 0) {
+            throw std::invalid_argument("Clipping limits must not be negative");
+        }
+    }
+
+    /**
+     * @brief Combines rows first_row to last_row - 1 of frames whose rows start at row_pointer(frame, y)
+    */
+    template<typename T, typename Result, typename RowPointer>
+    inline void stack_band(std::size_t frames, std::size_t width, std::size_t first_row, std::size_t last_row,
+        stack_options const& options, RowPointer const& row_pointer, Result* destination) {
+        stack_combiner<T> combiner(frames, options);
+        typedef typename std::remove_reference<decltype(*row_pointer(0, 0))>::type source_type;
+        std::vector<const source_type*> rows(frames);
+        for (std::size_t y = first_row; y < last_row; y++) {
+            for (std::size_t x = 0; x < width; x += combiner.lanes) {
+                for (std::size_t frame = 0; frame < frames; frame++) { rows[frame] = row_pointer(frame, y) + x; }
+                combiner.combine(rows.data(), std::min<std::size_t>(combiner.lanes, width - x), destination + y * width + x);
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Combines a stack of frames pixel by pixel
+ * @details Values that are NaN or infinite are left out of the pixels they belong to, and a pixel without any
+ *          other value is NaN ( 0 for integer results ). The medians of even numbers of values are the means of
+ *          the two middle values. Every result is rounded and saturated to Result
+ * @param[in] frames Frames to be combined, all of the same dimensions
+ * @param[out] destination Storage for the combined pixels, stored row after row
+ * @param[in] options Statistic combining the frames and number of threads
+ * @throws std::invalid_argument If there is no frame, the frames differ in dimensions or a clipping limit is
+ *         negative
+*/
+template<typename Result, typename PixelType>
+void stack_images(std::vector<image_view<PixelType>> const& frames, Result* destination,
+    stack_options const& options = stack_options()) {
+    detail::check_stack_options(options);
+    if (frames.empty()) { throw std::invalid_argument("No frame to stack"); }
+    std::size_t width = frames[0].width, height = frames[0].height;
+    for (auto const& frame : frames) {
+        if (frame.width != width || frame.height != height) {
+            throw std::invalid_argument("Frames differ in dimensions");
+        }
+    }
+
+    detail::run_row_bands(height, 0, width * frames.size(), options.threads,
+        [&](std::size_t first_row, std::size_t last_row) {
+            detail::stack_band<typename detail::stack_value<PixelType>::type>(frames.size(), width, first_row,
+                last_row, options, [&](std::size_t frame, std::size_t y) { return frames[frame].row(y); }, destination);
+        });
+}
+
+/**
+ * @brief Combines a stack of frames pixel by pixel ( see above )
+ * @return Combined image of pixels of type Result
+ * @throws std::invalid_argument If there is no frame, the frames differ in dimensions or a clipping limit is
+ *         negative
+*/
+template<typename Result = double, typename PixelType>
+image_buffer<Result> stack_images(std::vector<image_view<PixelType>> const& frames,
+    stack_options const& options = stack_options()) {
+    if (frames.empty()) { throw std::invalid_argument("No frame to stack"); }
+    image_buffer<Result> stacked(frames[0].width, frames[0].height);
+    stack_images(frames, stacked.data(), options);
+    return stacked;
+}
+
+/**
+ * @brief   Combines the images of a stack of FITS files pixel by pixel into a new FITS file
+ * @details Every frame is read a band of full rows at a time with positional reads from its data unit, and
+ *          each combined band is written before the next is read. The band height is the largest for which the
+ *          rows of every frame, converted to float ( double when a frame has 32 bit integer or 64 bit pixels ),
+ *          the encoded rows of a frame and the combined rows fit in options.memory_budget. Pixels are combined as
+ *          stack_images does
+ * @param[in] source_paths Locations of the FITS files holding the frames
+ * @param[in] hdu_index Index of the HDU holding the frame in every file ( 0 for the primary HDU )
+ * @param[in] destination_path Location of the combined image, written as the primary HDU of a new file
+ * @param[in] options Statistic combining the frames, memory budget and number of threads
+ * @param[in] output_bitpix Type of the pixels of the combined image
+ * @throws std::invalid_argument If there is no frame, an HDU does not hold an image, the frames differ in
+ *         dimensions, a clipping limit is negative or the budget cannot hold one row of every frame
+ * @throws file_reading_exception If a frame cannot be read
+ * @throws file_writing_exception If the destination cannot be written
+*/
+inline void stack_image_files(std::vector<std::string> const& source_paths, std::size_t hdu_index,
+    const std::string& destination_path, stack_options const& options = stack_options(),
+    bitpix output_bitpix = bitpix::_B32) {
+    detail::check_stack_options(options);
+    if (source_paths.empty()) { throw std::invalid_argument("No frame to stack"); }
+    std::deque<detail::image_row_reader> readers;
+    bool single_precision = true;
+    for (auto const& path : source_paths) {
+        readers.emplace_back(path, hdu_index);
+        if (readers.back().width() != readers.front().width() || readers.back().height() != readers.front().height()) {
+            throw std::invalid_argument("Frames differ in dimensions");
+        }
+        bitpix frame_bitpix = readers.back().pixel_bitpix();
+        single_precision &= frame_bitpix == bitpix::B8 || frame_bitpix == bitpix::B16 || frame_bitpix == bitpix::_B32;
+    }
+    std::size_t frames = readers.size();
+    std::size_t width = readers.front().width(), height = readers.front().height();
+
+    image_writer writer(destination_path, output_bitpix, { width, height });
+    auto stack = [&](auto working_value, auto output_pixel) {
+        typedef decltype(working_value) working_type;
+        typedef decltype(output_pixel) output_type;
+        std::size_t row_bytes = width * (frames * sizeof(working_type) + sizeof(std::int64_t) + sizeof(output_type));
+        std::size_t band_rows = std::min(height, options.memory_budget / row_bytes);
+        if (band_rows == 0) { throw std::invalid_argument("Memory budget cannot hold one row of every frame"); }
+
+        std::vector<std::vector<working_type>> bands(frames, std::vector<working_type>(band_rows * width));
+        std::vector<output_type> combined(band_rows * width);
+        std::string raw;
+        for (std::size_t first_row = 0; first_row < height; first_row += band_rows) {
+            std::size_t rows = std::min(band_rows, height - first_row);
+            for (std::size_t frame = 0; frame < frames; frame++) {
+                readers[frame].read_rows(first_row, rows, bands[frame].data(), raw);
+            }
+            detail::run_row_bands(rows, 0, width * frames, options.threads,
+                [&](std::size_t first, std::size_t last) {
+                    detail::stack_band<working_type>(frames, width, first, last, options,
+                        [&](std::size_t frame, std::size_t y) {
+                            return static_cast<const working_type*>(bands[frame].data() + y * width);
+                        }, combined.data());
+                });
+            writer.write_rows(combined.data(), rows);
+        }
+    };
+    detail::visit_bitpix(output_bitpix, [&](auto output_pixel) {
+        if (single_precision) { stack(float(), output_pixel); }
+        else { stack(double(), output_pixel); }
+    });
+    writer.close();
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_STACKING_HPP
@@ -0,0 +1,181 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_VIEW_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_VIEW_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/parallel.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief   Read only view of a rectangular block of pixels stored row after row
+ * @details Rows are stride pixels apart, so a view can cover a tile of a larger image without copying it.
+ *          x runs along a row ( NAXIS1 ) and y across the rows
+ * @tparam  PixelType Type of the pixels
+*/
+template<typename PixelType>
+struct image_view {
+    typedef PixelType pixel_type;
+
+    const PixelType* pixels = nullptr;
+    std::size_t width = 0;
+    std::size_t height = 0;
+    std::size_t stride = 0;   //! Number of pixels from the start of a row to the start of the next one
+
+    image_view() {}
+
+    /**
+     * @brief Creates a view of width x height pixels whose rows are stride pixels apart ( width if 0 )
+    */
+    image_view(const PixelType* first_pixel, std::size_t view_width, std::size_t view_height, std::size_t row_stride = 0)
+        :pixels(first_pixel), width(view_width), height(view_height), stride(row_stride == 0 ? view_width : row_stride) {}
+
+    /**
+     * @brief Returns the first pixel of row y
+    */
+    const PixelType* row(std::size_t y) const { return pixels + y * stride; }
+
+    /**
+     * @brief Returns the pixel at column x of row y
+    */
+    PixelType operator()(std::size_t x, std::size_t y) const { return pixels[y * stride + x]; }
+
+    /**
+     * @brief Returns the number of pixels in the view
+    */
+    std::size_t size() const { return width * height; }
+
+    /**
+     * @brief Returns the view of a tile of this view
+     * @throws std::out_of_range If the tile does not lie inside the view
+    */
+    image_view tile(std::size_t x, std::size_t y, std::size_t tile_width, std::size_t tile_height) const {
+        if (x + tile_width > width || y + tile_height > height) {
+            throw std::out_of_range("Tile lies outside the image");
+        }
+        return image_view(pixels + y * stride + x, tile_width, tile_height, stride);
+    }
+};
+
+/**
+ * @brief Returns a view of all pixels of image
+ * @throws std::invalid_argument If the image holds pixels but its width and height are not known
+*/
+template<typename PixelType>
+image_view<PixelType> make_image_view(const image_buffer<PixelType>& image) {
+    if (image.width() * image.height() != image.size()) {
+        throw std::invalid_argument("Image dimensions do not match the number of pixels");
+    }
+    return image_view<PixelType>(image.data(), image.width(), image.height());
+}
+
+namespace detail {
+
+    /**
+     * @brief Type used for summing pixels of type T without overflow or loss of precision
+    */
+    template<typename T>
+    struct pixel_accumulator {
+        typedef typename std::conditional<std::is_integral<T>::value, std::int64_t, double>::type type;
+    };
+
+    /**
+     * @brief Converts a value to a pixel of type Result, rounding to nearest and saturating for integer pixels
+     * @note  NaN becomes 0 for integer pixels
+    */
+    template<typename Result, typename T>
+    inline Result pixel_cast(T value, std::true_type /*integer result*/, std::true_type /*integer value*/) {
+        typedef typename std::conditional<std::is_signed<T>::value, std::int64_t, std::uint64_t>::type wide_type;
+        typedef std::numeric_limits<Result> limits;
+        wide_type wide = static_cast<wide_type>(value);
+        if (std::is_signed<T>::value && static_cast<std::int64_t>(wide) < static_cast<std::int64_t>(limits::lowest())) {
+            return limits::lowest();
+        }
+        if (wide > static_cast<wide_type>(0) && static_cast<std::uint64_t>(wide) > static_cast<std::uint64_t>(limits::max())) {
+            return limits::max();
+        }
+        return static_cast<Result>(value);
+    }
+
+    template<typename Result, typename T>
+    inline Result pixel_cast(T value, std::true_type /*integer result*/, std::false_type /*floating point value*/) {
+        typedef std::numeric_limits<Result> limits;
+        if (sizeof(Result) <= 4) {
+            // Adding and removing 1.5 * 2^52 rounds like std::nearbyint does below 2^51 and leaves larger values
+            // beyond the limits of Result, without a call or a branch that would keep the loop from vectorizing
+            double rounded = (static_cast<double>(value) + 6755399441055744.0) - 6755399441055744.0;
+            rounded = std::isnan(rounded) ? 0.0 : rounded;
+            rounded = rounded < static_cast<double>(limits::lowest()) ? static_cast<double>(limits::lowest()) : rounded;
+            rounded = rounded > static_cast<double>(limits::max()) ? static_cast<double>(limits::max()) : rounded;
+            return static_cast<Result>(rounded);
+        }
+        if (std::isnan(value)) { return Result(0); }
+        double rounded = std::nearbyint(static_cast<double>(value));
+        if (rounded < static_cast<double>(limits::lowest())) { return limits::lowest(); }
+        if (rounded >= static_cast<double>(limits::max())) { return limits::max(); }
+        return static_cast<Result>(rounded);
+    }
+
+    template<typename Result, typename T, typename IntegerValue>
+    inline Result pixel_cast(T value, std::false_type /*floating point result*/, IntegerValue) {
+        return static_cast<Result>(value);
+    }
+
+    template<typename Result, typename T>
+    inline Result pixel_cast(T value) {
+        return pixel_cast<Result>(value, std::is_integral<Result>(), std::is_integral<T>());
+    }
+
+    /**
+     * @brief Calls function with a value of the pixel type given by BITPIX, for code written once for every type
+    */
+    template<typename Function>
+    inline void visit_bitpix(bitpix bitpix_value, Function&& function) {
+        switch (bitpix_value) {
+        case bitpix::B8: function(bitpix_type<bitpix::B8>::underlying_type()); break;
+        case bitpix::B16: function(bitpix_type<bitpix::B16>::underlying_type()); break;
+        case bitpix::B32: function(bitpix_type<bitpix::B32>::underlying_type()); break;
+        case bitpix::_B32: function(bitpix_type<bitpix::_B32>::underlying_type()); break;
+        case bitpix::_B64: function(bitpix_type<bitpix::_B64>::underlying_type()); break;
+        }
+    }
+
+    /**
+     * @brief   Splits rows into bands and calls task( first_row, last_row ) for every band on a pool of threads
+     * @details The bands are run by run_parallel, so an exception thrown by a band is rethrown once all threads
+     *          have finished
+     * @param[in] rows Number of rows to be processed
+     * @param[in] band_rows Preferred number of rows per band ( 0 chooses bands of about 64 KiB of pixels )
+     * @param[in] row_pixels Number of pixels in a row, used for choosing the band size
+     * @param[in] threads Number of threads to use ( 0 uses the number of hardware threads )
+    */
+    template<typename Task>
+    inline void run_row_bands(std::size_t rows, std::size_t band_rows, std::size_t row_pixels, std::size_t threads,
+        Task const& task) {
+        if (rows == 0) { return; }
+        if (band_rows == 0) { band_rows = std::max<std::size_t>(1, (std::size_t(1) << 16) / std::max<std::size_t>(1, row_pixels)); }
+        std::size_t bands = (rows + band_rows - 1) / band_rows;
+        run_parallel(bands, threads, [&](std::size_t band) {
+            task(band * band_rows, std::min(rows, (band + 1) * band_rows));
+        });
+    }
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_VIEW_HPP
@@ -0,0 +1,278 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_WRITER_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_WRITER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/integer.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/io/default_card_policy.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/io/image_view.hpp>
+#include <boost/astronomy/io/table_schema.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+namespace detail {
+
+    /**
+     * @brief Converts count values to the pixel type of the image with pixel_cast and stores them in big endian
+     *        byte order
+    */
+    template<typename Pixel, typename T>
+    inline void encode_pixels(const T* values, std::size_t count, char* destination) {
+        typedef typename boost::uint_t<8 * sizeof(Pixel)>::exact bits_type;
+        for (std::size_t i = 0; i < count; i++) {
+            store_big_endian<Pixel, bits_type>(pixel_cast<Pixel>(values[i]), destination + i * sizeof(Pixel));
+        }
+    }
+}
+
+/**
+ * @brief   Writes an image HDU block by block without holding the image in memory
+ * @details The header is written when the writer is created. Pixels are supplied either as consecutive
+ *          blocks of rows or as rectangular tiles in any order; they are converted to the type given by
+ *          BITPIX and byte swapped into a single reusable buffer which is then written at their place in
+ *          the data unit. The memory used is the size of that buffer regardless of the size of the image.
+ *          close() fills the pixels that were never written with zeros and pads the data unit to a
+ *          multiple of 2880 bytes
+ * @tparam  FileWriter Stream used for writing the file ( e.g fits_stream )
+ * @tparam  CardPolicy Policy of the header cards
+ * @author  agent
+*/
+template<typename FileWriter, typename CardPolicy>
+class basic_image_writer {
+    FileWriter file_writer;
+    bitpix bitpix_value;
+    std::vector<std::size_t> axes;
+    std::size_t element_size;
+    std::size_t total_pixels;
+    std::size_t data_location;
+    std::size_t next_pixel;
+    std::size_t data_written;
+    std::string buffer;
+    bool closed;
+
+public:
+    /**
+     * @brief Creates the file and writes the header of the image
+     * @param[in] path Location of the file
+     * @param[in] bitpix_val Type of the pixels stored in the file
+     * @param[in] naxis Number of pixels along each axis ( NAXIS1, NAXIS2 ... )
+     * @param[in] extname Name of the HDU ( EXTNAME is omitted if empty )
+     * @param[in] append Whether the image is appended as an IMAGE extension to an existing FITS file
+     *            instead of being the primary HDU of a new file
+     * @param[in] buffer_size Size in bytes of the conversion buffer
+     * @throws file_writing_exception If the file cannot be created or written
+     * @throws file_reading_exception If the file to append to cannot be opened or is not a sequence of logical records
+    */
+    basic_image_writer(std::string const& path, bitpix bitpix_val, std::vector<std::size_t> const& naxis,
+        std::string const& extname = "", bool append = false, std::size_t buffer_size = 1 << 20)
+        :bitpix_value(bitpix_val), axes(naxis),
+        element_size(static_cast<std::size_t>(get_element_size_from_bitpix(bitpix_val))),
+        total_pixels(naxis.empty() ? 0 : 1), data_location(0), next_pixel(0), data_written(0), closed(false) {
+
+        for (std::size_t axis : axes) { total_pixels *= axis; }
+        buffer.resize(std::max(buffer_size - buffer_size % element_size, element_size));
+
+        if (append) {
+            file_writer.set_file_for_update(path);
+            data_location = file_writer.file_size();
+            if (data_location % 2880 != 0) {
+                throw file_reading_exception("File does not end at the boundary of a logical record");
+            }
+        }
+        else if (!file_writer.create_file(path)) {
+            throw file_writing_exception("Cannot Create File");
+        }
+
+        header<CardPolicy> image_header = build_header(extname, append);
+        if (!file_writer.write(image_header.raw_records(), data_location)) {
+            throw file_writing_exception("Cannot Write To File");
+        }
+        data_location += image_header.raw_records().size();
+    }
+
+    basic_image_writer(basic_image_writer const&) = delete;
+    basic_image_writer& operator=(basic_image_writer const&) = delete;
+
+    /**
+     * @brief Closes the image if it has not been closed yet ( errors are ignored )
+    */
+    ~basic_image_writer() {
+        try { close(); }
+        catch (...) {}
+    }
+
+    /**
+     * @brief Returns the number of pixels in the image
+    */
+    std::size_t size() const { return total_pixels; }
+
+    /**
+     * @brief Returns the number of pixels written so far by write_pixels and write_rows
+    */
+    std::size_t pixels_written() const { return next_pixel; }
+
+    /**
+     * @brief Appends pixels after the ones written by the previous call in the order they are stored in the file
+     * @details The values are converted to the type given by BITPIX as image_view does: integer pixels are rounded
+     *          to nearest and saturated, NaN becomes 0
+     * @param[in] pixels Start of the pixel values
+     * @param[in] count Number of pixels
+     * @throws file_writing_exception If the pixels do not fit in the image or cannot be written
+    */
+    template<typename T>
+    void write_pixels(const T* pixels, std::size_t count) {
+        if (count > total_pixels - next_pixel) {
+            throw file_writing_exception("More pixels written than the image holds");
+        }
+        write_converted(pixels, count, next_pixel);
+        next_pixel += count;
+    }
+
+    /**
+     * @brief Appends complete rows ( NAXIS1 pixels each ) after the ones written previously
+     * @param[in] pixels Start of the first row
+     * @param[in] rows Number of rows
+     * @throws file_writing_exception If the rows do not fit in the image or cannot be written
+    */
+    template<typename T>
+    void write_rows(const T* pixels, std::size_t rows) {
+        write_pixels(pixels, rows * (axes.empty() ? 0 : axes[0]));
+    }
+
+    /**
+     * @brief Writes a rectangular tile of a plane of the image
+     * @details Tiles may be written in any order. The rows of the tile are stored one after another
+     * @param[in] tile Pixels of the tile ( tile_width * tile_height values )
+     * @param[in] x Column of the first pixel of the tile ( 0 based )
+     * @param[in] y Row of the first pixel of the tile ( 0 based )
+     * @param[in] tile_width Number of pixels in a row of the tile
+     * @param[in] tile_height Number of rows in the tile
+     * @param[in] plane Index of the plane for images with more than two axes
+     * @throws file_writing_exception If the tile lies outside the image or cannot be written
+    */
+    template<typename T>
+    void write_tile(const T* tile, std::size_t x, std::size_t y, std::size_t tile_width, std::size_t tile_height,
+        std::size_t plane = 0) {
+        std::size_t width = axes.empty() ? 0 : axes[0];
+        std::size_t height = axes.size() < 2 ? 1 : axes[1];
+        std::size_t plane_size = width * height;
+        if (x + tile_width > width || y + tile_height > height || (plane + 1) * plane_size > total_pixels) {
+            throw file_writing_exception("Tile lies outside the image");
+        }
+
+        for (std::size_t row = 0; row < tile_height; row++) {
+            write_converted(tile + row * tile_width, tile_width, plane * plane_size + (y + row) * width + x);
+        }
+    }
+
+    /**
+     * @brief Fills the unwritten end of the image with zeros and pads the data unit
+     * @throws file_writing_exception If the file cannot be written
+     * @note Calling close more than once has no effect
+    */
+    void close() {
+        if (closed) { return; }
+        closed = true;
+
+        std::size_t data_size = total_pixels * element_size;
+        std::size_t padded_size = (data_size + 2879) / 2880 * 2880;
+        std::fill(buffer.begin(), buffer.end(), '\0');
+        while (data_written < padded_size) {
+            std::size_t chunk = std::min(buffer.size(), padded_size - data_written);
+            write_buffer(chunk, data_written);
+        }
+        file_writer.flush();
+        file_writer.close();
+    }
+
+private:
+    template<typename ValueType>
+    static card<CardPolicy> make_card(std::string const& key, ValueType value) {
+        card<CardPolicy> new_card;
+        new_card.create_card(key, value);
+        return new_card;
+    }
+
+    header<CardPolicy> build_header(std::string const& extname, bool extension) const {
+        static const int bitpix_values[] = { 8, 16, 32, -32, -64 };
+
+        header<CardPolicy> image_header;
+        if (extension) {
+            image_header.add_card(make_card("XTENSION", std::string("IMAGE")));
+        }
+        else {
+            image_header.add_card(make_card("SIMPLE", true));
+        }
+        image_header.add_card(make_card("BITPIX", bitpix_values[static_cast<int>(bitpix_value)]));
+        image_header.add_card(make_card("NAXIS", static_cast<long long>(axes.size())));
+        for (std::size_t i = 0; i < axes.size(); i++) {
+            image_header.add_card(make_card("NAXIS" + boost::lexical_cast<std::string>(i + 1),
+                static_cast<long long>(axes[i])));
+        }
+        if (extension) {
+            image_header.add_card(make_card("PCOUNT", 0));
+            image_header.add_card(make_card("GCOUNT", 1));
+        }
+        else {
+            image_header.add_card(make_card("EXTEND", true));
+        }
+        if (!extname.empty()) { image_header.add_card(make_card("EXTNAME", extname)); }
+        image_header.add_card(card<CardPolicy>("END" + std::string(77, ' ')));
+        return image_header;
+    }
+
+    /**
+     * @brief Converts the pixels into the buffer chunk by chunk and writes them starting at pixel index first
+    */
+    template<typename T>
+    void write_converted(const T* pixels, std::size_t count, std::size_t first) {
+        static_assert(std::is_arithmetic<T>::value, "Pixels must be of an arithmetic type");
+
+        std::size_t chunk_pixels = buffer.size() / element_size;
+        for (std::size_t done = 0; done < count; done += chunk_pixels) {
+            std::size_t chunk = std::min(chunk_pixels, count - done);
+            switch (bitpix_value) {
+            case bitpix::B8: detail::encode_pixels<bitpix_type<bitpix::B8>::underlying_type>(pixels + done, chunk, &buffer[0]); break;
+            case bitpix::B16: detail::encode_pixels<bitpix_type<bitpix::B16>::underlying_type>(pixels + done, chunk, &buffer[0]); break;
+            case bitpix::B32: detail::encode_pixels<bitpix_type<bitpix::B32>::underlying_type>(pixels + done, chunk, &buffer[0]); break;
+            case bitpix::_B32: detail::encode_pixels<bitpix_type<bitpix::_B32>::underlying_type>(pixels + done, chunk, &buffer[0]); break;
+            case bitpix::_B64: detail::encode_pixels<bitpix_type<bitpix::_B64>::underlying_type>(pixels + done, chunk, &buffer[0]); break;
+            }
+            write_buffer(chunk * element_size, (first + done) * element_size);
+        }
+    }
+
+    /**
+     * @brief Writes the first size bytes of the buffer at the given offset from the start of the data unit
+    */
+    void write_buffer(std::size_t size, std::size_t offset) {
+        if (!file_writer.write(buffer.data(), size, data_location + offset)) {
+            throw file_writing_exception("Cannot Write To File");
+        }
+        data_written = std::max(data_written, offset + size);
+    }
+};
+
+using image_writer = basic_image_writer<fits_stream, card_policy>;
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_WRITER_HPP
@@ -0,0 +1,221 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_IO_OBSERVER_HPP
+#define BOOST_ASTRONOMY_IO_IO_OBSERVER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief Phases in which the reading of an HDU is divided
+*/
+enum class io_phase {
+    header_parse, //! Reading and parsing the header cards
+    data_read,    //! Reading the raw data unit from the file
+    decode        //! Constructing the HDU object from header and raw data
+};
+
+/**
+ * @brief   Observer which ignores all the events ( default observer of fits_io )
+ * @details An observer of fits_io must provide the members shown here. Since enabled is false
+ *          fits_io does not even read the clock, so instrumentation costs nothing unless asked for
+*/
+struct null_io_observer {
+    static constexpr bool enabled = false;
+
+    void hdu_started(std::size_t /*hdu_index*/, std::size_t /*header_location*/) {}
+    void phase_started(io_phase /*phase*/) {}
+    void phase_completed(io_phase /*phase*/, std::size_t /*bytes_read*/, std::chrono::nanoseconds /*elapsed*/) {}
+    void seeked(std::size_t /*position*/) {}
+    void hdu_completed(const std::string& /*hdu_name*/) {}
+};
+
+/**
+ * @brief Measurements of a single phase
+*/
+struct phase_statistics {
+    std::size_t bytes_read = 0;
+    std::chrono::nanoseconds elapsed{ 0 };
+    std::size_t allocations = 0;
+
+    phase_statistics& operator += (const phase_statistics& other) {
+        bytes_read += other.bytes_read;
+        elapsed += other.elapsed;
+        allocations += other.allocations;
+        return *this;
+    }
+};
+
+/**
+ * @brief Measurements of all the phases of a single HDU
+*/
+struct hdu_statistics {
+    std::size_t hdu_index = 0;
+    std::size_t header_location = 0;
+    std::string hdu_name;
+    std::size_t seeks = 0;
+    phase_statistics header_parse;
+    phase_statistics data_read;
+    phase_statistics decode;
+
+    /**
+     * @brief Returns the measurements of the given phase
+    */
+    phase_statistics& phase(io_phase io_phase_value) {
+        switch (io_phase_value) {
+        case io_phase::header_parse: return header_parse;
+        case io_phase::data_read: return data_read;
+        default: return decode;
+        }
+    }
+
+    std::size_t bytes_read() const { return header_parse.bytes_read + data_read.bytes_read; }
+    std::chrono::nanoseconds elapsed() const { return header_parse.elapsed + data_read.elapsed + decode.elapsed; }
+    std::size_t allocations() const { return header_parse.allocations + data_read.allocations + decode.allocations; }
+};
+
+/**
+ * @brief   Observer which collects the measurements of every HDU read by fits_io
+ * @details Allocations cannot be intercepted by a header only library, an application which counts
+ *          its allocations ( e.g by replacing the global operator new ) can supply allocation_counter
+ *          returning the running count, and the difference is recorded for every phase
+ * @author  agent
+*/
+struct io_statistics {
+    static constexpr bool enabled = true;
+
+    std::vector<hdu_statistics> hdus;
+    std::function<std::size_t()> allocation_counter;
+
+    io_statistics() {}
+
+    /**
+     * @brief Creates the observer with a function returning the running count of allocations
+    */
+    explicit io_statistics(std::function<std::size_t()> counter) :allocation_counter(std::move(counter)) {}
+
+    void hdu_started(std::size_t hdu_index, std::size_t header_location) {
+        hdus.emplace_back();
+        hdus.back().hdu_index = hdu_index;
+        hdus.back().header_location = header_location;
+    }
+
+    void phase_started(io_phase) {
+        allocations_at_start = allocation_counter ? allocation_counter() : 0;
+    }
+
+    void phase_completed(io_phase io_phase_value, std::size_t bytes_read, std::chrono::nanoseconds elapsed) {
+        phase_statistics& stats = hdus.back().phase(io_phase_value);
+        stats.bytes_read += bytes_read;
+        stats.elapsed += elapsed;
+        if (allocation_counter) { stats.allocations += allocation_counter() - allocations_at_start; }
+    }
+
+    void seeked(std::size_t) {
+        if (!hdus.empty()) { hdus.back().seeks++; }
+    }
+
+    void hdu_completed(const std::string& hdu_name) {
+        hdus.back().hdu_name = hdu_name;
+    }
+
+    /**
+     * @brief Returns the measurements summed over all the HDUs
+    */
+    hdu_statistics total() const {
+        hdu_statistics sum;
+        for (auto const& hdu : hdus) {
+            sum.seeks += hdu.seeks;
+            sum.header_parse += hdu.header_parse;
+            sum.data_read += hdu.data_read;
+            sum.decode += hdu.decode;
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Removes all the measurements collected so far
+    */
+    void clear() { hdus.clear(); }
+
+private:
+    std::size_t allocations_at_start = 0;
+};
+
+/**
+ * @brief Observer which forwards every event to the callbacks that are set
+ * @author agent
+*/
+struct callback_io_observer {
+    static constexpr bool enabled = true;
+
+    std::function<void(std::size_t, std::size_t)> on_hdu_started;
+    std::function<void(io_phase)> on_phase_started;
+    std::function<void(io_phase, std::size_t, std::chrono::nanoseconds)> on_phase_completed;
+    std::function<void(std::size_t)> on_seek;
+    std::function<void(const std::string&)> on_hdu_completed;
+
+    void hdu_started(std::size_t hdu_index, std::size_t header_location) {
+        if (on_hdu_started) { on_hdu_started(hdu_index, header_location); }
+    }
+    void phase_started(io_phase io_phase_value) {
+        if (on_phase_started) { on_phase_started(io_phase_value); }
+    }
+    void phase_completed(io_phase io_phase_value, std::size_t bytes_read, std::chrono::nanoseconds elapsed) {
+        if (on_phase_completed) { on_phase_completed(io_phase_value, bytes_read, elapsed); }
+    }
+    void seeked(std::size_t position) {
+        if (on_seek) { on_seek(position); }
+    }
+    void hdu_completed(const std::string& hdu_name) {
+        if (on_hdu_completed) { on_hdu_completed(hdu_name); }
+    }
+};
+
+/**
+ * @brief Measures a single phase and reports it to the observer
+ * @tparam IoObserver Observer to which the measurements are reported
+*/
+template<typename IoObserver, bool Enabled = IoObserver::enabled>
+class phase_recorder {
+    IoObserver& observer;
+    io_phase phase;
+    std::chrono::steady_clock::time_point start;
+public:
+    phase_recorder(IoObserver& io_observer, io_phase io_phase_value) :observer(io_observer), phase(io_phase_value) {
+        observer.phase_started(phase);
+        start = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * @brief Reports the completion of phase along with the number of bytes read during it
+    */
+    void finish(std::size_t bytes_read = 0) {
+        observer.phase_completed(phase, bytes_read,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start));
+    }
+};
+
+/**
+ * @brief Specialization for disabled observers which does not measure anything
+*/
+template<typename IoObserver>
+class phase_recorder<IoObserver, false> {
+public:
+    phase_recorder(IoObserver&, io_phase) {}
+    void finish(std::size_t = 0) {}
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IO_OBSERVER_HPP
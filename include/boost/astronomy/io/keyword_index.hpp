@@ -0,0 +1,592 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_KEYWORD_INDEX_HPP
+#define BOOST_ASTRONOMY_IO_KEYWORD_INDEX_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/io/default_card_policy.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/io/parallel.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief HDU matching a query of keyword_index
+*/
+struct keyword_match {
+    std::string path;
+    std::size_t hdu_index; //! Position of the HDU in the file ( 0 for primary HDU )
+};
+
+/**
+ * @brief Summary of an update of keyword_index
+*/
+struct keyword_index_update {
+    std::size_t files_scanned = 0;   //! New or modified files whose headers were read
+    std::size_t files_unchanged = 0; //! Files whose entries were kept as they were
+    std::size_t files_removed = 0;   //! Files no longer present in the directory
+    std::vector<std::string> failed_files; //! Files which could not be read ( retried on next update )
+};
+
+/**
+ * @brief   Conditions on keyword values which all must hold for an HDU to match
+ * @details Numeric conditions match only numeric values and text conditions only string values
+ *          ( compared without the enclosing quotes and trailing blanks )
+*/
+class keyword_query {
+public:
+    enum class condition_type { text, logical, number_range };
+
+    struct condition {
+        std::string keyword;
+        condition_type type;
+        std::string text;
+        bool logical = false;
+        double low = -std::numeric_limits<double>::infinity();
+        double high = std::numeric_limits<double>::infinity();
+        bool low_inclusive = true;
+        bool high_inclusive = true;
+    };
+
+private:
+    std::vector<condition> conditions;
+
+public:
+    /**
+     * @brief Requires the string value of keyword to be equal to value
+    */
+    keyword_query& equal(std::string const& keyword, std::string const& value) {
+        condition new_condition = make_condition(keyword, condition_type::text);
+        new_condition.text = value;
+        conditions.push_back(new_condition);
+        return *this;
+    }
+
+    keyword_query& equal(std::string const& keyword, const char* value) {
+        return equal(keyword, std::string(value));
+    }
+
+    /**
+     * @brief Requires the logical value of keyword to be equal to value
+    */
+    keyword_query& equal(std::string const& keyword, bool value) {
+        condition new_condition = make_condition(keyword, condition_type::logical);
+        new_condition.logical = value;
+        conditions.push_back(new_condition);
+        return *this;
+    }
+
+    /**
+     * @brief Requires the numeric value of keyword to be equal to value
+    */
+    template<typename Number, typename = typename std::enable_if<
+        std::is_arithmetic<Number>::value && !std::is_same<Number, bool>::value>::type>
+    keyword_query& equal(std::string const& keyword, Number value) {
+        return between(keyword, static_cast<double>(value), static_cast<double>(value));
+    }
+
+    /**
+     * @brief Requires the numeric value of keyword to lie in [low, high]
+    */
+    keyword_query& between(std::string const& keyword, double low, double high) {
+        return add_range(keyword, low, true, high, true);
+    }
+
+    /**
+     * @brief Requires the numeric value of keyword to be greater than value
+    */
+    keyword_query& greater(std::string const& keyword, double value) {
+        return add_range(keyword, value, false, std::numeric_limits<double>::infinity(), true);
+    }
+
+    /**
+     * @brief Requires the numeric value of keyword to be less than value
+    */
+    keyword_query& less(std::string const& keyword, double value) {
+        return add_range(keyword, -std::numeric_limits<double>::infinity(), true, value, false);
+    }
+
+    const std::vector<condition>& get_conditions() const { return conditions; }
+
+private:
+    static condition make_condition(std::string const& keyword, condition_type type) {
+        condition new_condition;
+        new_condition.keyword = keyword;
+        new_condition.type = type;
+        return new_condition;
+    }
+
+    keyword_query& add_range(std::string const& keyword, double low, bool low_inclusive, double high, bool high_inclusive) {
+        condition new_condition = make_condition(keyword, condition_type::number_range);
+        new_condition.low = low;
+        new_condition.low_inclusive = low_inclusive;
+        new_condition.high = high;
+        new_condition.high_inclusive = high_inclusive;
+        conditions.push_back(new_condition);
+        return *this;
+    }
+};
+
+/**
+ * @brief   Index of chosen keywords of every HDU of the FITS files present in a directory tree
+ * @details Only the headers are read ( the data units are skipped using the header ), by several threads.
+ *          The values are stored column wise, one column per keyword, so a query scans only the columns
+ *          of the keywords it refers to and never opens the files. The index can be saved to and loaded
+ *          from a file, and update only reads the files added or modified ( by modification time or size )
+ *          since the last update.
+ * @tparam  FileReader Reader used for reading the headers ( e.g fits_stream )
+ * @tparam  CardPolicy Policy of the header cards
+ * @note    The saved index uses the byte order of the machine which wrote it
+ * @author  agent
+*/
+template<typename FileReader, typename CardPolicy>
+class basic_keyword_index {
+    enum value_kind : unsigned char { missing_value = 0, text_value = 1, number_value = 2, logical_value = 3 };
+
+    //! Values of a single keyword for all the HDUs
+    struct keyword_column {
+        std::vector<unsigned char> kinds;
+        std::vector<double> numbers;     //! numeric value ( 1 or 0 for logical values )
+        std::vector<std::string> texts;  //! string value ( empty for the other kinds )
+    };
+
+    struct file_entry {
+        std::string path;
+        std::int64_t modification_time;
+        std::uint64_t size;
+        std::size_t first_row;
+        std::size_t rows;
+    };
+
+    struct scanned_value {
+        unsigned char kind = missing_value;
+        double number = 0;
+        std::string text;
+    };
+
+    struct scanned_file {
+        file_entry entry;
+        std::vector<std::vector<scanned_value>> hdus;
+        bool failed = false;
+    };
+
+    std::vector<std::string> keywords;
+    std::vector<file_entry> files;      //! sorted by path, rows of a file are contiguous
+    std::vector<std::uint32_t> row_hdu; //! position of the HDU in its file
+    std::vector<std::uint32_t> row_file;
+    std::vector<keyword_column> columns;
+
+public:
+    /**
+     * @brief Creates an empty index of the given keywords
+     * @param[in] indexed_keywords Keywords whose values are stored for every HDU
+    */
+    explicit basic_keyword_index(std::vector<std::string> indexed_keywords)
+        :keywords(std::move(indexed_keywords)), columns(keywords.size()) {}
+
+    const std::vector<std::string>& get_keywords() const { return keywords; }
+
+    /**
+     * @brief Returns the number of files present in the index
+    */
+    std::size_t total_files() const { return files.size(); }
+
+    /**
+     * @brief Returns the number of HDUs present in the index
+    */
+    std::size_t total_hdus() const { return row_hdu.size(); }
+
+    /**
+     * @brief Brings the index up to date with the FITS files ( .fits, .fit, .fts ) present in the directory tree
+     * @param[in] directory Root of the directory tree
+     * @param[in] threads Number of threads reading the headers ( 0 uses the number of hardware threads )
+     * @throws boost::filesystem::filesystem_error If the directory cannot be traversed
+    */
+    keyword_index_update update(std::string const& directory, std::size_t threads = 0) {
+        keyword_index_update summary;
+        std::vector<file_entry> listing = list_files(directory);
+
+        std::vector<scanned_file> scanned;
+        std::vector<const file_entry*> previous(listing.size(), nullptr);
+        for (std::size_t i = 0; i < listing.size(); i++) {
+            const file_entry* old_entry = find_file(listing[i].path);
+            if (old_entry != nullptr && old_entry->modification_time == listing[i].modification_time &&
+                old_entry->size == listing[i].size) {
+                previous[i] = old_entry;
+                summary.files_unchanged++;
+            }
+            else {
+                scanned.emplace_back();
+                scanned.back().entry = listing[i];
+            }
+        }
+        for (auto const& old_entry : files) {
+            if (!std::binary_search(listing.begin(), listing.end(), old_entry, by_path)) { summary.files_removed++; }
+        }
+
+        scan_files(scanned, threads);
+
+        basic_keyword_index updated(keywords);
+        auto next_scanned = scanned.begin();
+        for (std::size_t i = 0; i < listing.size(); i++) {
+            if (previous[i] != nullptr) {
+                updated.append_rows(*this, *previous[i]);
+            }
+            else {
+                if (next_scanned->failed) { summary.failed_files.push_back(next_scanned->entry.path); }
+                else {
+                    updated.append_rows(*next_scanned);
+                    summary.files_scanned++;
+                }
+                ++next_scanned;
+            }
+        }
+
+        *this = std::move(updated);
+        return summary;
+    }
+
+    /**
+     * @brief Returns the HDUs satisfying all the conditions of query
+     * @throws key_not_defined_exception If the query refers to a keyword which is not indexed
+    */
+    std::vector<keyword_match> find(keyword_query const& query) const {
+        std::vector<unsigned char> selected(row_hdu.size(), 1);
+
+        for (auto const& query_condition : query.get_conditions()) {
+            const keyword_column& column = columns[column_of(query_condition.keyword)];
+            for (std::size_t row = 0; row < selected.size(); row++) {
+                if (selected[row] && !satisfies(column, row, query_condition)) { selected[row] = 0; }
+            }
+        }
+
+        std::vector<keyword_match> matches;
+        for (std::size_t row = 0; row < selected.size(); row++) {
+            if (selected[row]) { matches.push_back(keyword_match{ files[row_file[row]].path, row_hdu[row] }); }
+        }
+        return matches;
+    }
+
+    /**
+     * @brief Writes the index into a file
+     * @throws file_writing_exception If the file cannot be written
+    */
+    void save(std::string const& path) const {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(magic, sizeof(magic));
+
+        write_size(out, keywords.size());
+        for (auto const& keyword : keywords) { write_string(out, keyword); }
+
+        write_size(out, files.size());
+        for (auto const& entry : files) {
+            write_string(out, entry.path);
+            write_pod(out, entry.modification_time);
+            write_pod(out, entry.size);
+            write_size(out, entry.first_row);
+            write_size(out, entry.rows);
+        }
+
+        write_size(out, row_hdu.size());
+        write_array(out, row_hdu);
+        write_array(out, row_file);
+        for (auto const& column : columns) {
+            write_array(out, column.kinds);
+            write_array(out, column.numbers);
+            for (auto const& value : column.texts) { write_string(out, value); }
+        }
+
+        if (!out.good()) { throw file_writing_exception("Cannot write the keyword index"); }
+    }
+
+    /**
+     * @brief Reads an index written by save
+     * @throws file_reading_exception If the file cannot be read or is not a keyword index
+    */
+    static basic_keyword_index load(std::string const& path) {
+        std::ifstream in(path, std::ios::binary);
+        char file_magic[sizeof(magic)] = {};
+        in.read(file_magic, sizeof(file_magic));
+        if (!in.good() || !std::equal(std::begin(magic), std::end(magic), std::begin(file_magic))) {
+            throw file_reading_exception("Not a keyword index");
+        }
+
+        std::vector<std::string> indexed_keywords(read_size(in));
+        for (auto& keyword : indexed_keywords) { keyword = read_string(in); }
+        basic_keyword_index index(std::move(indexed_keywords));
+
+        index.files.resize(read_size(in));
+        for (auto& entry : index.files) {
+            entry.path = read_string(in);
+            read_pod(in, entry.modification_time);
+            read_pod(in, entry.size);
+            entry.first_row = read_size(in);
+            entry.rows = read_size(in);
+        }
+
+        std::size_t rows = read_size(in);
+        read_array(in, index.row_hdu, rows);
+        read_array(in, index.row_file, rows);
+        for (auto& column : index.columns) {
+            read_array(in, column.kinds, rows);
+            read_array(in, column.numbers, rows);
+            column.texts.resize(rows);
+            for (auto& value : column.texts) { value = read_string(in); }
+        }
+
+        if (!in.good()) { throw file_reading_exception("Keyword index is truncated"); }
+        return index;
+    }
+
+private:
+    static constexpr char magic[8] = { 'A', 'S', 'T', 'R', 'K', 'I', 'X', '1' };
+
+    static bool by_path(const file_entry& lhs, const file_entry& rhs) { return lhs.path < rhs.path; }
+
+    static std::vector<file_entry> list_files(std::string const& directory) {
+        namespace fs = boost::filesystem;
+        std::vector<file_entry> listing;
+
+        for (fs::recursive_directory_iterator iter(directory), end; iter != end; ++iter) {
+            if (!fs::is_regular_file(iter->status())) { continue; }
+
+            std::string extension = iter->path().extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(),
+                [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+            if (extension != ".fits" && extension != ".fit" && extension != ".fts") { continue; }
+
+            file_entry entry;
+            entry.path = iter->path().string();
+            entry.modification_time = static_cast<std::int64_t>(fs::last_write_time(iter->path()));
+            entry.size = static_cast<std::uint64_t>(fs::file_size(iter->path()));
+            entry.first_row = 0;
+            entry.rows = 0;
+            listing.push_back(entry);
+        }
+
+        std::sort(listing.begin(), listing.end(), by_path);
+        return listing;
+    }
+
+    const file_entry* find_file(std::string const& path) const {
+        file_entry search_entry;
+        search_entry.path = path;
+        auto position = std::lower_bound(files.begin(), files.end(), search_entry, by_path);
+        if (position == files.end() || position->path != path) { return nullptr; }
+        return &*position;
+    }
+
+    std::size_t column_of(std::string const& keyword) const {
+        auto position = std::find(keywords.begin(), keywords.end(), keyword);
+        if (position == keywords.end()) { throw key_not_defined_exception(); }
+        return static_cast<std::size_t>(position - keywords.begin());
+    }
+
+    /**
+     * @brief Reads the headers of the files using a pool of threads
+    */
+    void scan_files(std::vector<scanned_file>& scanned, std::size_t threads) const {
+        detail::run_parallel(scanned.size(), threads, [&](std::size_t i) {
+            try {
+                scan_file(scanned[i]);
+            }
+            catch (std::exception&) {
+                scanned[i].failed = true;
+            }
+        });
+    }
+
+    /**
+     * @brief   Reads the indexed keywords from every header of the file skipping the data units
+     * @details The headers are walked here rather than through fits_io::read_only_headers, which builds every HDU
+     *          from its header. Building them costs more than reading the few indexed cards and fails for HDUs the
+     *          HDU manager cannot build ( e.g. tables without EXTNAME ), which must still be indexed. The walk
+     *          skips the data units by header::data_unit_size as read_only_headers does
+    */
+    void scan_file(scanned_file& file) const {
+        FileReader file_reader;
+        file_reader.set_file(file.entry.path);
+        std::size_t end_of_file = file_reader.file_size();
+
+        std::size_t header_location = 0;
+        while (header_location < end_of_file) {
+            file_reader.set_reading_pos(header_location);
+            header<CardPolicy> hdu_header;
+            hdu_header.read_header(file_reader);
+
+            std::vector<scanned_value> values(keywords.size());
+            for (std::size_t i = 0; i < keywords.size(); i++) {
+                if (hdu_header.contains_keyword(keywords[i])) {
+                    values[i] = parse_value(hdu_header.get_card(hdu_header.card_index(keywords[i])));
+                }
+            }
+            file.hdus.push_back(std::move(values));
+
+            header_location += hdu_header.raw_records().size() + (hdu_header.data_unit_size() + 2879) / 2880 * 2880;
+        }
+    }
+
+    /**
+     * @brief Classifies the value of card as string, logical or number
+    */
+    static scanned_value parse_value(card<CardPolicy> const& header_card) {
+        scanned_value value;
+        boost::string_view raw_value = header_card.raw_card().substr(10);
+        std::size_t value_start = raw_value.find_first_not_of(' ');
+        if (value_start == boost::string_view::npos || raw_value[value_start] == '/') { return value; }
+
+        value.text = header_card.template value<std::string>();
+        if (raw_value[value_start] == '\'') {
+            value.kind = text_value;
+        }
+        else if (value.text == "T" || value.text == "F") {
+            value.kind = logical_value;
+            value.number = value.text == "T" ? 1 : 0;
+            value.text.clear();
+        }
+        else {
+            // Fortran style exponent ( D ) is also allowed in FITS
+            std::string number_text = value.text;
+            std::replace(number_text.begin(), number_text.end(), 'D', 'E');
+            char* parsed_end = nullptr;
+            double parsed_number = std::strtod(number_text.c_str(), &parsed_end);
+            if (!number_text.empty() && *parsed_end == '\0') {
+                value.kind = number_value;
+                value.number = parsed_number;
+                value.text.clear();
+            }
+            else {
+                value.kind = text_value;
+            }
+        }
+        return value;
+    }
+
+    static bool satisfies(keyword_column const& column, std::size_t row, keyword_query::condition const& query_condition) {
+        switch (query_condition.type) {
+        case keyword_query::condition_type::text:
+            return column.kinds[row] == text_value && column.texts[row] == query_condition.text;
+        case keyword_query::condition_type::logical:
+            return column.kinds[row] == logical_value && (column.numbers[row] > 0.5) == query_condition.logical;
+        default: {
+            if (column.kinds[row] != number_value) { return false; }
+            double value = column.numbers[row];
+            bool above_low = query_condition.low_inclusive ? value >= query_condition.low : value > query_condition.low;
+            bool below_high = query_condition.high_inclusive ? value <= query_condition.high : value < query_condition.high;
+            return above_low && below_high;
+        }
+        }
+    }
+
+    /**
+     * @brief Appends the rows of an unchanged file from the previous index
+    */
+    void append_rows(basic_keyword_index const& previous_index, file_entry const& entry) {
+        file_entry new_entry = entry;
+        new_entry.first_row = row_hdu.size();
+        for (std::size_t row = entry.first_row; row < entry.first_row + entry.rows; row++) {
+            row_hdu.push_back(previous_index.row_hdu[row]);
+            row_file.push_back(static_cast<std::uint32_t>(files.size()));
+            for (std::size_t i = 0; i < columns.size(); i++) {
+                const keyword_column& column = previous_index.columns[i];
+                columns[i].kinds.push_back(column.kinds[row]);
+                columns[i].numbers.push_back(column.numbers[row]);
+                columns[i].texts.push_back(column.texts[row]);
+            }
+        }
+        files.push_back(new_entry);
+    }
+
+    /**
+     * @brief Appends the rows of a file whose headers were just read
+    */
+    void append_rows(scanned_file const& file) {
+        file_entry new_entry = file.entry;
+        new_entry.first_row = row_hdu.size();
+        new_entry.rows = file.hdus.size();
+        for (std::size_t hdu = 0; hdu < file.hdus.size(); hdu++) {
+            row_hdu.push_back(static_cast<std::uint32_t>(hdu));
+            row_file.push_back(static_cast<std::uint32_t>(files.size()));
+            for (std::size_t i = 0; i < columns.size(); i++) {
+                columns[i].kinds.push_back(file.hdus[hdu][i].kind);
+                columns[i].numbers.push_back(file.hdus[hdu][i].number);
+                columns[i].texts.push_back(file.hdus[hdu][i].text);
+            }
+        }
+        files.push_back(new_entry);
+    }
+
+    template<typename T>
+    static void write_pod(std::ofstream& out, T value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    static void write_size(std::ofstream& out, std::size_t value) {
+        write_pod(out, static_cast<std::uint64_t>(value));
+    }
+
+    static void write_string(std::ofstream& out, std::string const& value) {
+        write_size(out, value.size());
+        out.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+
+    template<typename T>
+    static void write_array(std::ofstream& out, std::vector<T> const& values) {
+        out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+
+    template<typename T>
+    static void read_pod(std::ifstream& in, T& value) {
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+
+    static std::size_t read_size(std::ifstream& in) {
+        std::uint64_t value = 0;
+        read_pod(in, value);
+        if (!in.good()) { throw file_reading_exception("Keyword index is truncated"); }
+        return static_cast<std::size_t>(value);
+    }
+
+    static std::string read_string(std::ifstream& in) {
+        std::string value(read_size(in), '\0');
+        in.read(&value[0], static_cast<std::streamsize>(value.size()));
+        return value;
+    }
+
+    template<typename T>
+    static void read_array(std::ifstream& in, std::vector<T>& values, std::size_t count) {
+        values.resize(count);
+        in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(count * sizeof(T)));
+    }
+};
+
+template<typename FileReader, typename CardPolicy>
+constexpr char basic_keyword_index<FileReader, CardPolicy>::magic[8];
+
+using keyword_index = basic_keyword_index<fits_stream, card_policy>;
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_KEYWORD_INDEX_HPP
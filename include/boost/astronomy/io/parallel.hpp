@@ -0,0 +1,169 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_PARALLEL_HPP
+#define BOOST_ASTRONOMY_IO_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @file    parallel.hpp
+ * @details Runs independent tasks on a pool of threads, shared by every component that splits its work into
+ *          files, blocks of rows or bands of pixels. run_parallel starts its threads for a single batch of tasks,
+ *          task_pool keeps them alive across batches and leaves the calling thread free while a batch runs
+*/
+
+namespace boost { namespace astronomy { namespace io { namespace detail {
+
+/**
+ * @brief Resolves a number of threads, where 0 stands for the number of hardware threads
+*/
+inline std::size_t resolve_threads(std::size_t threads) {
+    return threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threads;
+}
+
+/**
+ * @brief Number of threads worth starting for the given number of tasks ( at least 1 )
+*/
+inline std::size_t parallel_threads(std::size_t threads, std::size_t tasks) {
+    return std::max<std::size_t>(1, std::min(resolve_threads(threads), tasks));
+}
+
+/**
+ * @brief   Calls task(0) ... task(tasks - 1) on a pool of threads
+ * @details Tasks are handed out in order through a shared counter and the calling thread works on them as well.
+ *          An exception thrown by a task is rethrown once all threads have finished ( the one of the task with the
+ *          lowest index if several fail )
+ * @param[in] tasks Number of tasks
+ * @param[in] threads Number of threads to use ( 0 uses the number of hardware threads )
+*/
+template<typename Task>
+inline void run_parallel(std::size_t tasks, std::size_t threads, Task const& task) {
+    if (tasks == 0) { return; }
+    std::vector<std::exception_ptr> errors(tasks);
+    std::atomic<std::size_t> next_task{ 0 };
+    auto worker = [&]() {
+        for (std::size_t i = next_task++; i < tasks; i = next_task++) {
+            try { task(i); }
+            catch (...) { errors[i] = std::current_exception(); }
+        }
+    };
+
+    threads = parallel_threads(threads, tasks);
+    std::vector<std::thread> pool;
+    for (std::size_t i = 1; i < threads; i++) { pool.emplace_back(worker); }
+    worker();
+    for (auto& thread : pool) { thread.join(); }
+
+    for (auto const& error : errors) {
+        if (error) { std::rethrow_exception(error); }
+    }
+}
+
+/**
+ * @brief   Threads kept alive across batches of tasks
+ * @details start hands a batch of tasks to the threads and returns at once, so the caller can work on something
+ *          else ( e.g. write the results of the previous batch ) until wait. Tasks are handed out in order like
+ *          run_parallel does, and wait rethrows the error of the failed task with the lowest index
+*/
+class task_pool {
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable work_done_;
+    std::function<void(std::size_t)> task_;
+    std::vector<std::exception_ptr> errors_;
+    std::size_t tasks_ = 0;
+    std::size_t next_task_ = 0;
+    std::size_t running_ = 0;
+    bool stopping_ = false;
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            work_ready_.wait(lock, [this]() { return stopping_ || next_task_ < tasks_; });
+            if (next_task_ >= tasks_) { return; }
+            std::size_t index = next_task_++;
+            running_++;
+            lock.unlock();
+            try { task_(index); }
+            catch (...) { errors_[index] = std::current_exception(); }
+            lock.lock();
+            if (--running_ == 0 && next_task_ >= tasks_) { work_done_.notify_all(); }
+        }
+    }
+
+public:
+    /**
+     * @param[in] threads Number of threads to keep ( 0 uses the number of hardware threads )
+    */
+    explicit task_pool(std::size_t threads) {
+        threads = resolve_threads(threads);
+        for (std::size_t i = 0; i < threads; i++) { threads_.emplace_back([this]() { work(); }); }
+    }
+
+    task_pool(task_pool const&) = delete;
+    task_pool& operator=(task_pool const&) = delete;
+
+    /**
+     * @brief Finishes the tasks of the current batch and stops the threads
+    */
+    ~task_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        work_ready_.notify_all();
+        for (auto& thread : threads_) { thread.join(); }
+    }
+
+    std::size_t size() const { return threads_.size(); }
+
+    /**
+     * @brief Hands task(0) ... task(tasks - 1) to the threads without waiting for them
+     * @note  The previous batch must have been waited for
+    */
+    void start(std::size_t tasks, std::function<void(std::size_t)> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = std::move(task);
+            errors_.assign(tasks, nullptr);
+            tasks_ = tasks;
+            next_task_ = 0;
+        }
+        work_ready_.notify_all();
+    }
+
+    /**
+     * @brief Waits until every task of the current batch has finished and rethrows the first error
+    */
+    void wait() {
+        std::vector<std::exception_ptr> errors;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_done_.wait(lock, [this]() { return next_task_ >= tasks_ && running_ == 0; });
+            errors.swap(errors_);
+            tasks_ = next_task_ = 0;
+        }
+        for (auto const& error : errors) {
+            if (error) { std::rethrow_exception(error); }
+        }
+    }
+};
+
+}}}} //namespace boost::astronomy::io::detail
+
+#endif // !BOOST_ASTRONOMY_IO_PARALLEL_HPP
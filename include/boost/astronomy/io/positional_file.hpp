@@ -0,0 +1,253 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_POSITIONAL_FILE_HPP
+#define BOOST_ASTRONOMY_IO_POSITIONAL_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief   Read only file accessed by positional reads ( pread on POSIX, ReadFile at an offset on Windows )
+ * @details Unlike fits_stream the file has no shared reading position, every read names its own offset.
+ *          Any number of threads may therefore read from the same object at the same time without locking
+ * @note    The object can be moved but not copied, the file is closed when it is destroyed
+*/
+class positional_file {
+public:
+#if defined(_WIN32)
+    typedef HANDLE native_handle_type;
+#else
+    typedef int native_handle_type;
+#endif
+
+private:
+#if defined(_WIN32)
+    static native_handle_type invalid_handle() { return INVALID_HANDLE_VALUE; }
+#else
+    static native_handle_type invalid_handle() { return -1; }
+#endif
+
+    native_handle_type handle = invalid_handle();
+    std::size_t total_size = 0;
+
+public:
+    /**
+     * @brief Creates an object not associated with any file
+    */
+    positional_file() {}
+
+    /**
+     * @brief Opens the file at path for positional reads
+     * @param[in] path Location of the file
+     * @throws file_reading_exception If the file cannot be opened
+    */
+    explicit positional_file(const std::string& path) {
+        open(path);
+    }
+
+    positional_file(const positional_file&) = delete;
+    positional_file& operator=(const positional_file&) = delete;
+
+    positional_file(positional_file&& other) noexcept
+        :handle(other.handle), total_size(other.total_size) {
+        other.handle = invalid_handle();
+        other.total_size = 0;
+    }
+
+    positional_file& operator=(positional_file&& other) noexcept {
+        if (this != &other) {
+            close();
+            std::swap(handle, other.handle);
+            std::swap(total_size, other.total_size);
+        }
+        return *this;
+    }
+
+    ~positional_file() { close(); }
+
+    /**
+     * @brief Opens the file at path, closing the file opened earlier
+     * @param[in] path Location of the file
+     * @throws file_reading_exception If the file cannot be opened
+    */
+    void open(const std::string& path) {
+        close();
+#if defined(_WIN32)
+        handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        LARGE_INTEGER size;
+        if (handle == invalid_handle() || !GetFileSizeEx(handle, &size)) {
+            close();
+            throw file_reading_exception("Cannot Open File");
+        }
+        total_size = static_cast<std::size_t>(size.QuadPart);
+#else
+        handle = ::open(path.c_str(), O_RDONLY);
+        struct stat file_status;
+        if (handle == invalid_handle() || ::fstat(handle, &file_status) != 0) {
+            close();
+            throw file_reading_exception("Cannot Open File");
+        }
+        total_size = static_cast<std::size_t>(file_status.st_size);
+#endif
+    }
+
+    /**
+     * @brief Returns whether a file is open
+    */
+    bool is_open() const { return handle != invalid_handle(); }
+
+    /**
+     * @brief Returns the size of the file in bytes when it was opened
+    */
+    std::size_t size() const { return total_size; }
+
+    /**
+     * @brief Returns the descriptor ( HANDLE on Windows ) of the file, owned by this object
+    */
+    native_handle_type native_handle() const { return handle; }
+
+    /**
+     * @brief Reads up to num_bytes starting at position into buffer
+     * @param[in] position Offset of the first byte to be read
+     * @param[out] buffer Destination of the bytes read
+     * @param[in] num_bytes Number of bytes to be read
+     * @return Number of bytes read ( less than num_bytes only at the end of file )
+     * @throws file_reading_exception If the operating system reports an error
+    */
+    std::size_t read_at(std::size_t position, char* buffer, std::size_t num_bytes) const {
+        std::size_t total_read = 0;
+        while (total_read < num_bytes) {
+            std::size_t remaining = num_bytes - total_read;
+#if defined(_WIN32)
+            OVERLAPPED location = {};
+            unsigned long long offset = position + total_read;
+            location.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFull);
+            location.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            DWORD chunk = remaining > 0x40000000u ? 0x40000000u : static_cast<DWORD>(remaining);
+            DWORD bytes_read = 0;
+            if (!ReadFile(handle, buffer + total_read, chunk, &bytes_read, &location)) {
+                if (GetLastError() == ERROR_HANDLE_EOF) { break; }
+                throw file_reading_exception("Cannot read from file");
+            }
+#else
+            ssize_t bytes_read = ::pread(handle, buffer + total_read, remaining, static_cast<off_t>(position + total_read));
+            if (bytes_read < 0) {
+                if (errno == EINTR) { continue; }
+                throw file_reading_exception("Cannot read from file");
+            }
+#endif
+            if (bytes_read == 0) { break; }
+            total_read += static_cast<std::size_t>(bytes_read);
+        }
+        return total_read;
+    }
+
+    /**
+     * @brief Reads up to num_bytes starting at position as a string
+     * @param[in] position Offset of the first byte to be read
+     * @param[in] num_bytes Number of bytes to be read
+     * @note The string is shorter than num_bytes if the file ends before
+    */
+    std::string read_at(std::size_t position, std::size_t num_bytes) const {
+        std::string data(num_bytes, ' ');
+        if (num_bytes != 0) {
+            data.resize(read_at(position, &data[0], num_bytes));
+        }
+        return data;
+    }
+
+    /**
+     * @brief Closes the file if opened
+    */
+    void close() {
+        if (is_open()) {
+#if defined(_WIN32)
+            CloseHandle(handle);
+#else
+            ::close(handle);
+#endif
+        }
+        handle = invalid_handle();
+        total_size = 0;
+    }
+};
+
+/**
+ * @brief   Reading position over a positional_file, providing the reading interface used by header::read_header
+ * @details Each thread uses its own cursor, so cursors over the same file do not affect each other
+*/
+class positional_cursor {
+    const positional_file* file;
+    std::size_t position;
+
+public:
+    /**
+     * @brief Creates a cursor reading file from position
+    */
+    explicit positional_cursor(const positional_file& source, std::size_t start = 0)
+        :file(&source), position(start) {}
+
+    /**
+     * @brief Reads num_bytes from the current position as a string and advances the position
+    */
+    std::string read(std::size_t num_bytes) {
+        std::string data = file->read_at(position, num_bytes);
+        position += data.size();
+        return data;
+    }
+
+    /**
+     * @brief Checks whether the position is at the end of file
+    */
+    bool at_end() const { return position >= file->size(); }
+
+    /**
+     * @brief Gets the current position of the cursor
+    */
+    std::size_t get_current_pos() const { return position; }
+
+    /**
+     * @brief Sets the position for reading
+    */
+    void set_reading_pos(std::size_t new_position) { position = new_position; }
+
+    /**
+     * @brief Finds the end of current logical record ( or beginning of next record )
+    */
+    std::size_t find_unit_end() const {
+        return (position + 2879) / 2880 * 2880;
+    }
+
+    /**
+     * @brief Sets the position to the end of current logical record ( or beginning of next record )
+    */
+    void set_unit_end() { position = find_unit_end(); }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_POSITIONAL_FILE_HPP
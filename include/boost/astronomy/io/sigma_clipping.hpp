@@ -0,0 +1,534 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_SIGMA_CLIPPING_HPP
+#define BOOST_ASTRONOMY_IO_SIGMA_CLIPPING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_view.hpp>
+#include <boost/astronomy/io/image_histogram.hpp>
+
+/**
+ * @file    sigma_clipping.hpp
+ * @details Iterative sigma clipped statistics, following astropy.stats.sigma_clipped_stats.
+ *          The usable pixels are copied once into one compact candidate set per thread. Every iteration then
+ *          makes a single pass over the candidates which drops the clipped ones while accumulating the moments
+ *          of the survivors and their histogram. The median is read off the histogram when its bins hold single
+ *          integer values, and otherwise found by another pass or two over the candidates of its bin
+*/
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief Statistic around which pixels are clipped
+*/
+enum class clip_center {
+    median,
+    mean
+};
+
+/**
+ * @brief Controls sigma clipping ( the defaults are the ones of astropy )
+*/
+struct sigma_clip_options {
+    double sigma_lower = 3.0;           //! Pixels below center - sigma_lower * std are rejected
+    double sigma_upper = 3.0;           //! Pixels above center + sigma_upper * std are rejected
+    std::size_t max_iterations = 5;     //! Upper limit on the clipping iterations
+    clip_center center = clip_center::median;
+    std::size_t threads = 0;            //! Number of threads ( 0 uses the number of hardware threads )
+};
+
+/**
+ * @brief Statistics of the pixels left after clipping
+ * @note  The mean, median and standard deviation are NaN when no pixel is left
+*/
+struct clipped_statistics {
+    double mean = std::numeric_limits<double>::quiet_NaN();
+    double median = std::numeric_limits<double>::quiet_NaN();
+    double standard_deviation = std::numeric_limits<double>::quiet_NaN();   //! Population standard deviation
+    std::size_t count = 0;          //! Pixels left after clipping
+    std::size_t rejected = 0;       //! Usable unmasked pixels rejected by clipping
+    std::size_t iterations = 0;     //! Clipping iterations performed
+};
+
+namespace detail {
+
+    /**
+     * @brief Count, mean and sum of squared deviations of a set of values, accumulated about a reference value
+    */
+    struct moment_accumulator {
+        std::size_t count = 0;
+        double reference = 0;
+        double sum = 0;
+        double sum_squares = 0;
+        double minimum = std::numeric_limits<double>::infinity();
+        double maximum = -std::numeric_limits<double>::infinity();
+
+        void add(double value) {
+            double deviation = value - reference;
+            count++;
+            sum += deviation;
+            sum_squares += deviation * deviation;
+            minimum = std::min(minimum, value);
+            maximum = std::max(maximum, value);
+        }
+
+        double mean() const { return reference + sum / static_cast<double>(count); }
+
+        double squared_deviations() const {
+            return std::max(0.0, sum_squares - sum * sum / static_cast<double>(count));
+        }
+    };
+
+    /**
+     * @brief Moments of the union of sets, combined pairwise as in Chan et al.
+    */
+    struct combined_moments {
+        std::size_t count = 0;
+        double mean = 0;
+        double squared_deviations = 0;
+        double minimum = std::numeric_limits<double>::infinity();
+        double maximum = -std::numeric_limits<double>::infinity();
+
+        void add(moment_accumulator const& part) {
+            if (part.count == 0) { return; }
+            double part_mean = part.mean();
+            double delta = part_mean - mean;
+            std::size_t total = count + part.count;
+            squared_deviations += part.squared_deviations() +
+                delta * delta * static_cast<double>(count) * static_cast<double>(part.count) / static_cast<double>(total);
+            mean += delta * static_cast<double>(part.count) / static_cast<double>(total);
+            count = total;
+            minimum = std::min(minimum, part.minimum);
+            maximum = std::max(maximum, part.maximum);
+        }
+
+        double standard_deviation() const { return std::sqrt(squared_deviations / static_cast<double>(count)); }
+    };
+
+    /**
+     * @brief Whether a mask value excludes its pixel ( any value other than zero does )
+    */
+    template<typename MaskType>
+    inline bool is_masked(MaskType value, std::true_type /*integer*/) { return value != MaskType(0); }
+
+    template<typename MaskType>
+    inline bool is_masked(MaskType value, std::false_type /*floating point*/) { return value < 0 || value > 0; }
+
+    template<typename MaskType>
+    inline bool is_masked(MaskType value) { return is_masked(value, std::is_integral<MaskType>()); }
+
+    /**
+     * @brief State of the clipping: the candidates of each thread with their moments and histogram
+    */
+    template<typename PixelType>
+    class clipping_state {
+        std::vector<std::vector<PixelType>> chunks;
+        std::vector<moment_accumulator> chunk_moments;
+        std::vector<std::vector<std::uint32_t>> chunk_counts;
+        histogram_binning<PixelType> binning;
+        std::size_t threads;
+
+        enum : std::size_t { max_bins = std::size_t(1) << 16, gather_limit = std::size_t(1) << 16, max_levels = 4 };
+
+        /**
+         * @brief Bins of one histogram holding both median ranks, with the pixels they hold and those before
+        */
+        struct bin_range {
+            histogram_binning<PixelType> binning;
+            std::size_t first;
+            std::size_t last;
+            std::size_t before;
+            std::size_t pixels;
+        };
+
+        static bin_range locate(std::vector<std::uint64_t> const& counts, histogram_binning<PixelType> const& bins,
+            const std::size_t (&ranks)[2]) {
+            bin_range range{ bins, 0, 0, 0, 0 };
+            std::size_t cumulative = 0, bin = 0;
+            while (cumulative + counts[bin] <= ranks[0]) { cumulative += counts[bin++]; }
+            range.first = bin;
+            range.before = cumulative;
+            while (cumulative + counts[bin] <= ranks[1]) { cumulative += counts[bin++]; }
+            range.last = bin;
+            range.pixels = cumulative + counts[bin] - range.before;
+            return range;
+        }
+
+        static bool within(std::vector<bin_range> const& levels, PixelType value) {
+            for (auto const& level : levels) {
+                std::size_t bin = level.binning(value);
+                if (bin < level.first || bin > level.last) { return false; }
+            }
+            return true;
+        }
+
+        template<typename Task>
+        void for_each_chunk(Task const& task) {
+            run_row_bands(chunks.size(), 1, 1 << 16, threads, [&](std::size_t first, std::size_t last) {
+                for (std::size_t chunk = first; chunk < last; chunk++) { task(chunk); }
+            });
+        }
+
+    public:
+        combined_moments moments;
+
+        /**
+         * @brief Copies the usable pixels not masked ( mask value other than zero ) into the candidates
+        */
+        template<typename MaskType>
+        clipping_state(image_view<PixelType> view, const image_view<MaskType>* mask, std::size_t thread_count)
+            :threads(thread_count) {
+            std::size_t total = view.size();
+            // Chunks are kept small enough for 32 bit bin counts
+            std::size_t parts = total == 0 ? 0 : std::max<std::size_t>(parallel_threads(threads,
+                std::max<std::size_t>(1, total >> 16)), static_cast<std::size_t>(std::uint64_t(total) >> 31) + 1);
+            chunks.resize(parts);
+            chunk_moments.resize(parts);
+            chunk_counts.resize(parts);
+
+            // Pixels of up to 16 bits are counted while copied, one bin per value of the type
+            bool full_range = std::is_integral<PixelType>::value && sizeof(PixelType) <= 2;
+            if (full_range) {
+                binning = histogram_binning<PixelType>::between(
+                    static_cast<double>(std::numeric_limits<PixelType>::lowest()),
+                    static_cast<double>(std::numeric_limits<PixelType>::max()), max_bins);
+            }
+
+            for_each_chunk([&](std::size_t chunk) {
+                std::size_t first = total * chunk / parts, last = total * (chunk + 1) / parts;
+                std::vector<PixelType>& candidates = chunks[chunk];
+                candidates.resize(last - first);
+                PixelType* kept = candidates.data();
+                moment_accumulator accumulator;
+                const histogram_binning<PixelType> bins = binning;
+                std::uint32_t* counts = nullptr;
+                if (full_range) {
+                    chunk_counts[chunk].assign(binning.bins, 0);
+                    counts = chunk_counts[chunk].data();
+                }
+
+                while (first < last) {
+                    std::size_t y = first / view.width, x = first % view.width;
+                    std::size_t end = std::min(view.width, x + (last - first));
+                    const PixelType* row = view.row(y);
+                    const MaskType* mask_row = mask ? mask->row(y) : nullptr;
+                    for (; x < end; x++) {
+                        PixelType value = row[x];
+                        if (!usable_pixel(value) || (mask_row && is_masked(mask_row[x]))) { continue; }
+                        *kept++ = value;
+                        if (counts) {
+                            counts[bins(value)]++;
+                            continue;
+                        }
+                        if (accumulator.count == 0) { accumulator.reference = static_cast<double>(value); }
+                        accumulator.add(static_cast<double>(value));
+                    }
+                    first += end - first % view.width;
+                }
+                candidates.resize(static_cast<std::size_t>(kept - candidates.data()));
+                chunk_moments[chunk] = accumulator;
+            });
+            if (full_range) { count_moments(); }
+            merge_moments();
+            if (moments.count != 0 && !full_range) {
+                count_candidates(histogram_binning<PixelType>::between(moments.minimum, moments.maximum, max_bins));
+            }
+        }
+
+        /**
+         * @brief   Returns the median of the candidates from their histogram and the pixels of its bins
+         * @details While the bins holding the median are too crowded to gather, their pixels are counted again
+         *          in a histogram spanning only those bins
+        */
+        double median() {
+            std::size_t count = moments.count;
+            std::vector<std::uint64_t> counts = merged_counts();
+
+            // The median is the average of the pixels of these two ranks, which coincide for odd counts
+            std::size_t ranks[2] = { (count - 1) / 2, count / 2 };
+            std::vector<bin_range> levels;
+            histogram_binning<PixelType> current = binning;
+            while (true) {
+                bin_range range = locate(counts, current, ranks);
+                // A single floating point bin only holds equal values when its limits are those of the candidates
+                if (current.exact() && (std::is_integral<PixelType>::value || levels.empty())) {
+                    return 0.5 * (current.lower_edge(range.first) + current.lower_edge(range.last));
+                }
+                if (range.first != range.last) { return 0.5 * straddling_pixels(levels, current, range); }
+                levels.push_back(range);
+                if (range.pixels <= gather_limit || levels.size() == max_levels) { break; }
+
+                double low = std::max(moments.minimum, current.lower_edge(range.first));
+                double high = std::min(moments.maximum, current.upper_edge(range.last));
+                auto refined = histogram_binning<PixelType>::between(low, high, max_bins);
+                std::vector<std::vector<std::uint64_t>> parts(chunks.size());
+                std::vector<moment_accumulator> limits(chunks.size());
+                for_each_chunk([&](std::size_t chunk) {
+                    std::vector<std::uint64_t>& part = parts[chunk];
+                    part.assign(refined.bins, 0);
+                    const histogram_binning<PixelType> bins = refined;
+                    double minimum = std::numeric_limits<double>::infinity(), maximum = -minimum;
+                    for (PixelType value : chunks[chunk]) {
+                        if (!within(levels, value)) { continue; }
+                        part[bins(value)]++;
+                        minimum = std::min(minimum, static_cast<double>(value));
+                        maximum = std::max(maximum, static_cast<double>(value));
+                    }
+                    limits[chunk].minimum = minimum;
+                    limits[chunk].maximum = maximum;
+                });
+
+                // Bins crowded with a single repeated value cannot be narrowed any further
+                combined_moments members;
+                for (auto const& part : limits) {
+                    members.minimum = std::min(members.minimum, part.minimum);
+                    members.maximum = std::max(members.maximum, part.maximum);
+                }
+                if (!(members.maximum > members.minimum)) { return members.minimum; }
+                counts.assign(refined.bins, 0);
+                for (auto const& part : parts) {
+                    for (std::size_t bin = 0; bin < part.size(); bin++) { counts[bin] += part[bin]; }
+                }
+                for (std::size_t& rank : ranks) { rank -= range.before; }
+                current = refined;
+            }
+
+            std::vector<std::vector<PixelType>> gathered(chunks.size());
+            for_each_chunk([&](std::size_t chunk) {
+                for (PixelType value : chunks[chunk]) {
+                    if (within(levels, value)) { gathered[chunk].push_back(value); }
+                }
+            });
+            std::vector<PixelType> pixels;
+            for (auto const& part : gathered) { pixels.insert(pixels.end(), part.begin(), part.end()); }
+            std::size_t before = levels.back().before;
+            double values[2];
+            for (int i = 0; i < 2; i++) {
+                auto nth = pixels.begin() + static_cast<std::ptrdiff_t>(ranks[i] - before);
+                std::nth_element(pixels.begin(), nth, pixels.end());
+                values[i] = static_cast<double>(*nth);
+            }
+            return 0.5 * (values[0] + values[1]);
+        }
+
+        /**
+         * @brief   Drops the candidates outside [lower, upper], accumulating the moments and histogram of the rest
+         * @return  Number of candidates dropped
+        */
+        std::size_t clip(double lower, double upper, double reference) {
+            std::size_t previous = moments.count;
+            auto next_binning = histogram_binning<PixelType>::between(std::max(lower, moments.minimum),
+                std::min(upper, moments.maximum), max_bins);
+            bool counted = std::is_integral<PixelType>::value && next_binning.exact();
+
+            for_each_chunk([&](std::size_t chunk) {
+                std::vector<PixelType>& candidates = chunks[chunk];
+                std::vector<std::uint32_t>& chunk_count = chunk_counts[chunk];
+                chunk_count.assign(next_binning.bins, 0);
+                std::uint32_t* counts = chunk_count.data();
+                const histogram_binning<PixelType> bins = next_binning;     // A local copy is not reloaded after each count
+                const bool moments_counted = counted;
+                moment_accumulator accumulator;
+                accumulator.reference = reference;
+
+                PixelType* kept = candidates.data();
+                for (PixelType value : candidates) {
+                    double pixel = static_cast<double>(value);
+                    if (pixel < lower || pixel > upper) { continue; }
+                    *kept++ = value;
+                    counts[bins(value)]++;
+                    if (!moments_counted) { accumulator.add(pixel); }
+                }
+                candidates.resize(static_cast<std::size_t>(kept - candidates.data()));
+                chunk_moments[chunk] = accumulator;
+            });
+            binning = next_binning;
+            if (counted) { count_moments(); }
+            merge_moments();
+            return previous - moments.count;
+        }
+
+    private:
+        /**
+         * @brief   Sum of the two median pixels when they lie in neighbouring bins
+         * @details The ranks are consecutive, so they are the largest pixel of the first bin and the smallest of
+         *          the last one
+        */
+        double straddling_pixels(std::vector<bin_range> const& levels, histogram_binning<PixelType> const& current,
+            bin_range const& range) {
+            std::vector<moment_accumulator> limits(chunks.size());
+            for_each_chunk([&](std::size_t chunk) {
+                const histogram_binning<PixelType> bins = current;
+                double largest = -std::numeric_limits<double>::infinity(), smallest = -largest;
+                for (PixelType value : chunks[chunk]) {
+                    if (!within(levels, value)) { continue; }
+                    std::size_t bin = bins(value);
+                    if (bin == range.first) { largest = std::max(largest, static_cast<double>(value)); }
+                    else if (bin == range.last) { smallest = std::min(smallest, static_cast<double>(value)); }
+                }
+                limits[chunk].maximum = largest;
+                limits[chunk].minimum = smallest;
+            });
+            combined_moments extremes;
+            for (auto const& part : limits) {
+                extremes.minimum = std::min(extremes.minimum, part.minimum);
+                extremes.maximum = std::max(extremes.maximum, part.maximum);
+            }
+            return extremes.maximum + extremes.minimum;
+        }
+
+        void merge_moments() {
+            moments = combined_moments();
+            for (auto const& part : chunk_moments) { moments.add(part); }
+        }
+
+        /**
+         * @brief Moments of the candidates read off a histogram with one bin per value
+        */
+        void count_moments() {
+            moment_accumulator accumulator;
+            std::vector<std::uint64_t> counts = merged_counts();
+            for (std::size_t bin = 0; bin < counts.size(); bin++) {
+                if (counts[bin] == 0) { continue; }
+                double value = binning.lower_edge(bin);
+                double count = static_cast<double>(counts[bin]);
+                if (accumulator.count == 0) { accumulator.reference = value; }
+                double deviation = value - accumulator.reference;
+                accumulator.count += counts[bin];
+                accumulator.sum += count * deviation;
+                accumulator.sum_squares += count * deviation * deviation;
+                accumulator.minimum = std::min(accumulator.minimum, value);
+                accumulator.maximum = std::max(accumulator.maximum, value);
+            }
+            std::fill(chunk_moments.begin(), chunk_moments.end(), moment_accumulator());
+            chunk_moments.front() = accumulator;
+        }
+
+        std::vector<std::uint64_t> merged_counts() const {
+            std::vector<std::uint64_t> counts(binning.bins, 0);
+            for (auto const& part : chunk_counts) {
+                for (std::size_t bin = 0; bin < part.size(); bin++) { counts[bin] += part[bin]; }
+            }
+            return counts;
+        }
+
+        void count_candidates(histogram_binning<PixelType> const& new_binning) {
+            binning = new_binning;
+            for_each_chunk([&](std::size_t chunk) {
+                std::vector<std::uint32_t>& chunk_count = chunk_counts[chunk];
+                chunk_count.assign(binning.bins, 0);
+                std::uint32_t* counts = chunk_count.data();
+                const histogram_binning<PixelType> bins = binning;
+                for (PixelType value : chunks[chunk]) { counts[bins(value)]++; }
+            });
+        }
+    };
+
+    template<typename PixelType, typename MaskType>
+    inline clipped_statistics sigma_clip(image_view<PixelType> view, const image_view<MaskType>* mask,
+        sigma_clip_options const& options) {
+        if (mask && (mask->width != view.width || mask->height != view.height)) {
+            throw std::invalid_argument("Mask dimensions differ from the image dimensions");
+        }
+        if (!(options.sigma_lower >= 0) || !(options.sigma_upper >= 0)) {
+            throw std::invalid_argument("Clipping limits must not be negative");
+        }
+
+        clipping_state<PixelType> state(view, mask, options.threads);
+        clipped_statistics statistics;
+        std::size_t usable = state.moments.count;
+        if (usable == 0) { return statistics; }
+
+        double median = state.median();
+        bool median_current = true;
+        while (statistics.iterations < options.max_iterations && state.moments.count != 0) {
+            double center = options.center == clip_center::median ? median : state.moments.mean;
+            double deviation = state.moments.standard_deviation();
+            std::size_t dropped = state.clip(center - options.sigma_lower * deviation,
+                center + options.sigma_upper * deviation, center);
+            statistics.iterations++;
+            if (dropped == 0) { break; }
+
+            median_current = false;
+            if (options.center == clip_center::median && state.moments.count != 0) {
+                median = state.median();
+                median_current = true;
+            }
+        }
+
+        statistics.count = state.moments.count;
+        statistics.rejected = usable - statistics.count;
+        if (statistics.count == 0) { return statistics; }
+        statistics.mean = state.moments.mean;
+        statistics.standard_deviation = state.moments.standard_deviation();
+        statistics.median = median_current ? median : state.median();
+        return statistics;
+    }
+}
+
+/**
+ * @brief   Computes the mean, median and standard deviation of the pixels of a view after sigma clipping
+ * @details Each iteration rejects the pixels further than sigma_lower / sigma_upper standard deviations below /
+ *          above the center ( the median or the mean ) of the pixels left, until no pixel is rejected or
+ *          max_iterations is reached. NaN and infinite pixels are ignored
+ * @param[in] view Pixels whose statistics are computed
+ * @param[in] options Clipping limits, center, iterations and threads
+ * @throws std::invalid_argument If a clipping limit is negative
+*/
+template<typename PixelType>
+clipped_statistics sigma_clipped_stats(image_view<PixelType> view, sigma_clip_options const& options = sigma_clip_options()) {
+    return detail::sigma_clip<PixelType, std::uint8_t>(view, nullptr, options);
+}
+
+/**
+ * @brief   Computes sigma clipped statistics of the pixels of a view not masked ( see above )
+ * @param[in] view Pixels whose statistics are computed
+ * @param[in] mask Pixels whose mask value is not zero are ignored
+ * @param[in] options Clipping limits, center, iterations and threads
+ * @throws std::invalid_argument If the mask and the view differ in dimensions or a clipping limit is negative
+*/
+template<typename PixelType, typename MaskType>
+clipped_statistics sigma_clipped_stats(image_view<PixelType> view, image_view<MaskType> mask,
+    sigma_clip_options const& options = sigma_clip_options()) {
+    return detail::sigma_clip(view, &mask, options);
+}
+
+/**
+ * @brief Computes sigma clipped statistics of the pixels of an image ( see above )
+ * @note  The dimensions of the image need not be known
+*/
+template<typename PixelType>
+clipped_statistics sigma_clipped_stats(const image_buffer<PixelType>& image,
+    sigma_clip_options const& options = sigma_clip_options()) {
+    return sigma_clipped_stats(image_view<PixelType>(image.data(), image.size(), image.size() == 0 ? 0 : 1), options);
+}
+
+/**
+ * @brief Computes sigma clipped statistics of the pixels of an image not masked ( see above )
+ * @throws std::invalid_argument If the mask and the image hold different numbers of pixels
+*/
+template<typename PixelType, typename MaskType>
+clipped_statistics sigma_clipped_stats(const image_buffer<PixelType>& image, const image_buffer<MaskType>& mask,
+    sigma_clip_options const& options = sigma_clip_options()) {
+    std::size_t rows = image.size() == 0 ? 0 : 1;
+    return sigma_clipped_stats(image_view<PixelType>(image.data(), image.size(), rows),
+        image_view<MaskType>(mask.data(), mask.size(), mask.size() == 0 ? 0 : 1), options);
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_SIGMA_CLIPPING_HPP
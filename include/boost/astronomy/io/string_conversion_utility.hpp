@@ -8,16 +8,272 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #ifndef BOOST_ASTRONOMY_IO_STRING_CONVERSION_UTILITY_HPP
 #define BOOST_ASTRONOMY_IO_STRING_CONVERSION_UTILITY_HPP
 
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
 #include <limits>
+#include <type_traits>
 #include <boost/lexical_cast.hpp>
-#include <boost/hana/eval_if.hpp>
+#include <boost/type.hpp>
 #include <boost/astronomy/exception/fits_exception.hpp>
 
 
 
 namespace boost{namespace astronomy{namespace io{
 
+    /**
+     * @brief   Formats numbers into a buffer supplied by the caller without allocating any memory
+     * @details Integers are written digit by digit. Floating point numbers are written with the least
+     *          number of significant digits ( starting from digits10 ) which still read back to exactly
+     *          the same value, with an uppercase exponent and always containing a decimal point or an
+     *          exponent so that they are not mistaken for integers
+    */
+    struct number_formatter {
+        //! Size of a buffer large enough to hold any formatted number
+        static constexpr std::size_t max_length = 48;
+
+        /**
+         * @brief Writes the value into the buffer
+         * @param[in] value Number to be formatted
+         * @param[out] buffer Buffer of at least max_length characters
+         * @return Number of characters written ( the buffer is not null terminated )
+        */
+        template<typename T>
+        static std::size_t format(T value, char* buffer) {
+            return format_impl(value, buffer, std::is_floating_point<T>());
+        }
+
+        /**
+         * @brief Booleans are written as 1 or 0 like std::to_string does
+        */
+        static std::size_t format(bool value, char* buffer) {
+            buffer[0] = value ? '1' : '0';
+            return 1;
+        }
+
+    private:
+        template<typename T>
+        static std::size_t format_impl(T value, char* buffer, std::false_type) {
+            typedef typename std::make_unsigned<T>::type unsigned_type;
+
+            char digits[std::numeric_limits<unsigned_type>::digits10 + 1];
+            std::size_t count = 0;
+            bool negative = value < static_cast<T>(0);
+            unsigned_type magnitude = negative ?
+                static_cast<unsigned_type>(static_cast<unsigned_type>(0) - static_cast<unsigned_type>(value)) :
+                static_cast<unsigned_type>(value);
+
+            do {
+                digits[count++] = static_cast<char>('0' + magnitude % 10);
+                magnitude = static_cast<unsigned_type>(magnitude / 10);
+            } while (magnitude != 0);
+
+            std::size_t length = 0;
+            if (negative) { buffer[length++] = '-'; }
+            while (count != 0) { buffer[length++] = digits[--count]; }
+            return length;
+        }
+
+        template<typename T>
+        static std::size_t format_impl(T value, char* buffer, std::true_type) {
+            if (std::isnan(value)) { return copy_text("NAN", buffer); }
+            if (std::isinf(value)) { return copy_text(value < 0 ? "-INF" : "INF", buffer); }
+
+            std::size_t fixed_length = format_fixed(value, buffer);
+            if (fixed_length != 0) { return fixed_length; }
+
+            int length = 0;
+            for (int precision = std::numeric_limits<T>::digits10;
+                precision <= std::numeric_limits<T>::max_digits10; precision++) {
+                length = print(buffer, precision, value);
+                T parsed = read_back(buffer, boost::type<T>());
+                if (!(parsed < value) && !(value < parsed)) { break; }
+            }
+
+            std::size_t written = static_cast<std::size_t>(length);
+            if (std::strpbrk(buffer, ".E") == nullptr) {
+                buffer[written++] = '.';
+                buffer[written++] = '0';
+            }
+            return written;
+        }
+
+        /**
+         * @brief   Writes values with at most digits10 significant digits in fixed notation without calling snprintf
+         * @details Finds the least number of decimals d for which value * 10^d is an integer m that divides back to
+         *          exactly the same value. As both m and 10^d are exact the division is correctly rounded, so m / 10^d
+         *          reads back to value and it is what %G prints at digits10 precision when no exponent is needed
+         * @return  Number of characters written or 0 if the value needs the general path
+        */
+        template<typename T>
+        static std::size_t format_fixed(T value, char* buffer) {
+            if (!(value < 0) && !(value > 0)) { return copy_text(std::signbit(value) ? "-0.0" : "0.0", buffer); }
+
+            const int digits = std::numeric_limits<T>::digits10;
+            double magnitude = std::fabs(static_cast<double>(value));
+            double limit = power_of_ten(digits);
+            if (magnitude < 1e-4 || magnitude >= limit) { return 0; }
+
+            for (int decimals = 0; decimals <= digits; decimals++) {
+                double scale = power_of_ten(decimals);
+                double scaled = std::round(magnitude * scale);
+                if (scaled >= limit) { return 0; }
+                T divided = static_cast<T>(scaled / scale);
+                if (divided < static_cast<T>(magnitude) || divided > static_cast<T>(magnitude)) { continue; }
+
+                unsigned long long mantissa = static_cast<unsigned long long>(scaled);
+                char digit_buffer[24];
+                std::size_t count = 0;
+                do {
+                    digit_buffer[count++] = static_cast<char>('0' + mantissa % 10);
+                    mantissa /= 10;
+                } while (mantissa != 0 || count <= static_cast<std::size_t>(decimals));
+
+                std::size_t length = 0;
+                if (value < 0) { buffer[length++] = '-'; }
+                while (count > static_cast<std::size_t>(decimals)) { buffer[length++] = digit_buffer[--count]; }
+                buffer[length++] = '.';
+                if (decimals == 0) { buffer[length++] = '0'; }
+                while (count != 0) { buffer[length++] = digit_buffer[--count]; }
+                return length;
+            }
+            return 0;
+        }
+
+        static std::size_t format_fixed(long double, char*) { return 0; }
+
+        static double power_of_ten(int exponent) {
+            static const double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+                1e13, 1e14, 1e15 };
+            return powers[exponent];
+        }
+
+        static int print(char* buffer, int precision, double value) {
+            return std::snprintf(buffer, max_length, "%.*G", precision, value);
+        }
+        static int print(char* buffer, int precision, long double value) {
+            return std::snprintf(buffer, max_length, "%.*LG", precision, value);
+        }
+
+        static float read_back(const char* buffer, boost::type<float>) { return std::strtof(buffer, nullptr); }
+        static double read_back(const char* buffer, boost::type<double>) { return std::strtod(buffer, nullptr); }
+        static long double read_back(const char* buffer, boost::type<long double>) { return std::strtold(buffer, nullptr); }
+
+        static std::size_t copy_text(const char* text, char* buffer) {
+            std::size_t length = std::strlen(text);
+            std::memcpy(buffer, text, length);
+            return length;
+        }
+    };
+
+    /**
+     * @brief   Parses numbers from a range of characters without allocating any memory
+     * @details The whole range ( without leading and trailing blanks ) must form the number. Floating point numbers
+     *          may use D as the exponent letter like the FITS ASCII tables do
+    */
+    struct number_parser {
+        /**
+         * @brief Parses a decimal integer with an optional sign
+         * @return Whether the range holds an integer that fits in long long
+        */
+        static bool parse(const char* first, const char* last, long long& value) {
+            trim(first, last);
+            if (first == last) { return false; }
+
+            bool negative = *first == '-';
+            if (*first == '-' || *first == '+') { first++; }
+            if (first == last) { return false; }
+
+            unsigned long long limit = negative ?
+                static_cast<unsigned long long>(std::numeric_limits<long long>::max()) + 1 :
+                static_cast<unsigned long long>(std::numeric_limits<long long>::max());
+            unsigned long long magnitude = 0;
+            for (; first != last; first++) {
+                if (*first < '0' || *first > '9') { return false; }
+                unsigned digit = static_cast<unsigned>(*first - '0');
+                if (magnitude > (limit - digit) / 10) { return false; }
+                magnitude = magnitude * 10 + digit;
+            }
+            value = negative ? static_cast<long long>(0 - magnitude) : static_cast<long long>(magnitude);
+            return true;
+        }
+
+        /**
+         * @brief Parses a floating point number ( including NAN and INF )
+         * @details Numbers with at most 15 significant digits and a small exponent are converted with a single
+         *          multiplication or division by an exact power of ten, which is correctly rounded. Anything else is
+         *          converted by strtod
+         * @return Whether the range holds a floating point number
+        */
+        static bool parse(const char* first, const char* last, double& value) {
+            trim(first, last);
+            if (parse_simple(first, last, value)) { return true; }
+
+            std::size_t length = static_cast<std::size_t>(last - first);
+            if (length == 0 || length >= number_formatter::max_length) { return false; }
+
+            char buffer[number_formatter::max_length];
+            for (std::size_t i = 0; i < length; i++) {
+                buffer[i] = (first[i] == 'D' || first[i] == 'd') ? 'E' : first[i];
+            }
+            buffer[length] = '\0';
+
+            char* end = nullptr;
+            value = std::strtod(buffer, &end);
+            return end == buffer + length;
+        }
+
+    private:
+        static bool parse_simple(const char* first, const char* last, double& value) {
+            static const double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+                1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+            bool negative = first != last && *first == '-';
+            if (first != last && (*first == '-' || *first == '+')) { first++; }
+
+            unsigned long long mantissa = 0;
+            int significant = 0, exponent = 0, digits = 0;
+            for (; first != last && *first >= '0' && *first <= '9'; first++, digits++) {
+                mantissa = mantissa * 10 + static_cast<unsigned>(*first - '0');
+                if (mantissa != 0) { significant++; }
+                if (significant > 15) { return false; }
+            }
+            if (first != last && *first == '.') {
+                for (first++; first != last && *first >= '0' && *first <= '9'; first++, digits++) {
+                    mantissa = mantissa * 10 + static_cast<unsigned>(*first - '0');
+                    exponent--;
+                    if (mantissa != 0) { significant++; }
+                    if (significant > 15) { return false; }
+                }
+            }
+            if (digits == 0) { return false; }
+
+            if (first != last && (*first == 'E' || *first == 'e' || *first == 'D' || *first == 'd')) {
+                long long written_exponent = 0;
+                if (++first == last || *first == ' ' || !parse(first, last, written_exponent) || written_exponent > 1000 ||
+                    written_exponent < -1000) {
+                    return false;
+                }
+                exponent += static_cast<int>(written_exponent);
+                first = last;
+            }
+            if (first != last || exponent > 22 || exponent < -22) { return false; }
+
+            double result = static_cast<double>(mantissa);
+            result = exponent < 0 ? result / powers[-exponent] : result * powers[exponent];
+            value = negative ? -result : result;
+            return true;
+        }
+
+        static void trim(const char*& first, const char*& last) {
+            while (first != last && *first == ' ') { first++; }
+            while (last != first && *(last - 1) == ' ') { last--; }
+        }
+    };
+
     /**
      * @brief Used for serialization and deserialization of ASCII table's data
     */
@@ -48,16 +304,105 @@ namespace boost{namespace astronomy{namespace io{
         */
         template<typename T>
         static std::string serialize(T value) {
-            return
-                boost::hana::eval_if(std::numeric_limits<T>::is_integer,
-                    [&value] {return std::to_string(value); },
-                    [&value](auto _) {
-                        //to_string does not maintain the same rep for floating point numbers causing field size problems
-                        //to_string dosent work for custom types as well(although here it is)
-                        std::stringstream conversion_stream;
-                        conversion_stream << value;
-                        return conversion_stream.str();
-                    });
+            return serialize_impl(value, std::is_arithmetic<T>());
+        }
+
+        /**
+         * @brief Serializes an arithmetic value into the buffer without allocating
+         * @param[in] value The value to be serialized
+         * @param[out] buffer Buffer of at least number_formatter::max_length characters
+         * @return Number of characters written
+        */
+        template<typename T>
+        static std::size_t serialize(T value, char* buffer) {
+            static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be serialized into a buffer");
+            return number_formatter::format(value, buffer);
+        }
+
+        /**
+         * @brief   Serializes the value into the text of an ASCII table field with the given TFORM
+         * @details Real numbers are written with the d decimals of Fw.d, or in exponential notation with d digits after
+         *          the point for Ew.d and Dw.d ( always with the exponent letter E, which FITS accepts for D fields as
+         *          well ). Real numbers in Iw fields are rounded, anything else is written like serialize does
+         * @param[in] value The value to be serialized
+         * @param[in] tform TFORM of the field ( Aw, Iw, Fw.d, Ew.d or Dw.d )
+         * @throws invalid_cast If the value is NaN or infinite, which ASCII tables cannot hold
+         * @throws invalid_table_colum_format If the TFORM is invalid or the text is wider than the field
+        */
+        template<typename T>
+        static std::string serialize_field(T value, const std::string& tform) {
+            field_format format = parse_field_format(tform);
+            std::string text = format_field(value, format, std::is_arithmetic<T>());
+            if (text.length() > format.width) { throw invalid_table_colum_format(); }
+            return text;
+        }
+
+    private:
+        struct field_format {
+            char type;
+            std::size_t width;
+            int decimals;
+        };
+
+        static field_format parse_field_format(const std::string& tform) {
+            std::size_t first = tform.find_first_not_of("' ");
+            std::size_t last = tform.find_last_not_of("' ");
+            if (first == std::string::npos || last == first) { throw invalid_table_colum_format(); }
+
+            std::string form = tform.substr(first, last - first + 1);
+            std::size_t point = form.find('.');
+            field_format format;
+            format.type = form[0];
+            try {
+                format.width = boost::lexical_cast<std::size_t>(form.substr(1, point == std::string::npos ?
+                    std::string::npos : point - 1));
+                format.decimals = point == std::string::npos ? 0 : boost::lexical_cast<int>(form.substr(point + 1));
+            }
+            catch (bad_lexical_cast&) {
+                throw invalid_table_colum_format();
+            }
+            return format;
+        }
+
+        template<typename T>
+        static std::string format_field(T value, field_format const& format, std::true_type) {
+            if (std::is_floating_point<T>::value && !std::isfinite(static_cast<long double>(value))) {
+                throw invalid_cast("ASCII table fields cannot hold NaN or infinite values");
+            }
+
+            switch (format.type) {
+            case 'F': return print_real("%.*f", format.decimals, static_cast<double>(value));
+            case 'E': case 'D': return print_real("%.*E", format.decimals, static_cast<double>(value));
+            case 'I':
+                if (std::is_floating_point<T>::value) { return print_real("%.*f", 0, static_cast<double>(value)); }
+                return serialize_impl(value, std::true_type());
+            default: return serialize_impl(value, std::true_type());
+            }
+        }
+
+        template<typename T>
+        static std::string format_field(const T& value, field_format const&, std::false_type) {
+            return serialize_impl(value, std::false_type());
+        }
+
+        static std::string print_real(const char* format, int decimals, double value) {
+            char buffer[number_formatter::max_length];
+            int length = std::snprintf(buffer, sizeof(buffer), format, decimals, value);
+            if (length < 0 || static_cast<std::size_t>(length) >= sizeof(buffer)) { throw invalid_table_colum_format(); }
+            return std::string(buffer, static_cast<std::size_t>(length));
+        }
+
+        template<typename T>
+        static std::string serialize_impl(T value, std::true_type) {
+            char buffer[number_formatter::max_length];
+            return std::string(buffer, number_formatter::format(value, buffer));
+        }
+
+        template<typename T>
+        static std::string serialize_impl(const T& value, std::false_type) {
+            std::stringstream conversion_stream;
+            conversion_stream << value;
+            return conversion_stream.str();
         }
 
     };
@@ -11,6 +11,7 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include <cstddef>
 #include <fstream>
 #include <string>
+#include <unordered_map>
 #include <boost/astronomy/io/header.hpp>
 #include <boost/astronomy/io/extension_hdu.hpp>
 #include <boost/astronomy/io/column.hpp>
@@ -32,6 +33,7 @@ protected:
 
     typedef std::vector<std::vector<std::string>> table_data;
     mutable table_data tb_data;
+    std::unordered_map<std::string, std::size_t> column_positions;
 
 public:
     /**
@@ -60,16 +62,59 @@ public:
         return this->hdu_header;
     }
 
+    /**
+     * @brief Returns a reference to the header associated with the currently held hdu
+    */
+    header<CardPolicy>& get_header() {
+        return this->hdu_header;
+    }
+
+    /**
+     * @brief Returns the handle of the column with given name
+     * @details Resolving the name once and using the handle avoids looking up the name on every access
+     * @param[in] column_name Name ( TTYPE ) of the column
+     * @throws column_not_found_exception If no column of the table has the given name
+    */
+    column_id get_column_id(const std::string& column_name) const {
+        auto pos = this->column_positions.find(column_name);
+        if (pos != this->column_positions.end()) {
+            return column_id(pos->second);
+        }
+        throw column_not_found_exception(column_name);
+    }
+
+    /**
+     * @brief Returns the metadata associated with the perticular column ( indicated by its handle )
+     * @param[in] id Handle of the column obtained from this table
+     * @throws std::out_of_range If the handle does not refer to a column of this table
+    */
+    const column& get_column_metadata(column_id id) const {
+        return this->col_metadata_.at(id.position());
+    }
+
+    /**
+     * @brief Returns the metadata of all the columns in the order of their position
+    */
+    const std::vector<column>& get_all_column_metadata() const {
+        return this->col_metadata_;
+    }
+
     /**
      * @brief Returns a copy of the metadata associated with the perticular column ( indicated by column_name )
      * @param[in] column_name Name of column whose metadata needs to be returned
     */
     column get_column_metadata(const std::string& column_name) const {
-        auto pos = std::find_if(this->col_metadata_.begin(), col_metadata_.end(), [&](const column& col) {return column_name == col.TTYPE(); });
-        if (pos != this->col_metadata_.end()) {
-            return (*pos);
-        }
-        throw column_not_found_exception(column_name);
+        return get_column_metadata(get_column_id(column_name));
+    }
+
+    /**
+     * @brief Constructs a column view of a perticular column/field
+     * @tparam ColDataType The data type of elements in the column
+     * @tparam Converter Policy to serialize and deserialize data
+    */
+    template<typename ColDataType, typename Converter>
+    column_view<ColDataType, Converter> make_column_view(column_id id) const {
+        return column_view<ColDataType, Converter>(get_column_metadata(id), &tb_data);
     }
 
     /**
@@ -79,8 +124,7 @@ public:
     */
     template<typename ColDataType, typename Converter>
     column_view<ColDataType, Converter> make_column_view(const std::string& column_name) const {
-            return column_view<ColDataType,Converter>(get_column_metadata(column_name), &tb_data);
-    
+        return make_column_view<ColDataType, Converter>(get_column_id(column_name));
     }
 
     /**
@@ -93,6 +137,21 @@ public:
     */
     table_data& get_data() { return this->tb_data; }
 
+    protected:
+
+    /**
+     * @brief Maps the name of every column to its position
+     * @note  Must be called whenever col_metadata_ is populated. The first column is kept if names repeat
+    */
+    void index_columns() {
+        this->column_positions.clear();
+        for (std::size_t i = 0; i < this->col_metadata_.size(); i++) {
+            if (!this->col_metadata_[i].TTYPE().empty()) {
+                this->column_positions.emplace(this->col_metadata_[i].TTYPE(), i);
+            }
+        }
+    }
+
     private:
 
     /**
@@ -0,0 +1,123 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_TABLE_FIELD_HPP
+#define BOOST_ASTRONOMY_IO_TABLE_FIELD_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/io/binary_field_layout.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+/**
+ * @file    table_field.hpp
+ * @details Plans shared by the exporters of FITS tables ( CSV and Arrow ): where a column lies in the row, how many
+ *          values it holds and which stored value marks a null
+*/
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief Position, size and null marker of a column of a FITS table
+*/
+struct table_field {
+    std::string name;               //! Name of the column ( TTYPE or COLn )
+    char type = ' ';                //! FITS data type ( binary table TFORM letter or ASCII table TFORM letter )
+    bool ascii = false;             //! Whether the column belongs to an ASCII table
+    std::size_t offset = 0;         //! Offset of the field from the start of the row
+    std::size_t width = 0;          //! Width of the field in bytes
+    std::size_t repeat = 1;         //! Repeat count of TFORM ( 1 for ASCII tables )
+    std::size_t elements = 1;       //! Number of values in the field ( bits of X, two reals per complex value )
+    std::size_t element_size = 1;   //! Size of a value in bytes ( the whole field for ASCII tables )
+    bool has_null = false;          //! Whether TNULL is defined for the column
+    long long null_value = 0;       //! TNULL of binary table integer columns
+    std::string ascii_null;         //! TNULL of ASCII table columns
+};
+
+namespace detail {
+
+    /**
+     * @brief Returns TTYPE without surrounding blanks, or COLn for unnamed columns
+    */
+    inline std::string table_column_name(column const& metadata) {
+        std::string name = boost::trim_copy(metadata.TTYPE());
+        return name.empty() ? "COL" + boost::lexical_cast<std::string>(metadata.index()) : name;
+    }
+
+    /**
+     * @brief Plans a binary table column from its metadata ( TBCOL holds the offset in the row )
+     * @throws invalid_table_colum_format If the format is invalid or a variable length array ( P or Q )
+    */
+    inline table_field make_binary_table_field(column const& metadata) {
+        binary_field_layout layout = make_binary_field_layout(metadata);
+        if (layout.type == 'P' || layout.type == 'Q') { throw invalid_table_colum_format(); }
+
+        table_field field;
+        field.name = table_column_name(metadata);
+        field.type = layout.type;
+        field.repeat = layout.repeat;
+        field.offset = layout.offset;
+        field.width = layout.width;
+        field.elements = (field.type == 'C' || field.type == 'M') ? 2 * layout.repeat : layout.repeat;
+        field.element_size = layout.element_size;
+        return field;
+    }
+
+    /**
+     * @brief Plans an ASCII table column of the given width ( TBCOL holds the one based position in the row )
+     * @throws invalid_table_colum_format If the format is not one of A, I, F, E or D
+    */
+    inline table_field make_ascii_table_field(column const& metadata, std::size_t width) {
+        std::string form = boost::trim_copy_if(metadata.TFORM(), [](char c) -> bool { return c == '\'' || c == ' '; });
+        if (form.empty() || std::string("AIFED").find(form[0]) == std::string::npos) {
+            throw invalid_table_colum_format();
+        }
+
+        table_field field;
+        field.name = table_column_name(metadata);
+        field.type = form[0];
+        field.ascii = true;
+        field.offset = metadata.TBCOL() - 1;
+        field.width = width;
+        field.element_size = width;
+        return field;
+    }
+
+    /**
+     * @brief Plans every column of a table with make_field and records the TNULL of each
+     * @details TNULL is an integer for binary tables and the text of the field for ASCII tables
+    */
+    template<typename Field, typename Table, typename MakeField>
+    inline std::vector<Field> plan_table_fields(Table const& table, MakeField const& make_field) {
+        std::vector<Field> fields;
+        for (auto const& metadata : table.get_all_column_metadata()) {
+            fields.push_back(make_field(metadata));
+            std::string tnull = "TNULL" + boost::lexical_cast<std::string>(metadata.index());
+            if (!table.get_header().contains_keyword(tnull)) { continue; }
+
+            Field& field = fields.back();
+            field.has_null = true;
+            if (field.ascii) {
+                field.ascii_null = boost::trim_copy(table.get_header().template value_of<std::string>(tnull));
+            }
+            else {
+                field.null_value = table.get_header().template value_of<long long>(tnull);
+            }
+        }
+        return fields;
+    }
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_TABLE_FIELD_HPP
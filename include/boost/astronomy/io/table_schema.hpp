@@ -0,0 +1,403 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_TABLE_SCHEMA_HPP
+#define BOOST_ASTRONOMY_IO_TABLE_SCHEMA_HPP
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <boost/endian/conversion.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <boost/astronomy/io/binary_field_layout.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/header.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+/**
+ * @brief   Declares a column of a table_schema
+ * @details Creates a tag type with the given name that is used both in the schema and for accessing the column
+ *          e.g BOOST_ASTRONOMY_TABLE_COLUMN(ra, "RA", double) declares a column named RA holding doubles
+ * @param   tag Name of the tag type
+ * @param   column_name Value of TTYPEn of the column
+ * @param   ... Type of a single field of the column ( may contain commas e.g std::array<float, 4> )
+*/
+#define BOOST_ASTRONOMY_TABLE_COLUMN(tag, column_name, ...)            \
+    struct tag {                                                          \
+        typedef __VA_ARGS__ value_type;                                   \
+        static const char* name() { return column_name; }                 \
+    }
+
+namespace boost { namespace astronomy { namespace io {
+
+namespace detail {
+
+    /**
+     * @brief Reads a big endian value of type T whose bits are stored as the unsigned integer Bits
+    */
+    template<typename T, typename Bits>
+    inline T load_big_endian(const char* field) {
+        static_assert(sizeof(T) == sizeof(Bits), "T and Bits must have the same size");
+
+        Bits raw;
+        std::memcpy(&raw, field, sizeof(Bits));
+        raw = boost::endian::big_to_native(raw);
+
+        T value;
+        std::memcpy(&value, &raw, sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Writes the value of type T in big endian byte order through the unsigned integer Bits
+    */
+    template<typename T, typename Bits>
+    inline void store_big_endian(T value, char* field) {
+        static_assert(sizeof(T) == sizeof(Bits), "T and Bits must have the same size");
+
+        Bits raw;
+        std::memcpy(&raw, &value, sizeof(T));
+        boost::endian::native_to_big_inplace(raw);
+        std::memcpy(field, &raw, sizeof(Bits));
+    }
+
+    /**
+     * @brief Layout of a scalar binary table field stored in big endian byte order
+    */
+    template<typename T, typename Bits, char Type>
+    struct big_endian_field {
+        static constexpr char type() { return Type; }
+        static constexpr std::size_t repeat() { return 1; }
+        static constexpr std::size_t size() { return sizeof(T); }
+        static T decode(const char* field, std::size_t) { return load_big_endian<T, Bits>(field); }
+        static void encode(T const& value, char* field, std::size_t) { store_big_endian<T, Bits>(value, field); }
+    };
+
+    /**
+     * @brief Layout of a complex binary table field ( real part followed by the imaginary part )
+    */
+    template<typename T, typename Bits, char Type>
+    struct complex_field {
+        static constexpr char type() { return Type; }
+        static constexpr std::size_t repeat() { return 1; }
+        static constexpr std::size_t size() { return 2 * sizeof(T); }
+        static std::complex<T> decode(const char* field, std::size_t) {
+            return std::complex<T>(load_big_endian<T, Bits>(field), load_big_endian<T, Bits>(field + sizeof(T)));
+        }
+        static void encode(std::complex<T> const& value, char* field, std::size_t) {
+            store_big_endian<T, Bits>(value.real(), field);
+            store_big_endian<T, Bits>(value.imag(), field + sizeof(T));
+        }
+    };
+}
+
+/**
+ * @brief   Describes how a C++ type is stored in a field of a binary table
+ * @details Each specialization provides the TFORM type code, the repeat count ( 0 if any repeat is accepted ),
+ *          the size of a single element and decodes a field from the raw row or encodes a value into it
+ * @tparam  T Type of the field
+*/
+template<typename T>
+struct binary_field;
+
+template<> struct binary_field<bool> {
+    static constexpr char type() { return 'L'; }
+    static constexpr std::size_t repeat() { return 1; }
+    static constexpr std::size_t size() { return 1; }
+    static bool decode(const char* field, std::size_t) { return *field == 'T'; }
+    static void encode(bool value, char* field, std::size_t) { *field = value ? 'T' : 'F'; }
+};
+
+template<> struct binary_field<char> {
+    static constexpr char type() { return 'A'; }
+    static constexpr std::size_t repeat() { return 1; }
+    static constexpr std::size_t size() { return 1; }
+    static char decode(const char* field, std::size_t) { return *field; }
+    static void encode(char value, char* field, std::size_t) { *field = value; }
+};
+
+template<> struct binary_field<std::uint8_t> : detail::big_endian_field<std::uint8_t, std::uint8_t, 'B'> {};
+template<> struct binary_field<std::int16_t> : detail::big_endian_field<std::int16_t, std::uint16_t, 'I'> {};
+template<> struct binary_field<std::int32_t> : detail::big_endian_field<std::int32_t, std::uint32_t, 'J'> {};
+template<> struct binary_field<std::int64_t> : detail::big_endian_field<std::int64_t, std::uint64_t, 'K'> {};
+template<> struct binary_field<float> : detail::big_endian_field<float, std::uint32_t, 'E'> {};
+template<> struct binary_field<double> : detail::big_endian_field<double, std::uint64_t, 'D'> {};
+template<> struct binary_field<std::complex<float>> : detail::complex_field<float, std::uint32_t, 'C'> {};
+template<> struct binary_field<std::complex<double>> : detail::complex_field<double, std::uint64_t, 'M'> {};
+
+/**
+ * @brief Fixed size vector field ( e.g 4E as std::array<float, 4> )
+*/
+template<typename T, std::size_t N>
+struct binary_field<std::array<T, N>> {
+    static constexpr char type() { return binary_field<T>::type(); }
+    static constexpr std::size_t repeat() { return N; }
+    static constexpr std::size_t size() { return binary_field<T>::size(); }
+    static std::array<T, N> decode(const char* field, std::size_t) {
+        std::array<T, N> values;
+        for (std::size_t i = 0; i < N; i++) {
+            values[i] = binary_field<T>::decode(field + i * binary_field<T>::size(), binary_field<T>::size());
+        }
+        return values;
+    }
+    static void encode(std::array<T, N> const& values, char* field, std::size_t) {
+        for (std::size_t i = 0; i < N; i++) {
+            binary_field<T>::encode(values[i], field + i * binary_field<T>::size(), binary_field<T>::size());
+        }
+    }
+};
+
+/**
+ * @brief Character field of any width ( trailing blanks and NULs are removed when decoding, values are padded
+ *        with blanks when encoding )
+*/
+template<> struct binary_field<std::string> {
+    static constexpr char type() { return 'A'; }
+    static constexpr std::size_t repeat() { return 0; }
+    static constexpr std::size_t size() { return 1; }
+    static std::string decode(const char* field, std::size_t width) {
+        while (width > 0 && (field[width - 1] == ' ' || field[width - 1] == '\0')) { width--; }
+        return std::string(field, width);
+    }
+    static void encode(std::string const& value, char* field, std::size_t width) {
+        std::size_t length = std::min(value.size(), width);
+        std::memcpy(field, value.data(), length);
+        std::memset(field + length, ' ', width - length);
+    }
+};
+
+/**
+ * @brief   List of columns ( declared with BOOST_ASTRONOMY_TABLE_COLUMN ) expected in a binary table
+ * @tparam  Columns Tags of the columns
+*/
+template<typename... Columns>
+struct table_schema {
+    static constexpr std::size_t size() { return sizeof...(Columns); }
+};
+
+namespace detail {
+
+    /**
+     * @brief Position of Column in the list of columns ( fails to compile if the column is not in the list )
+    */
+    template<typename Column, typename... Columns>
+    struct column_position;
+
+    template<typename Column, typename... Rest>
+    struct column_position<Column, Column, Rest...> : std::integral_constant<std::size_t, 0> {};
+
+    template<typename Column, typename First, typename... Rest>
+    struct column_position<Column, First, Rest...>
+        : std::integral_constant<std::size_t, 1 + column_position<Column, Rest...>::value> {};
+}
+
+/**
+ * @brief   Strided read only view over a single column of a typed_binary_table
+ * @details Accessing a field is a load at a fixed offset from the start of its row, no lookup is done
+ * @tparam  T Type of the fields in the column
+*/
+template<typename T>
+class typed_column {
+    const char* first_field;
+    std::size_t stride;
+    std::size_t rows;
+    std::size_t width;
+
+public:
+    typedef T value_type;
+
+    /**
+     * @brief Iterates over the fields of the column ( fields are decoded on dereference )
+    */
+    class const_iterator {
+        const char* field;
+        std::size_t stride;
+        std::size_t width;
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef T reference;
+
+        const_iterator() :field(nullptr), stride(0), width(0) {}
+        const_iterator(const char* field_ptr, std::size_t row_stride, std::size_t field_width)
+            :field(field_ptr), stride(row_stride), width(field_width) {}
+
+        T operator*() const { return binary_field<T>::decode(field, width); }
+        const_iterator& operator++() { field += stride; return *this; }
+        const_iterator operator++(int) { const_iterator previous = *this; field += stride; return previous; }
+        bool operator==(const const_iterator& other) const { return field == other.field; }
+        bool operator!=(const const_iterator& other) const { return field != other.field; }
+    };
+
+    typed_column(const char* first, std::size_t row_stride, std::size_t total_rows, std::size_t field_width)
+        :first_field(first), stride(row_stride), rows(total_rows), width(field_width) {}
+
+    /**
+     * @brief Returns the field of the column in given row
+    */
+    T operator[](std::size_t row) const { return binary_field<T>::decode(first_field + row * stride, width); }
+
+    /**
+     * @brief Returns the number of rows in the column
+    */
+    std::size_t size() const { return rows; }
+
+    const_iterator begin() const { return const_iterator(first_field, stride, width); }
+    const_iterator end() const { return const_iterator(first_field + rows * stride, stride, width); }
+};
+
+/**
+ * @brief   Binary table whose columns are known at compile time
+ * @details The schema is checked against TTYPEn and TFORMn of the header once, when the table is created, and
+ *          the offset of each column in a row is resolved at the same time. Afterwards fields are decoded straight
+ *          from the raw rows, without looking up column names or dispatching on the column type.
+ *          Columns of the table that are not in the schema are skipped
+ * @tparam  Schema table_schema listing the columns
+ * @author  agent
+*/
+template<typename Schema>
+class typed_binary_table;
+
+template<typename... Columns>
+class typed_binary_table<table_schema<Columns...>> {
+    static_assert(sizeof...(Columns) > 0, "table_schema must contain at least one column");
+
+    static constexpr std::size_t total_columns = sizeof...(Columns);
+
+    std::string rows_data;
+    std::size_t row_width;
+    std::size_t rows;
+    std::array<std::size_t, total_columns> offsets;
+    std::array<std::size_t, total_columns> widths;
+
+public:
+    typedef table_schema<Columns...> schema_type;
+
+    /**
+     * @brief Creates the table from the header and data of a binary table HDU
+     * @param[in] table_header Header of the binary table
+     * @param[in] data_buffer Data unit of the binary table
+     * @throws column_not_found_exception If a column of the schema is not present in the table
+     * @throws invalid_table_colum_format If the type or repeat count of a column does not match the schema
+     * @throws file_reading_exception If the data unit is smaller than the table
+    */
+    template<typename CardPolicy>
+    typed_binary_table(header<CardPolicy> const& table_header, std::string data_buffer)
+        :rows_data(std::move(data_buffer)), row_width(0), rows(0) {
+        resolve_columns(table_header);
+        if (rows_data.size() < rows * row_width) {
+            throw file_reading_exception("Data unit is smaller than the table described by the header");
+        }
+    }
+
+    /**
+     * @brief Creates the table from an already read binary table
+     * @details The rows of the table are copied once into a single buffer
+     * @throws column_not_found_exception If a column of the schema is not present in the table
+     * @throws invalid_table_colum_format If the type or repeat count of a column does not match the schema
+    */
+    template<typename CardPolicy, typename Converter>
+    explicit typed_binary_table(basic_binary_table_extension<CardPolicy, Converter> const& table)
+        :typed_binary_table(table.get_header(), join_rows(table.get_data())) {}
+
+    /**
+     * @brief Returns the number of rows in the table
+    */
+    std::size_t total_rows() const { return rows; }
+
+    /**
+     * @brief Returns the field of the column in given row
+     * @tparam Column Tag of the column
+    */
+    template<typename Column>
+    typename Column::value_type get(std::size_t row) const {
+        constexpr std::size_t position = detail::column_position<Column, Columns...>::value;
+        return binary_field<typename Column::value_type>::decode(
+            rows_data.data() + row * row_width + offsets[position], widths[position]);
+    }
+
+    /**
+     * @brief Returns a strided view of the column
+     * @tparam Column Tag of the column
+    */
+    template<typename Column>
+    typed_column<typename Column::value_type> column() const {
+        constexpr std::size_t position = detail::column_position<Column, Columns...>::value;
+        return typed_column<typename Column::value_type>(
+            rows_data.data() + offsets[position], row_width, rows, widths[position]);
+    }
+
+private:
+    /**
+     * @brief Matches the columns of the schema with the fields of the table and computes their offsets
+    */
+    template<typename CardPolicy>
+    void resolve_columns(header<CardPolicy> const& table_header) {
+        const char* names[] = { Columns::name()... };
+        const char types[] = { binary_field<typename Columns::value_type>::type()... };
+        const std::size_t repeats[] = { binary_field<typename Columns::value_type>::repeat()... };
+        std::array<bool, total_columns> found;
+        found.fill(false);
+
+        std::size_t fields = table_header.template value_of<std::size_t>("TFIELDS");
+        std::size_t offset = 0;
+        for (std::size_t field = 1; field <= fields; field++) {
+            std::string index = boost::lexical_cast<std::string>(field);
+            binary_field_layout layout = parse_binary_form(table_header.template value_of<std::string>("TFORM" + index));
+            if (layout.type == 'P' || layout.type == 'Q') { throw invalid_table_colum_format(); }
+            char type = layout.type;
+            std::size_t repeat = layout.repeat;
+            std::size_t width = layout.width;
+
+            if (table_header.contains_keyword("TTYPE" + index)) {
+                std::string name = table_header.template value_of<std::string>("TTYPE" + index);
+                for (std::size_t i = 0; i < total_columns; i++) {
+                    if (found[i] || name != names[i]) { continue; }
+                    if (type != types[i] || (repeats[i] != 0 && repeat != repeats[i])) {
+                        throw invalid_table_colum_format();
+                    }
+                    offsets[i] = offset;
+                    widths[i] = width;
+                    found[i] = true;
+                }
+            }
+            offset += width;
+        }
+
+        for (std::size_t i = 0; i < total_columns; i++) {
+            if (!found[i]) { throw column_not_found_exception(names[i]); }
+        }
+
+        if (offset != table_header.naxis(1)) { throw invalid_table_colum_format(); }
+        row_width = offset;
+        rows = table_header.naxis(2);
+    }
+
+    template<typename TableData>
+    static std::string join_rows(TableData const& table_data) {
+        std::string joined;
+        for (auto const& row : table_data) {
+            for (auto const& field : row) { joined += field; }
+        }
+        return joined;
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_TABLE_SCHEMA_HPP
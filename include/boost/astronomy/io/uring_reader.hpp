@@ -0,0 +1,548 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_IO_URING_READER_HPP
+#define BOOST_ASTRONOMY_IO_URING_READER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <boost/astronomy/io/positional_file.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+// io_uring is used on Linux when the kernel headers provide it, define BOOST_ASTRONOMY_IO_NO_IO_URING to disable it
+#if defined(__linux__) && !defined(BOOST_ASTRONOMY_IO_NO_IO_URING) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <cerrno>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define BOOST_ASTRONOMY_IO_HAS_IO_URING
+#endif
+#endif
+#endif
+
+namespace boost { namespace astronomy { namespace io {
+
+/**
+ * @brief   Configuration of uring_read_queue and uring_stream
+ * @details The default depth keeps enough reads in flight for a fast device ( e.g. an NVMe drive ) to reach its
+ *          bandwidth. Files read from the page cache gain nothing from the depth, a depth of 1 keeps their chunks
+ *          in the CPU caches
+*/
+struct uring_options {
+    unsigned queue_depth = 32;                      //! Reads in flight at once ( also the number of buffers )
+    std::size_t chunk_size = 1 << 18;               //! Size of every buffer, longer reads are split in chunks
+    std::size_t queued_read_size = 1 << 16;         //! Reads of uring_stream shorter than this use the stream
+    bool use_io_uring = true;                       //! Uses positional reads when false
+};
+
+/**
+ * @brief Chunk of a queued read which has been read into one of the buffers of uring_read_queue
+*/
+struct read_completion {
+    std::size_t tag;       //! Tag given when the read was queued
+    std::size_t position;  //! Offset of the chunk from the start of the queued read
+    const char* data;      //! Bytes read, valid until the handler returns
+    std::size_t size;      //! Size of the chunk ( shorter than the chunk size only at the end of file )
+};
+
+namespace detail {
+
+#ifdef BOOST_ASTRONOMY_IO_HAS_IO_URING
+    /**
+     * @brief   Submission and completion rings of an io_uring instance, used through the raw system calls
+     * @details Only what uring_read_queue needs is provided: reads into registered buffers or plain buffers
+    */
+    class io_uring_ring {
+        int ring_fd = -1;
+        void* sq_ring = MAP_FAILED;
+        std::size_t sq_ring_size = 0;
+        void* cq_ring = MAP_FAILED;
+        std::size_t cq_ring_size = 0;
+        io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+        std::size_t sqes_size = 0;
+
+        unsigned* sq_tail = nullptr;
+        unsigned* sq_mask = nullptr;
+        unsigned* sq_array = nullptr;
+        unsigned* cq_head = nullptr;
+        unsigned* cq_tail = nullptr;
+        unsigned* cq_mask = nullptr;
+        io_uring_cqe* cqes = nullptr;
+        unsigned unsubmitted = 0;
+
+    public:
+        io_uring_ring() {}
+        io_uring_ring(const io_uring_ring&) = delete;
+        io_uring_ring& operator=(const io_uring_ring&) = delete;
+        ~io_uring_ring() { release(); }
+
+        /**
+         * @brief Creates the rings with room for entries submissions
+         * @return false if the kernel does not allow io_uring ( too old, disabled or filtered by seccomp )
+        */
+        bool setup(unsigned entries) {
+            io_uring_params params;
+            std::memset(&params, 0, sizeof(params));
+            ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+            if (ring_fd < 0) { return false; }
+
+            sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (single_mmap && cq_ring_size > sq_ring_size) { sq_ring_size = cq_ring_size; }
+
+            sq_ring = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+            if (sq_ring == MAP_FAILED) { release(); return false; }
+            if (single_mmap) {
+                cq_ring = sq_ring;
+            }
+            else {
+                cq_ring = mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+                if (cq_ring == MAP_FAILED) { release(); return false; }
+            }
+            sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+            sqes = static_cast<io_uring_sqe*>(mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES));
+            if (sqes == MAP_FAILED) { release(); return false; }
+
+            char* sq = static_cast<char*>(sq_ring);
+            char* cq = static_cast<char*>(cq_ring);
+            sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            return true;
+        }
+
+        /**
+         * @brief Registers the buffers so that reads skip mapping them for every request
+         * @return false if the buffers could not be registered ( for example when RLIMIT_MEMLOCK is too low )
+        */
+        bool register_buffers(const iovec* buffers, unsigned count) {
+            return syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_BUFFERS, buffers, count) == 0;
+        }
+
+        /**
+         * @brief Queues a read of size bytes at offset of fd into buffer, submitted by the next call to submit_and_wait
+         * @param[in] fixed_buffer Index of the registered buffer holding buffer or -1 if buffers are not registered
+         * @note  The caller never has more reads in flight than the number of entries given to setup
+        */
+        void queue_read(int fd, std::size_t offset, char* buffer, unsigned size, int fixed_buffer, std::uint64_t user_data,
+            iovec& vector) {
+            unsigned tail = *sq_tail;
+            unsigned index = tail & *sq_mask;
+            io_uring_sqe& sqe = sqes[index];
+            std::memset(&sqe, 0, sizeof(sqe));
+            sqe.fd = fd;
+            sqe.off = offset;
+            sqe.user_data = user_data;
+            if (fixed_buffer >= 0) {
+                sqe.opcode = IORING_OP_READ_FIXED;
+                sqe.addr = reinterpret_cast<std::uint64_t>(buffer);
+                sqe.len = size;
+                sqe.buf_index = static_cast<std::uint16_t>(fixed_buffer);
+            }
+            else {
+                vector.iov_base = buffer;
+                vector.iov_len = size;
+                sqe.opcode = IORING_OP_READV;
+                sqe.addr = reinterpret_cast<std::uint64_t>(&vector);
+                sqe.len = 1;
+            }
+            sq_array[index] = index;
+            __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+            unsubmitted++;
+        }
+
+        /**
+         * @brief Submits the queued reads and waits until at least wait_for of them have completed
+         * @return Number of reads submitted, or the negated errno if io_uring_enter fails ( -EBUSY until the
+         *         completions received are consumed, -EAGAIN while the kernel is short of resources ). The reads
+         *         left unsubmitted are submitted by the next call
+        */
+        long submit_and_wait(unsigned wait_for) {
+            long submitted = 0;
+            while (true) {
+                long result = syscall(__NR_io_uring_enter, ring_fd, unsubmitted, wait_for,
+                    wait_for != 0 ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+                if (result > 0) {
+                    unsubmitted -= static_cast<unsigned>(result);
+                    submitted += result;
+                    if (unsubmitted != 0) { continue; }
+                }
+                if (result >= 0) { return submitted; }
+                if (errno != EINTR) { return -errno; }
+            }
+        }
+
+        /**
+         * @brief Calls function( user_data, result ) for every completion received, consuming them
+        */
+        template<typename Function>
+        void for_each_completion(Function function) {
+            unsigned head = *cq_head;
+            unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+            while (head != tail) {
+                const io_uring_cqe& cqe = cqes[head & *cq_mask];
+                std::uint64_t user_data = cqe.user_data;
+                int result = cqe.res;
+                head++;
+                __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+                function(user_data, result);
+            }
+        }
+
+    private:
+        void release() {
+            if (sqes != MAP_FAILED) { munmap(sqes, sqes_size); }
+            if (cq_ring != MAP_FAILED && cq_ring != sq_ring) { munmap(cq_ring, cq_ring_size); }
+            if (sq_ring != MAP_FAILED) { munmap(sq_ring, sq_ring_size); }
+            if (ring_fd >= 0) { close(ring_fd); }
+            sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+            cq_ring = sq_ring = MAP_FAILED;
+            ring_fd = -1;
+        }
+    };
+#endif
+
+} // namespace detail
+
+/**
+ * @brief   Completion based reader queueing many reads of a file at once
+ * @details Queued reads are split into chunks of uring_options::chunk_size and read into a fixed set of buffers,
+ *          up to uring_options::queue_depth chunks in flight. On Linux the reads are submitted to io_uring with
+ *          the buffers registered to the kernel, elsewhere ( or if the kernel refuses io_uring ) every chunk is
+ *          read with a positional read when it is polled. Chunks complete in any order, each one is handed to the
+ *          handler as soon as it has landed so that decoding can start while the remaining chunks are read
+ * @note    The queue is used by a single thread, the handler may queue more reads
+*/
+class uring_read_queue {
+    struct chunk_request {
+        std::size_t tag;
+        std::size_t position;  // Offset of the chunk from the start of the queued read
+        std::size_t offset;    // Offset of the chunk in the file
+        std::size_t size;
+    };
+
+    struct buffer_slot {
+        chunk_request chunk;
+        std::size_t bytes_read;
+    };
+
+    positional_file file;
+    uring_options options;
+    std::unique_ptr<char[]> storage;
+    std::vector<buffer_slot> slots;
+    std::vector<unsigned> free_slots;
+    std::deque<chunk_request> pending;
+    std::size_t in_flight = 0;
+#ifdef BOOST_ASTRONOMY_IO_HAS_IO_URING
+    std::unique_ptr<detail::io_uring_ring> ring;
+    std::vector<iovec> vectors;
+    bool fixed_buffers = false;
+#endif
+
+public:
+    /**
+     * @brief Opens the file and allocates the buffers
+     * @param[in] path Location of the file
+     * @param[in] queue_options Queue depth and size of the buffers
+     * @throws file_reading_exception If the file cannot be opened
+    */
+    explicit uring_read_queue(const std::string& path, uring_options queue_options = uring_options())
+        :file(path), options(queue_options) {
+        if (options.queue_depth == 0) { options.queue_depth = 1; }
+        if (options.chunk_size == 0) { options.chunk_size = 1 << 18; }
+        if (options.chunk_size > (1u << 30)) { options.chunk_size = 1u << 30; }
+
+        // Positional reads complete one chunk at a time, so they need a single buffer
+        std::size_t buffer_count = 1;
+#ifdef BOOST_ASTRONOMY_IO_HAS_IO_URING
+        if (options.use_io_uring) {
+            ring.reset(new detail::io_uring_ring());
+            if (ring->setup(options.queue_depth)) { buffer_count = options.queue_depth; }
+            else { ring.reset(); }
+        }
+#endif
+        storage.reset(new char[buffer_count * options.chunk_size]);
+        slots.resize(buffer_count);
+        for (std::size_t slot = buffer_count; slot > 0; slot--) { free_slots.push_back(static_cast<unsigned>(slot - 1)); }
+
+#ifdef BOOST_ASTRONOMY_IO_HAS_IO_URING
+        if (ring) {
+            vectors.resize(buffer_count);
+            for (std::size_t slot = 0; slot < buffer_count; slot++) {
+                vectors[slot].iov_base = buffer(slot);
+                vectors[slot].iov_len = options.chunk_size;
+            }
+            fixed_buffers = buffer_count <= 1024 && ring->register_buffers(vectors.data(), static_cast<unsigned>(buffer_count));
+        }
+#endif
+    }
+
+    /**
+     * @brief Returns whether the reads are submitted to io_uring rather than read one at a time
+    */
+    bool uses_io_uring() const {
+#ifdef BOOST_ASTRONOMY_IO_HAS_IO_URING
+        return ring != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Returns the file read by the queue
+    */
+    const positional_file& get_file() const { return file; }
+
+    /**
+     * @brief Returns the options in use ( after replacing invalid values )
+    */
+    const uring_options& get_options() const { return options; }
+
+    /**
+     * @brief Queues a read of size bytes starting at offset
+     * @param[in] offset Offset of the first byte in the file
+     * @param[in] size Number of bytes to be read
+     * @param[in] tag Value reported with every chunk of this read
+    */
+    void enqueue(std::size_t offset, std::size_t size, std::size_t tag = 0) {
+        for (std::size_t position = 0; position < size; position += options.chunk_size) {
+            std::size_t chunk = size - position < options.chunk_size ? size - position : options.chunk_size;
+            pending.push_back(chunk_request{ tag, position, offset + position, chunk });
+        }
+    }
+
+    /**
+     * @brief Returns the number of chunks queued or in flight
+    */
+    std::size_t outstanding() const { return pending.size() + in_flight; }
+
+    /**
+     * @brief Submits queued chunks, waits for at least one to complete and passes the completed ones to handler
+     * @param[in] handler Function called with a read_completion for every chunk completed
+     * @return Number of chunks completed ( 0 if nothing was outstanding )
+     * @throws file_reading_exception If a read fails
+    */
+    template<typename Handler>
+    std::size_t poll(Handler&& handler) {
+        if (outstanding() == 0) { return 0; }
+#ifdef BOOST_ASTRONOMY_IO_HAS_IO_URING
+        if (ring) { return poll_ring(handler); }
+#endif
+        chunk_request chunk = pending.front();
+        pending.pop_front();
+        std::size_t bytes_read = file.read_at(chunk.offset, buffer(0), chunk.size);
+        handler(read_completion{ chunk.tag, chunk.position, buffer(0), bytes_read });
+        return 1;
+    }
+
+    /**
+     * @brief Completes every queued read, passing each chunk to handler as it lands
+     * @param[in] handler Function called with a read_completion for every chunk
+    */
+    template<typename Handler>
+    void drain(Handler&& handler) {
+        while (outstanding() != 0) { poll(handler); }
+    }
+
+    /**
+     * @brief Reads size bytes at offset into destination using the queue, waiting for all of its chunks
+     * @return Number of bytes read ( less than size only at the end of file )
+     * @throws file_reading_exception If reads queued earlier are not completed or a read fails
+    */
+    std::size_t read(std::size_t offset, char* destination, std::size_t size) {
+        if (outstanding() != 0) {
+            throw file_reading_exception("Queued reads must be completed before a blocking read");
+        }
+        std::size_t total_read = 0;
+        enqueue(offset, size);
+        drain([destination, &total_read](const read_completion& completion) {
+            std::memcpy(destination + completion.position, completion.data, completion.size);
+            total_read += completion.size;
+        });
+        return total_read;
+    }
+
+private:
+    char* buffer(std::size_t slot) const { return storage.get() + slot * options.chunk_size; }
+
+#ifdef BOOST_ASTRONOMY_IO_HAS_IO_URING
+    /**
+     * @brief Queues the rest of the chunk held in slot ( all of it for a new chunk )
+    */
+    void queue_slot(unsigned slot) {
+        buffer_slot& held = slots[slot];
+        ring->queue_read(file.native_handle(), held.chunk.offset + held.bytes_read, buffer(slot) + held.bytes_read,
+            static_cast<unsigned>(held.chunk.size - held.bytes_read), fixed_buffers ? static_cast<int>(slot) : -1,
+            slot, vectors[slot]);
+    }
+
+    template<typename Handler>
+    std::size_t poll_ring(Handler& handler) {
+        while (!pending.empty() && !free_slots.empty()) {
+            unsigned slot = free_slots.back();
+            free_slots.pop_back();
+            slots[slot] = buffer_slot{ pending.front(), 0 };
+            pending.pop_front();
+            in_flight++;
+            queue_slot(slot);
+        }
+
+        std::vector<unsigned> completed;
+        bool failed = false;
+        std::chrono::microseconds backoff(0);
+        while (completed.empty() && !failed) {
+            // A busy kernel waits for the completion queue to be drained, which the loop does before submitting again
+            long submitted = ring->submit_and_wait(1);
+            if (submitted < 0 && submitted != -EBUSY && submitted != -EAGAIN) {
+                throw file_reading_exception("Cannot submit reads to io_uring");
+            }
+            bool progress = false;
+            ring->for_each_completion([&](std::uint64_t user_data, int result) {
+                unsigned slot = static_cast<unsigned>(user_data);
+                buffer_slot& held = slots[slot];
+                if (result == -EINTR || result == -EAGAIN) { queue_slot(slot); return; }
+                progress = true;
+                if (result < 0) { failed = true; }
+                else { held.bytes_read += static_cast<std::size_t>(result); }
+
+                // Short reads continue where they stopped, a read of 0 bytes is the end of file
+                if (result > 0 && held.bytes_read < held.chunk.size) { queue_slot(slot); return; }
+                completed.push_back(slot);
+            });
+
+            // Without a single read landing the kernel is short of resources, retrying at once would only spin
+            if (progress) { backoff = std::chrono::microseconds(0); }
+            else {
+                backoff = backoff.count() == 0 ? std::chrono::microseconds(16) :
+                    std::min(2 * backoff, std::chrono::microseconds(4096));
+                std::this_thread::sleep_for(backoff);
+            }
+        }
+
+        for (unsigned slot : completed) {
+            free_slots.push_back(slot);
+            in_flight--;
+        }
+        if (failed) { throw file_reading_exception("Cannot read from file"); }
+
+        for (unsigned slot : completed) {
+            const buffer_slot& held = slots[slot];
+            handler(read_completion{ held.chunk.tag, held.chunk.position, buffer(slot), held.bytes_read });
+        }
+        return completed.size();
+    }
+#endif
+};
+
+/**
+ * @brief   FileReader for fits_io reading the large data units through a uring_read_queue
+ * @details Behaves as fits_stream, except that reads of at least uring_options::queued_read_size bytes are split
+ *          in chunks and read at the queue depth of the options, which keeps a fast device busy from a single thread.
+ *          The queue and its buffers are created by the first such read, so files without large data units never
+ *          set up a ring
+*/
+struct uring_stream :public fits_stream {
+private:
+    uring_options options;
+    std::string file_path;
+    std::unique_ptr<uring_read_queue> queue;
+    bool opened_for_update = false;
+
+public:
+    /**
+     * @brief Creates a stream reading with the given options
+    */
+    explicit uring_stream(uring_options stream_options = uring_options()) :options(stream_options) {}
+
+    /**
+     * @brief Sets the file on which reading operations will take place
+     * @param[in] path Location of the file
+     * @throw file_reading_exception
+    */
+    void set_file(const std::string& path) {
+        fits_stream::set_file(path);
+        file_path = path;
+        queue.reset();
+        opened_for_update = false;
+    }
+
+    /**
+     * @brief Opens an existing file for both reading and writing without truncating it
+     * @param[in] path Location of the file
+     * @throw file_reading_exception
+    */
+    void set_file_for_update(const std::string& path) {
+        fits_stream::set_file_for_update(path);
+        file_path = path;
+        queue.reset();
+        opened_for_update = true;
+    }
+
+    /**
+     * @brief Creates an empty file for reading/writing in the path specified ( reads are not queued )
+     * @param[in] path The path where the file needs to be created
+    */
+    bool create_file(const std::string& path) {
+        file_path.clear();
+        queue.reset();
+        return fits_stream::create_file(path);
+    }
+
+    /**
+     * @brief Returns whether the large reads are submitted to io_uring ( false until the first large read )
+    */
+    bool uses_io_uring() const { return queue && queue->uses_io_uring(); }
+
+    /**
+     * @brief Reads num_bytes from the file from current position as a string
+     * @param[in] num_bytes Amount of data to be read in bytes
+    */
+    std::string read(std::size_t num_bytes) {
+        if (file_path.empty() || num_bytes < options.queued_read_size) { return fits_stream::read(num_bytes); }
+        if (!queue) { queue.reset(new uring_read_queue(file_path, options)); }
+
+        // Pending writes of the stream must reach the file before it is read through the queue
+        if (opened_for_update) { fits_stream::flush(); }
+        std::size_t position = get_current_pos();
+        std::string data(num_bytes, ' ');
+        std::size_t bytes_read = queue->read(position, &data[0], num_bytes);
+        set_reading_pos(position + bytes_read);
+        return data;
+    }
+
+    /**
+     * @brief Closes the file if opened
+    */
+    void close() {
+        file_path.clear();
+        queue.reset();
+        fits_stream::close();
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_URING_READER_HPP
@@ -0,0 +1,82 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#ifndef BOOST_ASTRONOMY_TEST_IO_SKY_FIXTURE_HPP
+#define BOOST_ASTRONOMY_TEST_IO_SKY_FIXTURE_HPP
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/image.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace fits_test {
+
+using namespace boost::astronomy::io;
+
+/**
+ * @brief Synthetic sky images shared by the tests of the image statistics ( histograms, clipping and stacking )
+*/
+class sky_fixture {
+public:
+    std::mt19937 generator;
+
+    explicit sky_fixture(std::mt19937::result_type seed) : generator(seed) {}
+
+    /**
+     * @brief   Creates an image of normally distributed pixels with bright and dark outliers
+     * @details Every 101st pixel is 40 sigma brighter and every 257th 15 sigma darker than the background, counting
+     *          from shift so that frames of a stack do not share their outliers. Integer pixels are clamped to the
+     *          range of their type
+    */
+    template<typename PixelType>
+    image_buffer<PixelType> make_sky(std::size_t width, std::size_t height, double background, double noise,
+        std::size_t shift = 0) {
+        std::normal_distribution<double> sky(background, noise);
+        image_buffer<PixelType> image(width, height);
+        for (std::size_t i = 0; i < image.size(); i++) {
+            double value = sky(generator);
+            if ((i + shift) % 101 == 0) { value += 40 * noise; }
+            if ((i + shift) % 257 == 0) { value -= 15 * noise; }
+            if (std::is_integral<PixelType>::value) {
+                value = std::min(std::max(value, static_cast<double>(std::numeric_limits<PixelType>::lowest())),
+                    static_cast<double>(std::numeric_limits<PixelType>::max()));
+            }
+            image.data()[i] = static_cast<PixelType>(value);
+        }
+        return image;
+    }
+
+    /**
+     * @brief Finite pixels of an image in ascending order
+    */
+    template<typename PixelType>
+    static std::vector<double> sorted_values(const image_buffer<PixelType>& image) {
+        std::vector<double> values;
+        for (std::size_t i = 0; i < image.size(); i++) {
+            double value = static_cast<double>(image.data()[i]);
+            if (std::isfinite(value)) { values.push_back(value); }
+        }
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+
+    /**
+     * @brief Requires a value to match the expected one up to a relative error ( absolute below 1 )
+    */
+    static void check_close(double value, double expected, double tolerance = 1e-9) {
+        BOOST_REQUIRE_SMALL(value - expected, tolerance * std::max(1.0, std::fabs(expected)));
+    }
+};
+
+} //namespace fits_test
+
+#endif // !BOOST_ASTRONOMY_TEST_IO_SKY_FIXTURE_HPP
@@ -0,0 +1,181 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE arrow_writer_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/integer.hpp>
+#include <boost/astronomy/io/arrow_writer.hpp>
+#include <boost/astronomy/io/binary_table_writer.hpp>
+#include <boost/astronomy/io/binary_data_converter.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <boost/astronomy/io/string_conversion_utility.hpp>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdio.h>
+#include "base_fixture.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    typedef basic_binary_table_extension<card_policy, binary_data_converter> binary_table_type;
+
+    class arrow_writer_fixture :public base_fixture<fits_stream, card_policy> {
+    public:
+        std::string table_path;
+        std::string arrow_path;
+        header<card_policy> table_header;
+        std::string table_data;
+
+        /**
+         * @brief Writes a table of 10 rows ( ID J with TNULL -1, FLUX E, NAME 8A ) and reads it back
+        */
+        arrow_writer_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+            table_path = samples_directory + "arrow_source.fits";
+            arrow_path = samples_directory + "arrow_output.arrow";
+
+            std::vector<column> columns = { column("J"), column("E"), column("8A") };
+            columns[0].TTYPE("ID");
+            columns[1].TTYPE("FLUX");
+            columns[2].TTYPE("NAME");
+            {
+                binary_table_writer writer(table_path, columns, "CATALOG");
+                for (std::int32_t row = 0; row < 10; row++) {
+                    writer.write_row(row % 3 == 0 ? -1 : row, static_cast<float>(row) * 0.5f, "S" + std::to_string(row));
+                }
+            }
+
+            fits_stream file;
+            file.set_file(table_path);
+            file.set_reading_pos(2880);
+            table_header.read_header(file);
+            card<card_policy> tnull;
+            tnull.create_card("TNULL1", -1);
+            table_header.add_card(tnull);
+            table_data = file.read(table_header.naxis(1) * 10);
+        }
+
+        ~arrow_writer_fixture() {
+            remove(table_path.c_str());
+            remove(arrow_path.c_str());
+        }
+
+        std::string read_output() const {
+            std::ifstream in(arrow_path, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+
+        template<typename T>
+        static T read_little_endian(std::string const& data, std::size_t position) {
+            typename boost::uint_t<8 * sizeof(T)>::exact bits;
+            std::memcpy(&bits, data.data() + position, sizeof(T));
+            boost::endian::little_to_native_inplace(bits);
+            T value;
+            std::memcpy(&value, &bits, sizeof(T));
+            return value;
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(arrow_writer_tests)
+
+BOOST_FIXTURE_TEST_CASE(plan_binary_table_columns, fits_test::arrow_writer_fixture) {
+    fits_test::binary_table_type table(table_header, table_data);
+    std::vector<arrow_column> columns = make_arrow_columns(table);
+
+    BOOST_REQUIRE_EQUAL(columns.size(), 3u);
+    BOOST_REQUIRE_EQUAL(columns[0].name, "ID");
+    BOOST_REQUIRE(columns[0].has_null);
+    BOOST_REQUIRE_EQUAL(columns[0].null_value, -1);
+    BOOST_REQUIRE_EQUAL(columns[2].offset, 8u);
+    BOOST_REQUIRE(columns[2].types.back().kind == arrow_type::utf8);
+
+    column vector_column("3C");
+    vector_column.TBCOL(0);
+    arrow_column complex_vector = detail::make_binary_arrow_column(vector_column);
+    BOOST_REQUIRE_EQUAL(complex_vector.types.size(), 3u);
+    BOOST_REQUIRE_EQUAL(complex_vector.types[0].width, 3);
+    BOOST_REQUIRE_EQUAL(complex_vector.types[1].width, 2);
+    BOOST_REQUIRE_EQUAL(complex_vector.types[2].bit_width, 32);
+    BOOST_REQUIRE_EQUAL(complex_vector.elements, 6u);
+
+    column variable_length("1PE(100)");
+    variable_length.TBCOL(0);
+    BOOST_REQUIRE_THROW(detail::make_binary_arrow_column(variable_length), boost::astronomy::invalid_table_colum_format);
+}
+
+BOOST_FIXTURE_TEST_CASE(write_stream_record_batches, fits_test::arrow_writer_fixture) {
+    fits_test::binary_table_type table(table_header, table_data);
+    write_arrow(table, table_data, arrow_path, arrow_format::stream, 4);
+    std::string output = read_output();
+
+    // Schema message followed by the first record batch
+    BOOST_REQUIRE_EQUAL(read_little_endian<std::uint32_t>(output, 0), 0xFFFFFFFFu);
+    std::size_t schema_size = read_little_endian<std::int32_t>(output, 4);
+    BOOST_REQUIRE_EQUAL(schema_size % 8, 0u);
+
+    std::size_t batch_start = 8 + schema_size;
+    BOOST_REQUIRE_EQUAL(read_little_endian<std::uint32_t>(output, batch_start), 0xFFFFFFFFu);
+    std::size_t body = batch_start + 8 + read_little_endian<std::int32_t>(output, batch_start + 4);
+
+    // ID: validity bitmap ( row 0 and 3 are TNULL ) and values, FLUX: values, NAME: offsets and characters
+    BOOST_REQUIRE_EQUAL(static_cast<unsigned char>(output[body]), 0x06u);
+    BOOST_REQUIRE_EQUAL(read_little_endian<std::int32_t>(output, body + 8 + 4), 1);
+    BOOST_REQUIRE_EQUAL(read_little_endian<float>(output, body + 24 + 8), 1.0f);
+    BOOST_REQUIRE_EQUAL(read_little_endian<std::int32_t>(output, body + 40 + 16), 8);
+    BOOST_REQUIRE_EQUAL(output.substr(body + 64, 8), "S0S1S2S3");
+
+    // End of stream marker
+    BOOST_REQUIRE_EQUAL(output.substr(output.size() - 8), std::string("\xFF\xFF\xFF\xFF\0\0\0\0", 8));
+}
+
+BOOST_FIXTURE_TEST_CASE(write_file_from_fits_stream, fits_test::arrow_writer_fixture) {
+    fits_test::binary_table_type table(table_header, "");
+    fits_stream file;
+    file.set_file(table_path);
+    write_arrow(table, file, 2880 + table_header.raw_records().size(), arrow_path, arrow_format::file, 3);
+
+    std::string output = read_output();
+    BOOST_REQUIRE_EQUAL(output.substr(0, 8), std::string("ARROW1\0\0", 8));
+    BOOST_REQUIRE_EQUAL(output.substr(output.size() - 6), "ARROW1");
+
+    std::size_t footer_size = read_little_endian<std::int32_t>(output, output.size() - 10);
+    std::size_t footer_start = output.size() - 10 - footer_size;
+    BOOST_REQUIRE_EQUAL(footer_start % 8, 0u);
+    BOOST_REQUIRE_EQUAL(output.substr(footer_start - 8, 8), std::string("\xFF\xFF\xFF\xFF\0\0\0\0", 8));
+
+    BOOST_REQUIRE_THROW(write_arrow(table, table_data.substr(0, 20), arrow_path), boost::astronomy::file_reading_exception);
+}
+
+BOOST_FIXTURE_TEST_CASE(write_ascii_table, fits_test::arrow_writer_fixture) {
+    load_file("fits_sample1.fits");
+    fits_test::hdu_store<card_policy>* raw_ascii = get_raw_hdu("fits_sample1", "TABLE");
+    BOOST_REQUIRE(raw_ascii != nullptr);
+    basic_ascii_table<card_policy, ascii_converter> table(raw_ascii->hdu_header, raw_ascii->hdu_data_buffer);
+
+    std::vector<arrow_column> columns = make_arrow_columns(table);
+    BOOST_REQUIRE_EQUAL(columns[0].name, "CRVAL1");
+    BOOST_REQUIRE_EQUAL(columns[0].offset, 0u);
+    BOOST_REQUIRE(columns[0].types.back().kind == arrow_type::floating_point);
+
+    write_arrow(table, raw_ascii->hdu_data_buffer, arrow_path);
+    std::string output = read_output();
+    BOOST_REQUIRE_EQUAL(output.substr(output.size() - 6), "ARROW1");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
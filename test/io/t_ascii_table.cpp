@@ -85,6 +85,18 @@ BOOST_FIXTURE_TEST_CASE(ascii_table_get_column,fits_test::ascii_table_fixture) {
 }
 
 
+BOOST_FIXTURE_TEST_CASE(ascii_table_get_column_by_id, fits_test::ascii_table_fixture) {
+    boost::float32_t backgrnd_col_data[] = { -0.367635f, 0.210143f, 0.476156f, 0.346646f };
+
+    column_id backgrnd = ascii_hdu1.get_column_id("BACKGRND");
+    BOOST_REQUIRE_EQUAL(ascii_hdu1.get_column_metadata(backgrnd).TTYPE(), "BACKGRND");
+
+    auto& backgrnd_col = ascii_hdu1.get_column<boost::float32_t>(backgrnd);
+    BOOST_REQUIRE_EQUAL(&backgrnd_col, &ascii_hdu1.get_column<boost::float32_t>("BACKGRND"));
+    for (int i = 0; i < 4; i++)
+    BOOST_REQUIRE_CLOSE(static_cast<float>(backgrnd_col[i]), backgrnd_col_data[i], 0.001);
+}
+
 BOOST_FIXTURE_TEST_CASE(ascii_table_invalid_column_name, fits_test::ascii_table_fixture) {
 
     BOOST_REQUIRE_THROW(ascii_hdu1.get_column<boost::float32_t>("GARBAGE"),boost::astronomy::column_not_found_exception);  
@@ -66,11 +66,35 @@ BOOST_FIXTURE_TEST_CASE(binary_table_set_data, fits_test::binary_table_fixture)
     BOOST_REQUIRE_CLOSE(row1_dat[119], 595.0, 0.001);
 }
 
+BOOST_FIXTURE_TEST_CASE(binary_table_column_id, fits_test::binary_table_fixture) {
+    column_id del_time = binary_table1.get_column_id("DEL_TIME");
+    BOOST_REQUIRE_EQUAL(del_time.position(), 4u);
+    BOOST_REQUIRE_EQUAL(binary_table1.get_column_metadata(del_time).TTYPE(), "DEL_TIME");
+
+    auto& by_id = binary_table1.get_column<std::vector<boost::float32_t>>(del_time);
+    auto& by_name = binary_table1.get_column<std::vector<boost::float32_t>>("DEL_TIME");
+    BOOST_REQUIRE_EQUAL(&by_id, &by_name);
+
+    std::vector<boost::float32_t> row1_dat = by_id[0];
+    BOOST_REQUIRE_CLOSE(row1_dat[119], 595.0, 0.001);
+
+    BOOST_REQUIRE_THROW(binary_table1.get_column_id("GARBAGE"), boost::astronomy::column_not_found_exception);
+    BOOST_REQUIRE_THROW(binary_table1.get_column_metadata(column_id(100)), std::out_of_range);
+}
+
 BOOST_AUTO_TEST_CASE(binary_table_check_column_size) {
     auto col_size = basic_binary_table_extension<card_policy, binary_data_converter>::column_size("144000I");
     BOOST_REQUIRE_EQUAL(col_size, 288000);
 }
 
+BOOST_AUTO_TEST_CASE(binary_table_check_bit_column_size) {
+    typedef basic_binary_table_extension<card_policy, binary_data_converter> binary_table_type;
+    BOOST_REQUIRE_EQUAL(binary_table_type::column_size("X"), 1u);
+    BOOST_REQUIRE_EQUAL(binary_table_type::column_size("16X"), 2u);
+    BOOST_REQUIRE_EQUAL(binary_table_type::column_size("17X"), 3u);
+    BOOST_REQUIRE_EQUAL(binary_table_type::column_size("2K"), 16u);
+}
+
 BOOST_FIXTURE_TEST_CASE(binary_table_get_column, fits_test::binary_table_fixture) {
     auto column_info =binary_table1.get_column<std::vector<boost::float32_t>>("DEL_TIME");
     std::vector<boost::float32_t> row1_dat = column_info[0];
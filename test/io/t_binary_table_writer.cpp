@@ -0,0 +1,184 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE binary_table_writer_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/binary_table_writer.hpp>
+#include <boost/astronomy/io/table_schema.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <cstdint>
+#include <stdio.h>
+#include "base_fixture.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    BOOST_ASTRONOMY_TABLE_COLUMN(id_col, "ID", std::int32_t);
+    BOOST_ASTRONOMY_TABLE_COLUMN(flux_col, "FLUX", float);
+    BOOST_ASTRONOMY_TABLE_COLUMN(position_col, "POSITION", std::array<double, 3>);
+    BOOST_ASTRONOMY_TABLE_COLUMN(name_col, "NAME", std::string);
+    BOOST_ASTRONOMY_TABLE_COLUMN(flag_col, "FLAG", bool);
+    BOOST_ASTRONOMY_TABLE_COLUMN(big_col, "BIG", std::int64_t);
+    BOOST_ASTRONOMY_TABLE_COLUMN(phase_col, "PHASE", std::complex<float>);
+
+    typedef typed_binary_table<table_schema<id_col, flux_col, position_col, name_col, flag_col, big_col, phase_col>> catalog_table;
+
+    class binary_table_writer_fixture :public base_fixture<fits_stream, card_policy> {
+    public:
+        std::vector<column> columns;
+        std::string table_path;
+
+        binary_table_writer_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+            table_path = samples_directory + "written_table.fits";
+            add_column("ID", "J");
+            add_column("FLUX", "E");
+            add_column("POSITION", "3D");
+            add_column("NAME", "8A");
+            add_column("FLAG", "L");
+            add_column("BIG", "K");
+            add_column("PHASE", "C");
+        }
+
+        ~binary_table_writer_fixture() {
+            remove(table_path.c_str());
+        }
+
+        void add_column(const std::string& name, const std::string& form) {
+            column col(form);
+            col.TTYPE(name);
+            columns.push_back(col);
+        }
+
+        /**
+         * @brief Reads the header of the HDU at given position in the file and returns the location of its data
+        */
+        std::size_t read_hdu_header(fits_stream& file, std::size_t hdu_index, header<card_policy>& hdu_header) {
+            std::size_t location = 0;
+            for (std::size_t index = 0; ; index++) {
+                file.set_reading_pos(location);
+                hdu_header.read_header(file);
+                location += hdu_header.raw_records().size();
+                if (index == hdu_index) { return location; }
+                location += (hdu_header.data_unit_size() + 2879) / 2880 * 2880;
+            }
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(binary_table_writer_tests)
+
+BOOST_FIXTURE_TEST_CASE(write_rows_and_column_batches, fits_test::binary_table_writer_fixture) {
+    using namespace fits_test;
+    {
+        binary_table_writer writer(table_path, columns, "CATALOG", false, 4);
+        BOOST_REQUIRE_EQUAL(writer.width(), 4u + 4u + 24u + 8u + 1u + 8u + 8u);
+
+        for (std::int32_t row = 0; row < 10; row++) {
+            writer.write_row(row, static_cast<float>(row) * 0.5f,
+                std::array<double, 3>{ { row * 1.0, row * 2.0, row * 3.0 } }, std::string("SRC") + std::to_string(row),
+                row % 2 == 0, static_cast<std::int64_t>(row) << 40, std::complex<float>(static_cast<float>(row), -static_cast<float>(row)));
+        }
+
+        std::vector<std::int32_t> ids;
+        std::vector<float> fluxes;
+        std::vector<double> positions;
+        std::string names;
+        bool flag_values[20];
+        std::vector<std::int64_t> bigs;
+        std::vector<std::complex<float>> phases;
+        for (std::int32_t row = 10; row < 30; row++) {
+            ids.push_back(row);
+            fluxes.push_back(static_cast<float>(row) * 0.5f);
+            for (int i = 1; i <= 3; i++) { positions.push_back(row * static_cast<double>(i)); }
+            std::string name = "SRC" + std::to_string(row);
+            names += name + std::string(8 - name.size(), ' ');
+            flag_values[row - 10] = row % 2 == 0;
+            bigs.push_back(static_cast<std::int64_t>(row) << 40);
+            phases.emplace_back(static_cast<float>(row), -static_cast<float>(row));
+        }
+        writer.write_columns(20, ids.data(), fluxes.data(), positions.data(), names.data(),
+            static_cast<const bool*>(flag_values), bigs.data(), phases.data());
+        BOOST_REQUIRE_EQUAL(writer.total_rows(), 30u);
+    }
+
+    fits_stream file;
+    file.set_file(table_path);
+    BOOST_REQUIRE_EQUAL(file.file_size() % 2880, 0u);
+
+    header<card_policy> table_header;
+    std::size_t data_location = read_hdu_header(file, 1, table_header);
+    BOOST_REQUIRE_EQUAL(table_header.naxis(2), 30u);
+    BOOST_REQUIRE_EQUAL(table_header.value_of<std::string>("EXTNAME"), "CATALOG");
+
+    file.set_reading_pos(data_location);
+    catalog_table table(table_header, file.read(table_header.naxis(1) * 30));
+    for (std::size_t row = 0; row < 30; row++) {
+        BOOST_REQUIRE_EQUAL(table.get<id_col>(row), static_cast<std::int32_t>(row));
+        BOOST_REQUIRE_EQUAL(table.get<flux_col>(row), static_cast<float>(row) * 0.5f);
+        BOOST_REQUIRE_EQUAL(table.get<position_col>(row)[2], static_cast<double>(row) * 3.0);
+        BOOST_REQUIRE_EQUAL(table.get<name_col>(row), "SRC" + std::to_string(row));
+        BOOST_REQUIRE_EQUAL(table.get<flag_col>(row), row % 2 == 0);
+        BOOST_REQUIRE_EQUAL(table.get<big_col>(row), static_cast<std::int64_t>(row) << 40);
+        BOOST_REQUIRE_EQUAL(table.get<phase_col>(row).imag(), -static_cast<float>(row));
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(values_must_match_column_formats, fits_test::binary_table_writer_fixture) {
+    binary_table_writer writer(table_path, columns);
+
+    BOOST_REQUIRE_THROW(writer.write_row(1, 2.0f), boost::astronomy::column_exception);
+    BOOST_REQUIRE_THROW(writer.write_row(1.0, 2.0f, std::array<double, 3>(), std::string(), true,
+        std::int64_t(0), std::complex<float>()), boost::astronomy::invalid_table_colum_format);
+    BOOST_REQUIRE_THROW(writer.write_row(1, 2.0f, std::array<double, 2>(), std::string(), true,
+        std::int64_t(0), std::complex<float>()), boost::astronomy::invalid_table_colum_format);
+    BOOST_REQUIRE_EQUAL(writer.total_rows(), 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(append_table_to_existing_file, fits_test::binary_table_writer_fixture) {
+    {
+        binary_table_writer writer(table_path, columns, "FIRST");
+        for (int row = 0; row < 5; row++) {
+            writer.write_row(row, 0.0f, std::array<double, 3>(), std::string("A"), true,
+                std::int64_t(0), std::complex<float>());
+        }
+    }
+    {
+        std::vector<column> id_only(1, columns[0]);
+        binary_table_writer writer(table_path, id_only, "SECOND", true);
+        std::int32_t ids[] = { 7, 8, 9 };
+        writer.write_columns(3, static_cast<const std::int32_t*>(ids));
+    }
+
+    fits_stream file;
+    file.set_file(table_path);
+
+    header<card_policy> first_header;
+    read_hdu_header(file, 1, first_header);
+    BOOST_REQUIRE_EQUAL(first_header.naxis(2), 5u);
+
+    header<card_policy> second_header;
+    std::size_t data_location = read_hdu_header(file, 2, second_header);
+    BOOST_REQUIRE_EQUAL(second_header.value_of<std::string>("EXTNAME"), "SECOND");
+    BOOST_REQUIRE_EQUAL(second_header.naxis(2), 3u);
+    BOOST_REQUIRE_EQUAL(data_location + 2880, file.file_size());
+
+    file.set_reading_pos(data_location);
+    std::string data = file.read(12);
+    BOOST_REQUIRE_EQUAL(data[11], 9);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,146 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE bit_column_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/bit_column.hpp>
+#include <boost/astronomy/io/binary_data_converter.hpp>
+#include <boost/astronomy/io/fits_generator.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <cstdint>
+#include <stdio.h>
+#include "base_fixture.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    typedef basic_binary_table_extension<card_policy, binary_data_converter> binary_table_type;
+
+    class bit_column_fixture :public base_fixture<fits_stream, card_policy> {
+        std::string sample_path;
+    public:
+        hdu_store<card_policy>* raw_table;
+
+        bit_column_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+            sample_path = samples_directory + "bit_column_sample.fits";
+            {
+                boost::astronomy::io::fits_generator generator(sample_path, 9);
+                generator.write_binary_table(150, { "J", "13X", "3L", "X" }, "FLAGS");
+                generator.close();
+            }
+            load_file("bit_column_sample.fits");
+            raw_table = get_raw_hdu("bit_column_sample", "BINTABLE");
+        }
+
+        ~bit_column_fixture() {
+            remove(sample_path.c_str());
+        }
+
+        /**
+         * @brief Returns a bit of the 13X field of the row straight from the data unit
+        */
+        bool raw_flag(std::size_t row, std::size_t bit) const {
+            unsigned char byte = static_cast<unsigned char>(raw_table->hdu_data_buffer[row * 10 + 4 + bit / 8]);
+            return (byte >> (7 - bit % 8)) & 1;
+        }
+
+        /**
+         * @brief Returns an element of the 3L field of the row straight from the data unit
+        */
+        bool raw_logical(std::size_t row, std::size_t element) const {
+            return raw_table->hdu_data_buffer[row * 10 + 6 + element] == 'T';
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(bit_columns)
+
+BOOST_FIXTURE_TEST_CASE(bit_arrays_are_packed_in_the_row, fits_test::bit_column_fixture) {
+    fits_test::binary_table_type table(raw_table->hdu_header, raw_table->hdu_data_buffer);
+
+    BOOST_REQUIRE_EQUAL(table.get_column_metadata("COL2").TBCOL(), 4u);
+    BOOST_REQUIRE_EQUAL(table.get_column_metadata("COL3").TBCOL(), 6u);
+    BOOST_REQUIRE_EQUAL(table.get_column_metadata("COL4").TBCOL(), 9u);
+    BOOST_REQUIRE_EQUAL(table.get_data()[0][1].size(), 2u);
+    BOOST_REQUIRE_EQUAL(table.get_data()[149][2], raw_table->hdu_data_buffer.substr(149 * 10 + 6, 3));
+}
+
+BOOST_FIXTURE_TEST_CASE(read_bit_column_kernels, fits_test::bit_column_fixture) {
+    fits_test::binary_table_type table(raw_table->hdu_header, raw_table->hdu_data_buffer);
+    bit_column flags = read_bit_column(table, raw_table->hdu_data_buffer, table.get_column_id("COL2"));
+
+    BOOST_REQUIRE_EQUAL(flags.rows(), 150u);
+    BOOST_REQUIRE_EQUAL(flags.bits(), 13u);
+    BOOST_REQUIRE_EQUAL(flags.field_width(), 2u);
+
+    std::vector<std::uint8_t> unpacked = flags.unpack();
+    std::size_t total = 0;
+    for (std::size_t row = 0; row < 150; row++) {
+        std::size_t row_total = 0;
+        for (std::size_t bit = 0; bit < 13; bit++) {
+            BOOST_REQUIRE_EQUAL(flags.test(row, bit), raw_flag(row, bit));
+            BOOST_REQUIRE_EQUAL(unpacked[row * 13 + bit], raw_flag(row, bit) ? 1 : 0);
+            row_total += raw_flag(row, bit) ? 1 : 0;
+        }
+        // The 3 unused bits of the last byte are not counted
+        BOOST_REQUIRE_EQUAL(flags.popcount(row), row_total);
+        total += row_total;
+    }
+    BOOST_REQUIRE_EQUAL(flags.count(), total);
+
+    row_mask bit_3 = flags.mask(3);
+    row_mask bit_12 = flags.mask(12);
+    row_mask either = flags.any_of({ 3, 12 });
+    row_mask both = flags.all_of({ 3, 12 });
+    BOOST_REQUIRE(either == (bit_3 | bit_12));
+    BOOST_REQUIRE(both == (bit_3 & bit_12));
+    BOOST_REQUIRE_EQUAL((~either).count(), 150u - either.count());
+
+    for (std::size_t row = 0; row < 150; row++) {
+        BOOST_REQUIRE_EQUAL(bit_12.test(row), raw_flag(row, 12));
+        BOOST_REQUIRE_EQUAL(both.test(row), raw_flag(row, 3) && raw_flag(row, 12));
+    }
+    for (std::size_t row : both.selected_rows()) {
+        BOOST_REQUIRE(raw_flag(row, 3) && raw_flag(row, 12));
+    }
+    BOOST_REQUIRE_THROW(flags.mask(0) & row_mask(10), std::invalid_argument);
+    BOOST_REQUIRE_THROW(flags.any_of({ 13 }), std::out_of_range);
+    BOOST_REQUIRE_THROW(flags.mask(13), std::out_of_range);
+}
+
+BOOST_FIXTURE_TEST_CASE(decode_logical_columns, fits_test::bit_column_fixture) {
+    fits_test::binary_table_type table(raw_table->hdu_header, raw_table->hdu_data_buffer);
+    column_id logical_column = table.get_column_id("COL3");
+
+    std::vector<std::uint8_t> values = decode_logical(table, raw_table->hdu_data_buffer, logical_column);
+    row_mask second = logical_mask(table, raw_table->hdu_data_buffer, logical_column, 1);
+    BOOST_REQUIRE_EQUAL(values.size(), 450u);
+    for (std::size_t row = 0; row < 150; row++) {
+        for (std::size_t element = 0; element < 3; element++) {
+            BOOST_REQUIRE_EQUAL(values[row * 3 + element], raw_logical(row, element) ? 1 : 0);
+        }
+        BOOST_REQUIRE_EQUAL(second.test(row), raw_logical(row, 1));
+    }
+
+    BOOST_REQUIRE_THROW(logical_mask(table, raw_table->hdu_data_buffer, logical_column, 3), std::out_of_range);
+    BOOST_REQUIRE_THROW(decode_logical(table, raw_table->hdu_data_buffer, table.get_column_id("COL2")),
+        boost::astronomy::invalid_table_colum_format);
+    BOOST_REQUIRE_THROW(read_bit_column(table, raw_table->hdu_data_buffer, logical_column),
+        boost::astronomy::invalid_table_colum_format);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
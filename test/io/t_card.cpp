@@ -298,5 +298,22 @@ BOOST_AUTO_TEST_CASE(card_setvalue) {
     BOOST_REQUIRE_CLOSE(test_card. template value<double>(), 45.6, 0.001);
 }
 
+BOOST_AUTO_TEST_CASE(card_value_in_different_types) {
+    card<card_policy> test_card(get_card("integer_card").raw_form);
+
+    BOOST_REQUIRE_EQUAL(test_card.value<int>(), 2112);
+    BOOST_REQUIRE_EQUAL(test_card.value<std::size_t>(), 2112u);
+    BOOST_REQUIRE_CLOSE(test_card.value<double>(), 2112.0, 0.001);
+    BOOST_REQUIRE_EQUAL(test_card.value<std::string>(), "2112");
+}
+
+BOOST_AUTO_TEST_CASE(card_storage_is_fixed_width) {
+    BOOST_REQUIRE_EQUAL(sizeof(card<card_policy>), 80u);
+
+    card<card_policy> end_card("END");
+    BOOST_REQUIRE_EQUAL(end_card.raw_card(), "END" + std::string(77, ' '));
+    BOOST_REQUIRE_EQUAL(end_card.keyword(true), "END     ");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
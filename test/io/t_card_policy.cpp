@@ -112,6 +112,22 @@ BOOST_FIXTURE_TEST_CASE(serialize_longlong, cardpolicy_fixture) {
     BOOST_REQUIRE_EQUAL(policy.serialize_to_fits_format(1234343423222343421)," 1234343423222343421");
 }
 
+BOOST_FIXTURE_TEST_CASE(serialize_double_shortest_round_trip, cardpolicy_fixture) {
+
+    BOOST_REQUIRE_EQUAL(policy.serialize_to_fits_format(0.1), std::string(17, ' ') + "0.1");
+    BOOST_REQUIRE_EQUAL(policy.serialize_to_fits_format(2.0), std::string(17, ' ') + "2.0");
+    BOOST_REQUIRE_EQUAL(policy.serialize_to_fits_format(1.0e-7 / 3.0), "3.3333333333333334E-08");
+    BOOST_REQUIRE_EQUAL(policy.parse_to<double>(policy.serialize_to_fits_format(1.0e-7 / 3.0)), 1.0e-7 / 3.0);
+}
+
+BOOST_FIXTURE_TEST_CASE(serialize_into_card_buffer, cardpolicy_fixture) {
+
+    char buffer[70];
+    BOOST_REQUIRE_EQUAL(policy.serialize_to_fits_format(-42, buffer, sizeof(buffer)), 20u);
+    BOOST_REQUIRE_EQUAL(std::string(buffer, 20), std::string(17, ' ') + "-42");
+    BOOST_REQUIRE_THROW(policy.serialize_to_fits_format(std::string(69, 'A'), buffer, sizeof(buffer)), boost::astronomy::invalid_card);
+}
+
 BOOST_FIXTURE_TEST_CASE(serialize_complex, cardpolicy_fixture) {
 
     BOOST_REQUIRE_EQUAL(policy.serialize_to_fits_format(std::complex<int>(12,13)), std::string(18,' ')+"12"+std::string(18,' ')+ "13");
@@ -0,0 +1,123 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE column_transpose_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/column_transpose.hpp>
+#include <boost/astronomy/io/table_schema.hpp>
+#include <boost/astronomy/io/binary_data_converter.hpp>
+#include <boost/astronomy/io/fits_generator.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <cstdint>
+#include <stdio.h>
+#include "base_fixture.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    BOOST_ASTRONOMY_TABLE_COLUMN(count_col, "COL1", std::int32_t);
+    BOOST_ASTRONOMY_TABLE_COLUMN(ra_col, "COL3", double);
+    BOOST_ASTRONOMY_TABLE_COLUMN(short_col, "COL4", std::int16_t);
+    BOOST_ASTRONOMY_TABLE_COLUMN(name_col, "COL7", std::string);
+    BOOST_ASTRONOMY_TABLE_COLUMN(spectrum_col, "COL8", std::array<float, 4>);
+    BOOST_ASTRONOMY_TABLE_COLUMN(phase_col, "COL10", std::complex<double>);
+
+    typedef basic_binary_table_extension<card_policy, binary_data_converter> binary_table_type;
+    typedef typed_binary_table<table_schema<count_col, ra_col, short_col, name_col, spectrum_col, phase_col>> expected_table_type;
+
+    class column_transpose_fixture :public base_fixture<fits_stream, card_policy> {
+        std::string sample_path;
+    public:
+        hdu_store<card_policy>* raw_table;
+
+        column_transpose_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+            sample_path = samples_directory + "transpose_sample.fits";
+            {
+                boost::astronomy::io::fits_generator generator(sample_path, 5);
+                generator.write_binary_table(1000, boost::astronomy::io::fits_generator::mixed_column_forms(12), "TRANSPOSE");
+                generator.close();
+            }
+            load_file("transpose_sample.fits");
+            raw_table = get_raw_hdu("transpose_sample", "BINTABLE");
+        }
+
+        ~column_transpose_fixture() {
+            remove(sample_path.c_str());
+        }
+
+        /**
+         * @brief Checks the transposed columns against the values decoded from the rows
+        */
+        void check_columns(std::vector<aligned_column> const& columns) {
+            expected_table_type expected(raw_table->hdu_header, raw_table->hdu_data_buffer);
+
+            BOOST_REQUIRE_EQUAL(columns.size(), 12u);
+            for (auto const& col : columns) {
+                BOOST_REQUIRE_EQUAL(reinterpret_cast<std::uintptr_t>(col.bytes()) % aligned_column::alignment(), 0u);
+                BOOST_REQUIRE_EQUAL(col.rows(), 1000u);
+            }
+            BOOST_REQUIRE_EQUAL(columns[7].name(), "COL8");
+            BOOST_REQUIRE_EQUAL(columns[7].field_width(), 16u);
+
+            for (std::size_t row = 0; row < 1000; row++) {
+                BOOST_REQUIRE_EQUAL(columns[0].data<std::int32_t>()[row], expected.get<count_col>(row));
+                BOOST_REQUIRE_EQUAL(columns[2].data<double>()[row], expected.get<ra_col>(row));
+                BOOST_REQUIRE_EQUAL(columns[3].data<std::int16_t>()[row], expected.get<short_col>(row));
+                BOOST_REQUIRE_EQUAL(std::string(columns[6].data<char>() + 16 * row, 16), expected.get<name_col>(row));
+
+                std::array<float, 4> spectrum = expected.get<spectrum_col>(row);
+                for (std::size_t i = 0; i < 4; i++) {
+                    BOOST_REQUIRE_EQUAL(columns[7].data<float>()[4 * row + i], spectrum[i]);
+                }
+
+                std::complex<double> phase = expected.get<phase_col>(row);
+                BOOST_REQUIRE_EQUAL(columns[9].data<double>()[2 * row], phase.real());
+                BOOST_REQUIRE_EQUAL(columns[9].data<double>()[2 * row + 1], phase.imag());
+            }
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(column_transpose)
+
+BOOST_FIXTURE_TEST_CASE(transpose_binary_table, fits_test::column_transpose_fixture) {
+    BOOST_REQUIRE(raw_table != nullptr);
+    fits_test::binary_table_type table(raw_table->hdu_header, raw_table->hdu_data_buffer);
+
+    check_columns(transpose_columns(table, raw_table->hdu_data_buffer, 1));
+}
+
+BOOST_FIXTURE_TEST_CASE(transpose_blocks_with_multiple_threads, fits_test::column_transpose_fixture) {
+    fits_test::binary_table_type table(raw_table->hdu_header, raw_table->hdu_data_buffer);
+    std::size_t row_width = raw_table->hdu_header.naxis(1);
+
+    // 7 rows per block leaves a partial block at the end
+    check_columns(transpose_columns(raw_table->hdu_data_buffer.data(), 1000, row_width,
+        table.get_all_column_metadata(), 4, 7));
+}
+
+BOOST_FIXTURE_TEST_CASE(transpose_rejects_invalid_layout, fits_test::column_transpose_fixture) {
+    fits_test::binary_table_type table(raw_table->hdu_header, raw_table->hdu_data_buffer);
+    std::size_t row_width = raw_table->hdu_header.naxis(1);
+
+    BOOST_REQUIRE_THROW(transpose_columns(raw_table->hdu_data_buffer.data(), 1000, row_width - 1,
+        table.get_all_column_metadata()), boost::astronomy::invalid_table_colum_format);
+    BOOST_REQUIRE_THROW(transpose_columns(table, raw_table->hdu_data_buffer.substr(0, 100)),
+        boost::astronomy::file_reading_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
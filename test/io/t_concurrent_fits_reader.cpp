@@ -0,0 +1,178 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE concurrent_fits_reader_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/concurrent_fits_reader.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/fits_generator.hpp>
+#include <boost/astronomy/io/positional_file.hpp>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    typedef basic_binary_table_extension<card_policy, binary_data_converter> binary_table_type;
+    typedef basic_ascii_table<card_policy, ascii_converter> ascii_table_type;
+
+    class concurrent_reader_fixture {
+    public:
+        std::string samples_directory;
+        std::string generated_path;
+
+        /**
+         * @brief Generates a file with a primary image, an image extension and three binary tables
+        */
+        concurrent_reader_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+            generated_path = samples_directory + "concurrent_reader.fits";
+            fits_generator generator(generated_path, 11);
+            generator.write_primary_image(bitpix::B32, { 64, 48 });
+            generator.write_image_extension(bitpix::_B32, { 30, 20 }, "IMAGE1");
+            generator.write_binary_table(500, { "J", "D", "8A" }, "T1");
+            generator.write_binary_table(300, { "E", "2K" }, "T2");
+            generator.write_binary_table(700, { "I", "L", "X" }, "T3");
+            generator.close();
+        }
+
+        ~concurrent_reader_fixture() {
+            remove(generated_path.c_str());
+        }
+
+        std::string read_file(const std::string& path) const {
+            std::ifstream file(path, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(positional_reads)
+
+BOOST_FIXTURE_TEST_CASE(read_at_offsets, fits_test::concurrent_reader_fixture) {
+    std::string contents = read_file(generated_path);
+    positional_file file(generated_path);
+    BOOST_REQUIRE(file.is_open());
+    BOOST_REQUIRE_EQUAL(file.size(), contents.size());
+    BOOST_REQUIRE_EQUAL(file.read_at(2880, 80), contents.substr(2880, 80));
+
+    // Reads past the end of file are shortened
+    BOOST_REQUIRE_EQUAL(file.read_at(contents.size() - 10, 100), contents.substr(contents.size() - 10));
+    BOOST_REQUIRE(file.read_at(contents.size() + 10, 100).empty());
+
+    positional_file moved(std::move(file));
+    BOOST_REQUIRE(!file.is_open());
+    BOOST_REQUIRE_EQUAL(moved.read_at(0, 30), contents.substr(0, 30));
+
+    BOOST_REQUIRE_THROW(positional_file(samples_directory + "missing.fits"), boost::astronomy::file_reading_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(concurrent_reader)
+
+BOOST_FIXTURE_TEST_CASE(index_headers_like_fits_io, fits_test::concurrent_reader_fixture) {
+    for (std::string path : { generated_path, samples_directory + "fits_sample1.fits" }) {
+        concurrent_fits_reader reader(path);
+        auto sequential = fits::open(path, reading_options::read_only_headers);
+        control_block block = sequential.get_control_block_info();
+
+        BOOST_REQUIRE_EQUAL(reader.total_hdus(), block.hdus.size());
+        for (std::size_t index = 0; index < reader.total_hdus(); index++) {
+            BOOST_REQUIRE_EQUAL(reader.data_location(index), block.hdus[index].data_location);
+            BOOST_REQUIRE(!reader.is_decoded(index));
+        }
+    }
+
+    concurrent_fits_reader reader(samples_directory + "fits_sample1.fits");
+    BOOST_REQUIRE_EQUAL(reader.index_of("TABLE"), 1u);
+    BOOST_REQUIRE_EQUAL(reader.get_header(1).value_of<std::string>("XTENSION"), "TABLE");
+    BOOST_REQUIRE_THROW(reader.index_of("missing"), std::out_of_range);
+    BOOST_REQUIRE_THROW(reader[10], std::out_of_range);
+}
+
+BOOST_FIXTURE_TEST_CASE(read_regions_of_data_units, fits_test::concurrent_reader_fixture) {
+    std::string contents = read_file(generated_path);
+    concurrent_fits_reader reader(generated_path);
+
+    std::size_t table_data = reader.data_location(2);
+    BOOST_REQUIRE_EQUAL(reader.read_region(2, 20, 40), contents.substr(table_data + 20, 40));
+    BOOST_REQUIRE_EQUAL(reader.read_region(0, 64 * 48 * 4 - 8, 8), contents.substr(reader.data_location(0) + 64 * 48 * 4 - 8, 8));
+    BOOST_REQUIRE(!reader.is_decoded(2));
+
+    BOOST_REQUIRE_THROW(reader.read_region(2, 500 * 20 - 4, 8), std::out_of_range);
+    BOOST_REQUIRE_THROW(reader.read_region(7, 0, 8), std::out_of_range);
+}
+
+BOOST_FIXTURE_TEST_CASE(decode_hdus_from_many_threads, fits_test::concurrent_reader_fixture) {
+    concurrent_fits_reader reader(generated_path);
+    auto sequential = fits::open(generated_path);
+    const std::size_t total_hdus = reader.total_hdus();
+    const std::size_t thread_count = 8;
+
+    // Every thread walks the HDUs from a different starting point and reads regions in between
+    std::vector<std::vector<const concurrent_fits_reader::extension_type*>> seen(thread_count,
+        std::vector<const concurrent_fits_reader::extension_type*>(total_hdus, nullptr));
+    std::atomic<std::size_t> mismatches(0);
+    std::string expected_region = reader.read_region(4, 100, 64);
+    std::vector<std::thread> workers;
+    for (std::size_t thread_id = 0; thread_id < thread_count; thread_id++) {
+        workers.emplace_back([&, thread_id]() {
+            for (std::size_t round = 0; round < 20; round++) {
+                for (std::size_t step = 0; step < total_hdus; step++) {
+                    std::size_t index = (thread_id + step) % total_hdus;
+                    const auto* hdu = &reader[index];
+                    if (seen[thread_id][index] != nullptr && seen[thread_id][index] != hdu) { mismatches++; }
+                    seen[thread_id][index] = hdu;
+                    if (reader.read_region(4, 100, 64) != expected_region) { mismatches++; }
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) { worker.join(); }
+
+    BOOST_REQUIRE_EQUAL(mismatches.load(), 0u);
+    for (std::size_t index = 0; index < total_hdus; index++) {
+        BOOST_REQUIRE(reader.is_decoded(index));
+        for (std::size_t thread_id = 1; thread_id < thread_count; thread_id++) {
+            BOOST_REQUIRE(seen[thread_id][index] == seen[0][index]);
+        }
+    }
+
+    // Decoded HDUs hold the same data as the ones read by fits_io
+    for (std::size_t index = 2; index < total_hdus; index++) {
+        const auto& table = boost::get<fits_test::binary_table_type>(reader[index]);
+        BOOST_REQUIRE(table.get_data() == fits::convert_to<fits_test::binary_table_type>(sequential[static_cast<int>(index)]).get_data());
+    }
+    typedef basic_primary_hdu<card_policy, binary_data_converter> primary_hdu_type;
+    BOOST_REQUIRE(reader.get_header(0) == fits::convert_to<primary_hdu_type>(sequential[0]).get_header());
+}
+
+BOOST_FIXTURE_TEST_CASE(decode_ascii_table, fits_test::concurrent_reader_fixture) {
+    std::string path = samples_directory + "fits_sample1.fits";
+    concurrent_fits_reader reader(path);
+    auto sequential = fits::open(path);
+
+    const auto& table = boost::get<fits_test::ascii_table_type>(reader["TABLE"]);
+    BOOST_REQUIRE(table.get_data() == fits::convert_to<fits_test::ascii_table_type>(sequential["TABLE"]).get_data());
+    BOOST_REQUIRE(&reader["TABLE"] == &reader[1]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
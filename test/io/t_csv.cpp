@@ -0,0 +1,276 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE csv_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/csv.hpp>
+#include <boost/astronomy/io/binary_table_writer.hpp>
+#include <boost/astronomy/io/binary_data_converter.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <boost/astronomy/io/string_conversion_utility.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <stdio.h>
+#include "base_fixture.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    typedef basic_binary_table_extension<card_policy, binary_data_converter> binary_table_type;
+
+    class csv_fixture :public base_fixture<fits_stream, card_policy> {
+    public:
+        std::string table_path;
+        std::string csv_path;
+        std::string imported_path;
+        header<card_policy> table_header;
+        std::string table_data;
+
+        /**
+         * @brief Writes a table of 25 rows ( ID J with TNULL -1, FLUX E, NAME 10A, POS 2D, GOOD L ) and reads it back
+        */
+        csv_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+            table_path = samples_directory + "csv_source.fits";
+            csv_path = samples_directory + "csv_output.csv";
+            imported_path = samples_directory + "csv_imported.fits";
+
+            std::vector<column> columns = { column("J"), column("E"), column("10A"), column("2D"), column("L") };
+            columns[0].TTYPE("ID");
+            columns[1].TTYPE("FLUX");
+            columns[2].TTYPE("NAME");
+            columns[3].TTYPE("POS");
+            columns[4].TTYPE("GOOD");
+            {
+                binary_table_writer writer(table_path, columns, "CATALOG");
+                for (std::int32_t row = 0; row < 25; row++) {
+                    std::string name = row == 1 ? "a,\"b\"" : "S" + std::to_string(row);
+                    writer.write_row(row % 4 == 0 ? -1 : row * 1000, static_cast<float>(row) * 0.25f, name,
+                        std::array<double, 2>{ { row * 1.5, -row * 0.1 } }, row % 2 == 0);
+                }
+            }
+            table_header = read_table_header(table_path, table_data);
+            card<card_policy> tnull;
+            tnull.create_card("TNULL1", -1);
+            table_header.add_card(tnull);
+        }
+
+        ~csv_fixture() {
+            remove(table_path.c_str());
+            remove(csv_path.c_str());
+            remove(imported_path.c_str());
+        }
+
+        /**
+         * @brief Reads the header and data unit of the table following the empty primary HDU
+        */
+        static header<card_policy> read_table_header(std::string const& path, std::string& data) {
+            fits_stream file;
+            file.set_file(path);
+            file.set_reading_pos(2880);
+            header<card_policy> hdu_header;
+            hdu_header.read_header(file);
+            data = file.read(hdu_header.naxis(1) * hdu_header.naxis(2));
+            return hdu_header;
+        }
+
+        std::string read_csv_text() const {
+            std::ifstream in(csv_path, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+
+        void write_csv_text(std::string const& text) const {
+            std::ofstream out(csv_path, std::ios::binary);
+            out << text;
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(csv_tests)
+
+BOOST_AUTO_TEST_CASE(parse_numbers_without_allocation) {
+    long long integer = 0;
+    double real = 0;
+    const char text[] = " -9223372036854775808 ";
+    BOOST_REQUIRE(number_parser::parse(text, text + sizeof(text) - 1, integer));
+    BOOST_REQUIRE_EQUAL(integer, std::numeric_limits<long long>::min());
+
+    const char overflow[] = "9223372036854775808";
+    BOOST_REQUIRE(!number_parser::parse(overflow, overflow + sizeof(overflow) - 1, integer));
+
+    const char fits_real[] = "1.5D+02";
+    BOOST_REQUIRE(number_parser::parse(fits_real, fits_real + sizeof(fits_real) - 1, real));
+    BOOST_REQUIRE_EQUAL(real, 150.0);
+
+    // More significant digits than the exact path handles are converted by strtod
+    const char long_real[] = "0.30000000000000004";
+    BOOST_REQUIRE(number_parser::parse(long_real, long_real + sizeof(long_real) - 1, real));
+    BOOST_REQUIRE_EQUAL(real, 0.1 + 0.2);
+
+    const char partial[] = "2.5x";
+    BOOST_REQUIRE(!number_parser::parse(partial, partial + sizeof(partial) - 1, real));
+}
+
+BOOST_FIXTURE_TEST_CASE(export_and_import_binary_table, fits_test::csv_fixture) {
+    fits_test::binary_table_type table(table_header, table_data);
+
+    csv_options options;
+    options.chunk_rows = 3;
+    options.threads = 4;
+    write_csv(table, table_data, csv_path, options);
+
+    std::string text = read_csv_text();
+    std::vector<std::string> lines;
+    for (std::size_t start = 0, end = text.find('\n'); end != std::string::npos; start = end + 1, end = text.find('\n', start)) {
+        lines.push_back(text.substr(start, end - start));
+    }
+    BOOST_REQUIRE_EQUAL(lines.size(), 26u);
+    BOOST_REQUIRE_EQUAL(lines[0], "ID,FLUX,NAME,POS,GOOD");
+    BOOST_REQUIRE_EQUAL(lines[1], ",0.0,S0,0.0 0.0,T");
+    BOOST_REQUIRE_EQUAL(lines[2], "1000,0.25,\"a,\"\"b\"\"\",1.5 -0.1,F");
+    BOOST_REQUIRE_EQUAL(lines[24], "23000,5.75,S23,34.5 -2.3000000000000003,F");
+
+    // Values read back are the stored ones, except TNULL which is imported as 0
+    std::size_t rows = read_csv(csv_path, imported_path, table.get_all_column_metadata(), options, "IMPORTED");
+    BOOST_REQUIRE_EQUAL(rows, 25u);
+
+    std::string imported_data;
+    header<card_policy> imported_header = read_table_header(imported_path, imported_data);
+    BOOST_REQUIRE_EQUAL(imported_header.value_of<std::string>("TTYPE3"), "NAME");
+    BOOST_REQUIRE_EQUAL(imported_header.naxis(2), 25u);
+
+    std::size_t row_width = table_header.naxis(1);
+    for (std::size_t row = 0; row < 25; row++) {
+        std::string expected = table_data.substr(row * row_width, row_width);
+        if (row % 4 == 0) { expected.replace(0, 4, std::string(4, '\0')); }
+        BOOST_REQUIRE_EQUAL(imported_data.substr(row * row_width, row_width), expected);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(export_from_fits_stream, fits_test::csv_fixture) {
+    fits_test::binary_table_type table(table_header, table_data);
+    csv_options options;
+    options.delimiter = '\t';
+    options.chunk_rows = 4;
+    options.threads = 2;
+    write_csv(table, table_data, csv_path, options);
+    std::string from_memory = read_csv_text();
+
+    fits_stream file;
+    file.set_file(table_path);
+    write_csv(table, file, 2880 + table_header.raw_records().size(), csv_path, options);
+    BOOST_REQUIRE_EQUAL(read_csv_text(), from_memory);
+    BOOST_REQUIRE_EQUAL(from_memory.substr(0, from_memory.find('\n')), "ID\tFLUX\tNAME\tPOS\tGOOD");
+
+    BOOST_REQUIRE_THROW(write_csv(table, table_data.substr(0, 10), csv_path), boost::astronomy::file_reading_exception);
+}
+
+BOOST_FIXTURE_TEST_CASE(infer_and_import_csv, fits_test::csv_fixture) {
+    write_csv_text(
+        "ID,NAME,RA,GOOD,BIG\r\n"
+        "1,\"multi\nline\",10.5,T,1\r\n"
+        "\r\n"
+        "2,\"say \"\"hi\"\"\",,false,5000000000\r\n"
+        "-3,plain,1.5e3,,2");
+
+    std::vector<column> columns = infer_csv_columns(csv_path);
+    BOOST_REQUIRE_EQUAL(columns.size(), 5u);
+    BOOST_REQUIRE_EQUAL(columns[0].TFORM(), "J");
+    BOOST_REQUIRE_EQUAL(columns[1].TFORM(), "10A");
+    BOOST_REQUIRE_EQUAL(columns[2].TFORM(), "D");
+    BOOST_REQUIRE_EQUAL(columns[3].TFORM(), "L");
+    BOOST_REQUIRE_EQUAL(columns[4].TFORM(), "K");
+    BOOST_REQUIRE_EQUAL(columns[4].TTYPE(), "BIG");
+
+    // A tiny block forces records to be carried over from one block to the next
+    csv_options options;
+    options.block_size = 7;
+    options.chunk_rows = 1;
+    BOOST_REQUIRE_EQUAL(read_csv(csv_path, imported_path, options), 3u);
+
+    std::string data;
+    header<card_policy> imported_header = fits_test::csv_fixture::read_table_header(imported_path, data);
+    BOOST_REQUIRE_EQUAL(imported_header.naxis(1), 31u);
+    BOOST_REQUIRE_EQUAL((detail::load_big_endian<std::int32_t, std::uint32_t>(&data[62])), -3);
+    BOOST_REQUIRE_EQUAL(data.substr(4, 10), "multi\nline");
+    BOOST_REQUIRE_EQUAL(data.substr(35, 10), "say \"hi\"  ");
+    BOOST_REQUIRE(std::isnan(detail::load_big_endian<double, std::uint64_t>(&data[45])));
+    BOOST_REQUIRE_EQUAL((detail::load_big_endian<double, std::uint64_t>(&data[76])), 1500.0);
+    BOOST_REQUIRE_EQUAL(data[53], 'F');
+    BOOST_REQUIRE_EQUAL(data[84], '\0');
+    BOOST_REQUIRE_EQUAL((detail::load_big_endian<std::int64_t, std::uint64_t>(&data[54])), 5000000000LL);
+}
+
+BOOST_FIXTURE_TEST_CASE(widen_columns_past_the_sampled_rows, fits_test::csv_fixture) {
+    // Values past the 1000 sampled rows fit neither J nor D
+    std::string text = "COUNT,FLUX,LEVEL\n";
+    for (int row = 0; row < 1200; row++) {
+        std::string count = row == 1100 ? "5000000000" : std::to_string(row);
+        std::string flux = row == 1150 ? "n/a" : std::to_string(row) + ".5";
+        std::string level = row == 1190 ? "2.5" : std::to_string(row % 7);
+        text += count + "," + flux + "," + level + "\n";
+    }
+    write_csv_text(text);
+    BOOST_REQUIRE_EQUAL(infer_csv_columns(csv_path)[0].TFORM(), "J");
+
+    BOOST_REQUIRE_EQUAL(read_csv(csv_path, imported_path), 1200u);
+    std::string data;
+    header<card_policy> imported_header = fits_test::csv_fixture::read_table_header(imported_path, data);
+    BOOST_REQUIRE_EQUAL(imported_header.value_of<std::string>("TFORM1"), "K");
+    BOOST_REQUIRE_EQUAL(imported_header.value_of<std::string>("TFORM2"), "6A");
+    BOOST_REQUIRE_EQUAL(imported_header.value_of<std::string>("TFORM3"), "D");
+    std::size_t row_width = imported_header.naxis(1);
+    BOOST_REQUIRE_EQUAL((detail::load_big_endian<std::int64_t, std::uint64_t>(&data[1100 * row_width])), 5000000000LL);
+    BOOST_REQUIRE_EQUAL(data.substr(1150 * row_width + 8, 6), "n/a   ");
+    BOOST_REQUIRE_EQUAL((detail::load_big_endian<double, std::uint64_t>(&data[1190 * row_width + 14])), 2.5);
+}
+
+BOOST_FIXTURE_TEST_CASE(reject_malformed_rows, fits_test::csv_fixture) {
+    std::vector<column> columns = { column("J"), column("E") };
+
+    write_csv_text("A,B\n1,2.5\n2,oops\n");
+    BOOST_REQUIRE_THROW(read_csv(csv_path, imported_path, columns), boost::astronomy::invalid_cast);
+
+    write_csv_text("A,B\n1,2.5,3\n");
+    BOOST_REQUIRE_THROW(read_csv(csv_path, imported_path, columns), boost::astronomy::invalid_cast);
+
+    write_csv_text("A,B\n3000000000,1\n");
+    BOOST_REQUIRE_THROW(read_csv(csv_path, imported_path, columns), boost::astronomy::invalid_cast);
+
+    write_csv_text("A,B\n\"1,2\n");
+    BOOST_REQUIRE_THROW(read_csv(csv_path, imported_path, columns), boost::astronomy::invalid_cast);
+}
+
+BOOST_FIXTURE_TEST_CASE(export_ascii_table, fits_test::csv_fixture) {
+    load_file("fits_sample1.fits");
+    fits_test::hdu_store<card_policy>* raw_ascii = get_raw_hdu("fits_sample1", "TABLE");
+    BOOST_REQUIRE(raw_ascii != nullptr);
+    basic_ascii_table<card_policy, ascii_converter> table(raw_ascii->hdu_header, raw_ascii->hdu_data_buffer);
+
+    write_csv(table, raw_ascii->hdu_data_buffer, csv_path);
+    std::string text = read_csv_text();
+    BOOST_REQUIRE_EQUAL(std::count(text.begin(), text.end(), '\n'), 5);
+    BOOST_REQUIRE_EQUAL(text.substr(0, 7), "CRVAL1,");
+
+    // Every exported row is imported again with the inferred columns
+    BOOST_REQUIRE_EQUAL(read_csv(csv_path, imported_path), 4u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
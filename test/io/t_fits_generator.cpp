@@ -0,0 +1,133 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE fits_generator_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits_generator.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <fstream>
+#include <iterator>
+#include <stdio.h>
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    class fits_generator_fixture {
+        std::string samples_directory;
+    public:
+        fits_generator_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+        }
+
+        std::string get_path(const std::string& file_name) {
+            return samples_directory + file_name;
+        }
+
+        std::string read_file(const std::string& path) {
+            std::ifstream file(path, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(fits_generator)
+
+BOOST_FIXTURE_TEST_CASE(generate_primary_image, fits_test::fits_generator_fixture) {
+    std::string path = get_path("generated_image.fits");
+    {
+        boost::astronomy::io::fits_generator generator(path, 7);
+        generator.write_primary_image(bitpix::B16, { 100, 60 });
+        BOOST_REQUIRE_EQUAL(generator.bytes_written(), 2880u + 5 * 2880u);
+        generator.close();
+    }
+
+    auto reader = fits::open(path);
+    auto& prime_hdu = fits::convert_to<primary_hdu>(reader["primary_hdu"]);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().naxis(1), 100u);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().naxis(2), 60u);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_data<bitpix::B16>().size(), 6000u);
+
+    remove(path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(generation_is_deterministic, fits_test::fits_generator_fixture) {
+    std::string first_path = get_path("generated_first.fits");
+    std::string second_path = get_path("generated_second.fits");
+    std::string other_seed_path = get_path("generated_other_seed.fits");
+
+    auto generate = [](const std::string& path, std::uint64_t seed) {
+        boost::astronomy::io::fits_generator generator(path, seed, 2880);
+        generator.write_primary_image(bitpix::_B64, { 64, 64 });
+        generator.write_binary_table(300, boost::astronomy::io::fits_generator::mixed_column_forms(12));
+        generator.close();
+    };
+    generate(first_path, 42);
+    generate(second_path, 42);
+    generate(other_seed_path, 43);
+
+    BOOST_REQUIRE(read_file(first_path) == read_file(second_path));
+    BOOST_REQUIRE(read_file(first_path) != read_file(other_seed_path));
+
+    remove(first_path.c_str());
+    remove(second_path.c_str());
+    remove(other_seed_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(generate_mixed_binary_table, fits_test::fits_generator_fixture) {
+    std::string path = get_path("generated_table.fits");
+    {
+        boost::astronomy::io::fits_generator generator(path);
+        generator.write_binary_table(1000, boost::astronomy::io::fits_generator::mixed_column_forms(30), "EVENTS");
+        generator.close();
+    }
+
+    auto reader = fits::open(path);
+    auto& table = fits::convert_to<binary_table>(reader["BINTABLE"]);
+    BOOST_REQUIRE_EQUAL(table.get_header().naxis(2), 1000u);
+    BOOST_REQUIRE_EQUAL(table.get_header().value_of<std::string>("EXTNAME"), "EVENTS");
+    BOOST_REQUIRE_EQUAL(table.get_data().size(), 1000u);
+    std::vector<boost::float32_t> last_row = table.get_column<std::vector<boost::float32_t>>("COL8")[999];
+    BOOST_REQUIRE_EQUAL(last_row.size(), 4u);
+
+    auto& values = table.get_column<boost::float64_t>("COL3");
+    for (auto iter = values.begin(); iter != values.end(); ++iter) {
+        boost::float64_t value = *iter;
+        BOOST_REQUIRE(value >= -1000.0 && value < 1000.0);
+    }
+
+    remove(path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(generate_many_extensions, fits_test::fits_generator_fixture) {
+    std::string path = get_path("generated_extensions.fits");
+    {
+        boost::astronomy::io::fits_generator generator(path);
+        for (int i = 0; i < 1000; i++) {
+            // Data units filling exactly one logical record must not be followed by padding
+            generator.write_image_extension(bitpix::_B32, { 30, 24 });
+        }
+        BOOST_REQUIRE_EQUAL(generator.total_hdus(), 1001u);
+        BOOST_REQUIRE_EQUAL(generator.bytes_written(), 2880u + 1000u * 2 * 2880u);
+        generator.close();
+    }
+
+    auto reader = fits::open(path, reading_options::read_only_headers);
+    BOOST_REQUIRE_EQUAL(reader.get_hdu_list().size(), 1001u);
+
+    remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
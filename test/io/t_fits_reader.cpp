@@ -16,6 +16,11 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include <boost/astronomy/io/fits.hpp>
 #include <boost/astronomy/io/string_conversion_utility.hpp>
 #include <boost/astronomy/io/binary_data_converter.hpp>
+#include <boost/astronomy/io/fits_generator.hpp>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdio.h>
 
 using namespace boost::astronomy::io;
 
@@ -40,6 +45,63 @@ namespace fits_test {
             reader.initialize(sample1_path);
         }
 
+        std::string copy_sample(const std::string& sample_name, const std::string& copy_name) {
+            std::string copy_path = samples_directory + copy_name;
+            std::ifstream source(samples_directory + sample_name, std::ios::binary);
+            std::ofstream destination(copy_path, std::ios::binary | std::ios::trunc);
+            destination << source.rdbuf();
+            return copy_path;
+        }
+
+        /**
+         * @brief Generates a file with an empty primary HDU and three binary tables ( T1, T2, T3 ) of 800 bytes each
+        */
+        std::string generate_tables(const std::string& file_name) {
+            std::string path = samples_directory + file_name;
+            fits_generator generator(path, 3);
+            generator.write_primary_hdu();
+            for (std::string name : { "T1", "T2", "T3" }) {
+                generator.write_binary_table(100, { "J", "E" }, name);
+            }
+            generator.close();
+            return path;
+        }
+
+        /**
+         * @brief Generates a file with a binary table of 50 rows followed by an image extension
+        */
+        std::string generate_cells(const std::string& file_name) {
+            std::string path = samples_directory + file_name;
+            fits_generator generator(path, 5);
+            generator.write_binary_table(50, { "I", "J", "C" }, "CELLS");
+            generator.write_image_extension(bitpix::_B32, { 4, 3 }, "IMAGE1");
+            generator.close();
+            return path;
+        }
+
+        /**
+         * @brief Generates a file with a binary table of 10 rows and a heap of 6000 bytes followed by an image extension
+        */
+        std::string generate_heap_table(const std::string& file_name) {
+            std::string path = samples_directory + file_name;
+            fits_generator generator(path, 9);
+            generator.write_primary_hdu();
+            generator.write_binary_table(10, { "J" }, "HEAP", 6000);
+            generator.write_image_extension(bitpix::B16, { 4, 3 }, "IMAGE1");
+            generator.close();
+            return path;
+        }
+
+        std::string read_file(const std::string& path) {
+            std::ifstream file(path, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        std::size_t file_size(const std::string& path) {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            return static_cast<std::size_t>(file.tellg());
+        }
+
     };
     struct fetch_data_size :boost::static_visitor <std::size_t> {
     template<typename T>
@@ -89,6 +151,7 @@ BOOST_FIXTURE_TEST_CASE(invalid_index, fits_test::fits_reader_fixture) {
     reader.read_only_headers();
 
     BOOST_REQUIRE_THROW(reader[10],std::out_of_range);
+    BOOST_REQUIRE_THROW(reader[-1], std::out_of_range);
 }
 BOOST_FIXTURE_TEST_CASE(get_hdu_by_name, fits_test::fits_reader_fixture) {
     reader.read_only_headers();
@@ -103,4 +166,359 @@ BOOST_FIXTURE_TEST_CASE(invalid_name, fits_test::fits_reader_fixture) {
     BOOST_REQUIRE_THROW(reader["test_hdu"], std::out_of_range);
 }
 
+BOOST_FIXTURE_TEST_CASE(skip_the_heap_of_tables, fits_test::fits_reader_fixture) {
+    // The table data ( 10 rows of 4 bytes ) and its heap of 6000 bytes span three logical records
+    std::string path = generate_heap_table("table_heap.fits");
+
+    fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> headers(path);
+    headers.read_only_headers();
+    fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> entire(path);
+    entire.read_entire_hdus();
+    for (auto const& control : { headers.get_control_block_info(), entire.get_control_block_info() }) {
+        BOOST_REQUIRE_EQUAL(control.hdus.size(), 3u);
+        BOOST_REQUIRE_EQUAL(control.hdus[2].header_location, 5u * 2880);
+        BOOST_REQUIRE_EQUAL(control.hdus[2].data_location, 6u * 2880);
+    }
+    BOOST_REQUIRE_EQUAL(fits::convert_to<binary_table>(entire["BINTABLE"]).get_data().size(), 10u);
+
+    remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(in_place_updates)
+
+BOOST_FIXTURE_TEST_CASE(update_existing_card, fits_test::fits_reader_fixture) {
+    std::string copy_path = copy_sample("fits_sample1.fits", "in_place_card.fits");
+    auto original_size = file_size(copy_path);
+    {
+        fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> updater(copy_path);
+        updater.read_only_headers();
+        updater.update_card("primary_hdu", "GPIXELS", 1234);
+
+        auto& prime_hdu = fits::convert_to<primary_hdu>(updater["primary_hdu"]);
+        BOOST_REQUIRE_EQUAL(prime_hdu.get_header().value_of<int>("GPIXELS"), 1234);
+    }
+
+    auto astro_data = fits::open(copy_path);
+    auto& prime_hdu = fits::convert_to<primary_hdu>(astro_data["primary_hdu"]);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().value_of<int>("GPIXELS"), 1234);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().card_count(), 262);
+    BOOST_REQUIRE_EQUAL(file_size(copy_path), original_size);
+
+    remove(copy_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(add_card_in_free_header_space, fits_test::fits_reader_fixture) {
+    std::string copy_path = copy_sample("fits_sample1.fits", "in_place_new_card.fits");
+    auto original_size = file_size(copy_path);
+    {
+        fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> updater(copy_path);
+        updater.read_only_headers();
+        updater.update_card("primary_hdu", "FILTER", std::string("r"));
+    }
+
+    auto astro_data = fits::open(copy_path);
+    auto& prime_hdu = fits::convert_to<primary_hdu>(astro_data["primary_hdu"]);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().value_of<std::string>("FILTER"), "r");
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().card_count(), 263);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_data<bitpix::_B32>().size(), 160000);
+    BOOST_REQUIRE_EQUAL(file_size(copy_path), original_size);
+
+    remove(copy_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(raise_exception_when_header_is_full, fits_test::fits_reader_fixture) {
+    std::string copy_path = copy_sample("fits_sample2.fits", "in_place_full_header.fits");
+
+    fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> updater(copy_path);
+    updater.read_only_headers();
+    for (int i = 0; i < 28; i++) {
+        updater.update_card("primary_hdu", "KEY" + std::to_string(i), i);
+    }
+    BOOST_REQUIRE_THROW(updater.update_card("primary_hdu", "OVERFLOW", 1), boost::astronomy::header_space_exhausted_exception);
+
+    remove(copy_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(update_hdus_sharing_a_name, fits_test::fits_reader_fixture) {
+    std::string path = generate_tables("in_place_same_names.fits");
+    {
+        fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> updater(path);
+        updater.read_only_headers();
+        updater.update_card(1, "OBSERVER", std::string("first"));
+        updater.update_cell(1, "COL1", 5, boost::int32_t(42));
+        updater.update_card(2, "OBSERVER", std::string("second"));
+
+        BOOST_REQUIRE_THROW(updater.update_card(4, "OBSERVER", 1), std::out_of_range);
+        for (std::string keyword : { "NAXIS2", "BITPIX", "PCOUNT", "TFORM1", "XTENSION" }) {
+            BOOST_REQUIRE_THROW(updater.update_card(1, keyword, 1), boost::astronomy::structural_keyword_exception);
+        }
+        BOOST_REQUIRE_THROW(updater.update_card("BINTABLE", "NAXIS", 3), boost::astronomy::structural_keyword_exception);
+    }
+
+    fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> updated(path);
+    updated.read_entire_hdus();
+    auto& first = fits::convert_to<binary_table>(updated[1]);
+    BOOST_REQUIRE_EQUAL(first.get_header().value_of<std::string>("OBSERVER"), "first");
+    BOOST_REQUIRE_EQUAL(first.get_header().value_of<int>("NAXIS2"), 100);
+    BOOST_REQUIRE_EQUAL(static_cast<boost::int32_t>(first.get_column<boost::int32_t>("COL1")[5]), 42);
+    auto& second = fits::convert_to<binary_table>(updated[2]);
+    BOOST_REQUIRE_EQUAL(second.get_header().value_of<std::string>("OBSERVER"), "second");
+    BOOST_REQUIRE(!fits::convert_to<binary_table>(updated[3]).get_header().contains_keyword("OBSERVER"));
+
+    remove(path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(update_pixel_range, fits_test::fits_reader_fixture) {
+    std::string copy_path = copy_sample("fits_sample1.fits", "in_place_pixels.fits");
+    std::vector<float> pixels = { 1.5f, -2.25f, 3.0f };
+    {
+        fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> updater(copy_path);
+        updater.read_entire_hdus();
+        updater.update_pixels("primary_hdu", 100, pixels);
+
+        auto& prime_hdu = fits::convert_to<primary_hdu>(updater["primary_hdu"]);
+        BOOST_REQUIRE_EQUAL(prime_hdu.get_data<bitpix::_B32>()(0, 101), -2.25f);
+        BOOST_REQUIRE_THROW(updater.update_pixels("primary_hdu", 0, std::vector<double>(1)), boost::astronomy::invalid_cast);
+        BOOST_REQUIRE_THROW(updater.update_pixels("primary_hdu", 159999, pixels), std::out_of_range);
+    }
+
+    auto astro_data = fits::open(copy_path);
+    auto& prime_hdu = fits::convert_to<primary_hdu>(astro_data["primary_hdu"]);
+    auto image_data = prime_hdu.get_data<bitpix::_B32>();
+    BOOST_REQUIRE_EQUAL(image_data(0, 100), 1.5f);
+    BOOST_REQUIRE_EQUAL(image_data(0, 101), -2.25f);
+    BOOST_REQUIRE_EQUAL(image_data(0, 102), 3.0f);
+
+    remove(copy_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(update_ascii_table_cell, fits_test::fits_reader_fixture) {
+    std::string copy_path = copy_sample("fits_sample1.fits", "in_place_ascii_cell.fits");
+    {
+        fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> updater(copy_path);
+        updater.read_entire_hdus();
+        updater.update_cell("TABLE", "DETECTOR", 2, 7LL);
+        updater.update_cell("TABLE", "CRPIX1", 3, 1234323.2334242);
+        BOOST_REQUIRE_THROW(updater.update_cell("primary_hdu", "DETECTOR", 2, 7LL), boost::astronomy::wrong_extension_type);
+        BOOST_REQUIRE_THROW(updater.update_cell("TABLE", "CRPIX1", 3, std::numeric_limits<double>::quiet_NaN()),
+            boost::astronomy::invalid_cast);
+    }
+
+    auto astro_data = fits::open(copy_path);
+    auto& table = fits::convert_to<ascii_table>(astro_data["TABLE"]);
+    BOOST_REQUIRE_EQUAL(static_cast<long long>(table.get_column<long long>("DETECTOR")[2]), 7LL);
+    BOOST_REQUIRE_CLOSE(static_cast<double>(table.get_column<double>("BACKGRND")[2]), 0.476156, 0.001);
+    BOOST_REQUIRE_CLOSE(static_cast<double>(table.get_column<double>("CRPIX1")[3]), 1234323.2, 1e-6);
+
+    remove(copy_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(update_binary_table_cell, fits_test::fits_reader_fixture) {
+    std::string copy_path = copy_sample("fits_sample3.fits", "in_place_binary_cell.fits");
+    std::vector<boost::float32_t> del_time(120, 2.5f);
+    {
+        fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> updater(copy_path);
+        updater.read_only_headers();
+        updater.update_cell("BINTABLE", "DEL_TIME", 0, del_time);
+        BOOST_REQUIRE_THROW(updater.update_cell("BINTABLE", "DEL_TIME", 0, 1.0), boost::astronomy::invalid_table_colum_format);
+    }
+
+    auto astro_data = fits::open(copy_path);
+    auto& table = fits::convert_to<binary_table>(astro_data["BINTABLE"]);
+    std::vector<boost::float32_t> row = table.get_column<std::vector<boost::float32_t>>("DEL_TIME")[0];
+    BOOST_REQUIRE_EQUAL(row.size(), 120);
+    BOOST_REQUIRE_CLOSE(row[119], 2.5f, 0.001);
+
+    remove(copy_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(update_binary_table_cell_past_first_row, fits_test::fits_reader_fixture) {
+    std::string path = generate_cells("in_place_binary_rows.fits");
+
+    boost::int16_t next_row = 0, untouched_row = 0;
+    std::complex<boost::float32_t> untouched_complex;
+    {
+        fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> updater(path);
+        updater.read_entire_hdus();
+        auto& table = fits::convert_to<binary_table>(updater["BINTABLE"]);
+        next_row = table.get_column<boost::int16_t>("COL1")[38];
+        untouched_row = table.get_column<boost::int16_t>("COL1")[40];
+        untouched_complex = table.get_column<std::complex<boost::float32_t>>("COL3")[40];
+
+        updater.update_cell("BINTABLE", "COL1", 37, boost::int16_t(-1234));
+        updater.update_cell("BINTABLE", "COL2", 37, boost::int32_t(70000));
+        BOOST_REQUIRE_EQUAL(static_cast<boost::int16_t>(table.get_column<boost::int16_t>("COL1")[37]), -1234);
+
+        // Values the cached columns cannot hold are rejected before anything is written
+        BOOST_REQUIRE_THROW(updater.update_cell("BINTABLE", "COL1", 40, std::uint16_t(60000)), boost::astronomy::invalid_cast);
+        BOOST_REQUIRE_THROW(updater.update_cell("BINTABLE", "COL3", 40, 1.0), boost::astronomy::invalid_cast);
+        BOOST_REQUIRE_THROW(updater.update_pixels("IMAGE", 0, std::vector<float>(2)), boost::astronomy::file_writing_exception);
+    }
+
+    auto astro_data = fits::open(path);
+    auto& table = fits::convert_to<binary_table>(astro_data["BINTABLE"]);
+    BOOST_REQUIRE_EQUAL(static_cast<boost::int16_t>(table.get_column<boost::int16_t>("COL1")[37]), -1234);
+    BOOST_REQUIRE_EQUAL(static_cast<boost::int32_t>(table.get_column<boost::int32_t>("COL2")[37]), 70000);
+    BOOST_REQUIRE_EQUAL(static_cast<boost::int16_t>(table.get_column<boost::int16_t>("COL1")[38]), next_row);
+    BOOST_REQUIRE_EQUAL(static_cast<boost::int16_t>(table.get_column<boost::int16_t>("COL1")[40]), untouched_row);
+    std::complex<boost::float32_t> stored_complex = table.get_column<std::complex<boost::float32_t>>("COL3")[40];
+    BOOST_REQUIRE(stored_complex == untouched_complex);
+
+    remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(io_instrumentation)
+
+BOOST_FIXTURE_TEST_CASE(collect_statistics_of_entire_hdus, fits_test::fits_reader_fixture) {
+    std::size_t allocations = 0;
+    io_statistics statistics([&allocations]() { return ++allocations; });
+
+    auto astro_data = instrumented_fits::open(sample1_path, reading_options::read_entire_hdus, statistics);
+    auto& hdus = astro_data.get_observer().hdus;
+
+    BOOST_REQUIRE_EQUAL(hdus.size(), 2);
+    BOOST_REQUIRE_EQUAL(hdus[0].hdu_name, "primary_hdu");
+    BOOST_REQUIRE_EQUAL(hdus[1].hdu_name, "TABLE");
+    BOOST_REQUIRE_EQUAL(hdus[0].header_location, 0);
+    BOOST_REQUIRE_EQUAL(hdus[1].header_location, astro_data.get_control_block_info().hdus_info["TABLE"].header_location);
+
+    auto& prime_hdu = fits::convert_to<primary_hdu>(astro_data["primary_hdu"]);
+    // Header is read in whole logical records
+    BOOST_REQUIRE_EQUAL(hdus[0].header_parse.bytes_read, ((prime_hdu.get_header().card_count() + 1) * 80 + 2879) / 2880 * 2880);
+    BOOST_REQUIRE_EQUAL(hdus[0].data_read.bytes_read, 200 * 200 * 4 * 4);
+    BOOST_REQUIRE_EQUAL(hdus[0].decode.bytes_read, 0);
+
+    auto& table = fits::convert_to<ascii_table>(astro_data["TABLE"]);
+    BOOST_REQUIRE_EQUAL(hdus[1].data_read.bytes_read, table.get_header().naxis(1) * table.get_header().naxis(2));
+
+    // Reading every HDU in order never jumps over the file
+    BOOST_REQUIRE_EQUAL(astro_data.get_observer().total().seeks, 0);
+    BOOST_REQUIRE_EQUAL(hdus[0].allocations(), 3);
+    BOOST_REQUIRE_EQUAL(astro_data.get_observer().total().bytes_read(), hdus[0].bytes_read() + hdus[1].bytes_read());
+}
+
+BOOST_FIXTURE_TEST_CASE(observe_reading_of_headers_through_callbacks, fits_test::fits_reader_fixture) {
+    std::vector<std::string> hdu_names;
+    std::size_t data_phases = 0, header_bytes = 0;
+    std::vector<std::size_t> seeks;
+
+    callback_io_observer observer;
+    observer.on_hdu_completed = [&hdu_names](const std::string& hdu_name) { hdu_names.push_back(hdu_name); };
+    observer.on_phase_completed = [&](io_phase phase, std::size_t bytes_read, std::chrono::nanoseconds) {
+        if (phase == io_phase::data_read) { data_phases++; }
+        if (phase == io_phase::header_parse) { header_bytes += bytes_read; }
+    };
+    observer.on_seek = [&seeks](std::size_t position) { seeks.push_back(position); };
+
+    fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>, callback_io_observer>
+        instrumented_reader(sample1_path, observer);
+    instrumented_reader.read_only_headers();
+
+    BOOST_REQUIRE_EQUAL(hdu_names.size(), 2);
+    BOOST_REQUIRE_EQUAL(hdu_names[1], "TABLE");
+    BOOST_REQUIRE_EQUAL(data_phases, 0);
+    BOOST_REQUIRE(header_bytes > 0 && header_bytes % 80 == 0);
+
+    // Both HDUs have a data unit, skipped with one seek each to the next header ( or the end of the file )
+    BOOST_REQUIRE_EQUAL(seeks.size(), 2);
+    BOOST_REQUIRE_EQUAL(seeks[0], instrumented_reader.get_control_block_info().hdus_info["TABLE"].header_location);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(memory_budget)
+
+BOOST_FIXTURE_TEST_CASE(evict_least_recently_used_data, fits_test::fits_reader_fixture) {
+    std::string path = generate_tables("budget_tables.fits");
+    fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> unlimited(path);
+    unlimited.read_entire_hdus();
+
+    // The budget is enforced while the file is read, T1 is released when T3 is read
+    fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> budgeted(path);
+    budgeted.set_memory_budget(2000);
+    budgeted.read_entire_hdus();
+    BOOST_REQUIRE(!budgeted.is_data_resident(0));
+    BOOST_REQUIRE(!budgeted.is_data_resident(1));
+    BOOST_REQUIRE(budgeted.is_data_resident(2) && budgeted.is_data_resident(3));
+    BOOST_REQUIRE_EQUAL(budgeted.get_cache_statistics().resident_bytes, 1600u);
+    BOOST_REQUIRE_EQUAL(budgeted.get_cache_statistics().evictions, 1u);
+    BOOST_REQUIRE(fits::convert_to<binary_table>(budgeted.get_hdu_list()[1]).get_data().empty());
+    BOOST_REQUIRE_EQUAL(fits::convert_to<binary_table>(budgeted.get_hdu_list()[1]).get_header().value_of<std::string>("EXTNAME"), "T1");
+
+    // T1 is read again through its offset and T3, now the least recently used, makes room for it
+    BOOST_REQUIRE_EQUAL(fits::convert_to<binary_table>(budgeted[2]).get_data().size(), 100u);
+    auto& table = fits::convert_to<binary_table>(budgeted[1]);
+    BOOST_REQUIRE(table.get_data() == fits::convert_to<binary_table>(unlimited[1]).get_data());
+    BOOST_REQUIRE(!budgeted.is_data_resident(3));
+    BOOST_REQUIRE_EQUAL(budgeted.get_cache_statistics().hits, 1u);
+    BOOST_REQUIRE_EQUAL(budgeted.get_cache_statistics().misses, 1u);
+    BOOST_REQUIRE_EQUAL(budgeted.get_cache_statistics().evictions, 2u);
+
+    // Evicted HDUs are written with their data
+    std::string unlimited_copy = path + ".unlimited", budgeted_copy = path + ".budgeted";
+    unlimited.write_to(unlimited_copy);
+    budgeted.write_to(budgeted_copy);
+    BOOST_REQUIRE(read_file(budgeted_copy) == read_file(unlimited_copy));
+    BOOST_REQUIRE(!budgeted.is_data_resident(3));
+
+    remove(unlimited_copy.c_str());
+    remove(budgeted_copy.c_str());
+    remove(path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(lower_budget_after_reading, fits_test::fits_reader_fixture) {
+    std::string path = generate_tables("budget_lowered.fits");
+    {
+        fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> table_reader(path);
+        table_reader.read_entire_hdus();
+        BOOST_REQUIRE_EQUAL(table_reader.get_cache_statistics().resident_bytes, 2400u);
+
+        table_reader[3];
+        table_reader[1];
+        table_reader.set_memory_budget(800);
+        BOOST_REQUIRE(table_reader.is_data_resident(1));
+        BOOST_REQUIRE(!table_reader.is_data_resident(2) && !table_reader.is_data_resident(3));
+        BOOST_REQUIRE_EQUAL(table_reader.get_cache_statistics().resident_bytes, 800u);
+        BOOST_REQUIRE_EQUAL(table_reader.get_memory_budget(), 800u);
+
+        // A single HDU larger than the budget is still held while it is the most recently used one
+        table_reader.set_memory_budget(100);
+        BOOST_REQUIRE_EQUAL(table_reader.get_cache_statistics().resident_bytes, 0u);
+        BOOST_REQUIRE_EQUAL(fits::convert_to<binary_table>(table_reader[2]).get_data().size(), 100u);
+        BOOST_REQUIRE(table_reader.is_data_resident(2));
+
+        // Updating a cell accesses the HDU, T3 ( the last table named BINTABLE ) is read again in place of T2
+        std::size_t misses = table_reader.get_cache_statistics().misses;
+        table_reader.update_cell("BINTABLE", "COL1", 5, boost::int32_t(42));
+        BOOST_REQUIRE(table_reader.is_data_resident(3) && !table_reader.is_data_resident(2));
+        BOOST_REQUIRE_EQUAL(table_reader.get_cache_statistics().misses, misses + 1);
+        BOOST_REQUIRE_EQUAL(table_reader.get_cache_statistics().resident_bytes, 800u);
+        auto& updated = fits::convert_to<binary_table>(table_reader[3]);
+        BOOST_REQUIRE_EQUAL(static_cast<boost::int32_t>(updated.get_column<boost::int32_t>("COL1")[5]), 42);
+    }
+    remove(path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(reject_truncated_data_units, fits_test::fits_reader_fixture) {
+    std::string path = generate_tables("budget_truncated.fits");
+    {
+        fits_io<fits_stream, default_hdu_manager<card_policy, ascii_converter, binary_data_converter>> table_reader(path);
+        table_reader.set_memory_budget(800);
+        table_reader.read_entire_hdus();
+        BOOST_REQUIRE(!table_reader.is_data_resident(1));
+
+        // The file loses the end of T1 after it was evicted, so it cannot be read again
+        std::string contents = read_file(path);
+        std::ofstream truncated(path, std::ios::binary | std::ios::trunc);
+        truncated << contents.substr(0, table_reader.get_control_block_info().hdus[1].data_location + 100);
+        truncated.close();
+        BOOST_REQUIRE_THROW(table_reader[1], boost::astronomy::file_reading_exception);
+    }
+    remove(path.c_str());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
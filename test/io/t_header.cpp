@@ -103,4 +103,22 @@ BOOST_FIXTURE_TEST_CASE(value_of_floating, fits_test::hdu_fixture) {
 BOOST_FIXTURE_TEST_CASE(card_count, fits_test::hdu_fixture) {
     BOOST_REQUIRE_EQUAL(sample_1.card_count(), static_cast<std::size_t>(262));
 }
+
+BOOST_FIXTURE_TEST_CASE(copies_are_independent, fits_test::hdu_fixture) {
+    header<card_policy> copied_header = sample_1;
+    BOOST_REQUIRE(copied_header == sample_1);
+
+    copied_header.set_value_of("GPIXELS", 10);
+    card<card_policy> new_card;
+    new_card.create_card("NEWKEY", 5);
+    copied_header.add_card(new_card);
+
+    BOOST_REQUIRE_EQUAL(sample_1.value_of<int>("GPIXELS"), 632387);
+    BOOST_REQUIRE(!sample_1.contains_keyword("NEWKEY"));
+    BOOST_REQUIRE_EQUAL(copied_header.value_of<int>("GPIXELS"), 10);
+    BOOST_REQUIRE_EQUAL(copied_header.value_of<int>("NEWKEY"), 5);
+    BOOST_REQUIRE_EQUAL(copied_header.card_count(), static_cast<std::size_t>(263));
+    BOOST_REQUIRE_EQUAL(copied_header.get_card(copied_header.card_count()).keyword(), "END");
+    BOOST_REQUIRE_EQUAL(copied_header.raw_records().size() % 2880, 0u);
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,155 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE header_editor_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/header_editor.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <fstream>
+#include <iterator>
+#include <stdio.h>
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    class header_editor_fixture {
+        std::string samples_directory;
+    public:
+        header_editor_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+        }
+
+        std::string get_path(const std::string& file_name) {
+            return samples_directory + file_name;
+        }
+
+        std::string copy_sample(const std::string& sample_name, const std::string& copy_name) {
+            std::string copy_path = samples_directory + copy_name;
+            std::ifstream source(samples_directory + sample_name, std::ios::binary);
+            std::ofstream destination(copy_path, std::ios::binary | std::ios::trunc);
+            destination << source.rdbuf();
+            return copy_path;
+        }
+
+        std::string read_file(const std::string& path) {
+            std::ifstream file(path, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(header_editor_methods)
+
+BOOST_FIXTURE_TEST_CASE(edit_fits_in_header_records, fits_test::header_editor_fixture) {
+    std::string copy_path = copy_sample("fits_sample1.fits", "edited_in_place.fits");
+    std::string original = read_file(copy_path);
+
+    header_editor editor;
+    editor.set_value("GPIXELS", 1234).set_value("OBSERVER", std::string("Hubble"));
+    auto result = editor.apply(copy_path);
+
+    BOOST_REQUIRE(result.success);
+    BOOST_REQUIRE(result.in_place);
+
+    std::string edited = read_file(copy_path);
+    BOOST_REQUIRE_EQUAL(edited.size(), original.size());
+    BOOST_REQUIRE(edited.compare(8 * 2880, std::string::npos, original, 8 * 2880, std::string::npos) == 0);
+
+    auto astro_data = fits::open(copy_path);
+    auto& prime_hdu = fits::convert_to<primary_hdu>(astro_data["primary_hdu"]);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().value_of<int>("GPIXELS"), 1234);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().value_of<std::string>("OBSERVER"), "Hubble");
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().card_count(), 263);
+
+    remove(copy_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(shift_data_when_header_grows, fits_test::header_editor_fixture) {
+    std::string copy_path = copy_sample("fits_sample1.fits", "edited_shifted.fits");
+    std::string original = read_file(copy_path);
+
+    // Primary header has 25 free card slots
+    header_editor editor(2880 * 3);
+    for (int i = 0; i < 30; i++) {
+        editor.set_value("KEY" + std::to_string(i), i);
+    }
+    auto result = editor.apply(copy_path);
+
+    BOOST_REQUIRE(result.success);
+    BOOST_REQUIRE(!result.in_place);
+    BOOST_REQUIRE_EQUAL(result.records_inserted, 1u);
+
+    std::string edited = read_file(copy_path);
+    BOOST_REQUIRE_EQUAL(edited.size(), original.size() + 2880);
+    BOOST_REQUIRE(edited.compare(9 * 2880, std::string::npos, original, 8 * 2880, std::string::npos) == 0);
+
+    auto astro_data = fits::open(copy_path);
+    auto& prime_hdu = fits::convert_to<primary_hdu>(astro_data["primary_hdu"]);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().value_of<int>("KEY29"), 29);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_header().card_count(), 292);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_data<bitpix::_B32>().size(), 160000);
+    BOOST_REQUIRE_EQUAL(astro_data.get_hdu_list().size(), 2u);
+
+    remove(copy_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(edit_extension_header, fits_test::header_editor_fixture) {
+    std::string copy_path = copy_sample("fits_sample1.fits", "edited_extension.fits");
+
+    header_editor editor;
+    editor.set_value("EXTNAME", std::string("GROUPS"));
+    BOOST_REQUIRE(editor.apply(copy_path, 1).success);
+    BOOST_REQUIRE_THROW(editor.apply(copy_path, 2), boost::astronomy::fits_exception);
+
+    // Keywords locating the data unit or its fields are never edited, the header stays consistent with the data
+    for (std::string keyword : { "NAXIS", "NAXIS2", "BITPIX", "PCOUNT", "TBCOL3", "TFORM12" }) {
+        BOOST_REQUIRE_THROW(editor.set_value(keyword, 5), boost::astronomy::structural_keyword_exception);
+    }
+    BOOST_REQUIRE_EQUAL(editor.total_edits(), 1u);
+
+    auto astro_data = fits::open(copy_path);
+    auto& table = fits::convert_to<ascii_table>(astro_data["TABLE"]);
+    BOOST_REQUIRE_EQUAL(table.get_header().value_of<std::string>("EXTNAME"), "GROUPS");
+
+    remove(copy_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(edit_many_files_in_parallel, fits_test::header_editor_fixture) {
+    std::vector<std::string> paths;
+    for (int i = 0; i < 8; i++) {
+        paths.push_back(copy_sample("fits_sample2.fits", "batch_" + std::to_string(i) + ".fits"));
+    }
+    paths.push_back(get_path("missing_file.fits"));
+
+    header_editor editor;
+    editor.set_value("TAGGED", true, "re-tagged by batch");
+    auto results = editor.apply_all(paths, 0, 4);
+
+    BOOST_REQUIRE_EQUAL(results.size(), paths.size());
+    for (std::size_t i = 0; i + 1 < paths.size(); i++) {
+        BOOST_REQUIRE(results[i].success);
+        BOOST_REQUIRE_EQUAL(results[i].path, paths[i]);
+
+        auto astro_data = fits::open(paths[i], reading_options::read_only_headers);
+        auto& prime_hdu = fits::convert_to<primary_hdu>(astro_data["primary_hdu"]);
+        BOOST_REQUIRE(prime_hdu.get_header().value_of<bool>("TAGGED"));
+        remove(paths[i].c_str());
+    }
+    BOOST_REQUIRE(!results.back().success);
+    BOOST_REQUIRE(!results.back().error.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,136 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE image_expression_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/image_expression.hpp>
+#include <boost/astronomy/io/binary_data_converter.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    class image_expression_fixture {
+    public:
+        /**
+         * @brief Creates an image whose pixels follow an irregular pattern of values of both signs
+        */
+        template<typename PixelType>
+        image_buffer<PixelType> make_image(std::size_t width, std::size_t height, int offset) const {
+            image_buffer<PixelType> image(width, height);
+            for (std::size_t i = 0; i < image.size(); i++) {
+                image.data()[i] = static_cast<PixelType>(static_cast<int>((i * 7919) % 509) - offset);
+            }
+            return image;
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(image_expression)
+
+BOOST_FIXTURE_TEST_CASE(calibration_matches_pixel_by_pixel, fits_test::image_expression_fixture) {
+    auto raw = make_image<std::int16_t>(301, 97, 200);
+    auto bias = make_image<float>(301, 97, 30);
+    image_buffer<double> flat(301, 97);
+    for (std::size_t i = 0; i < flat.size(); i++) { flat.data()[i] = 0.5 + static_cast<double>(i % 13) / 10; }
+    const double gain = 1.7;
+
+    auto calibration = (raw - bias) / flat * gain;
+    static_assert(std::is_same<decltype(calibration)::value_type, double>::value, "Mixed pixels combine as double");
+    static_assert(std::is_same<decltype(bias * 2.0 - bias)::value_type, float>::value, "Float pixels combine as float");
+
+    for (std::size_t threads : { 1u, 3u }) {
+        image_buffer<double> calibrated = evaluate(calibration, threads);
+        auto rounded = evaluate<std::int16_t>(calibration * 300, threads);
+        BOOST_REQUIRE_EQUAL(calibrated.width(), 301u);
+        BOOST_REQUIRE_EQUAL(calibrated.height(), 97u);
+        for (std::size_t i = 0; i < raw.size(); i++) {
+            double expected = (static_cast<double>(raw.data()[i]) - static_cast<double>(bias.data()[i])) / flat.data()[i] * gain;
+            BOOST_REQUIRE_SMALL(calibrated.data()[i] - expected, 1e-12);
+            BOOST_REQUIRE_EQUAL(rounded.data()[i], detail::pixel_cast<std::int16_t>(expected * 300));
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(scalars_clamp_and_where, fits_test::image_expression_fixture) {
+    auto frame = make_image<float>(40, 30, 250);
+    frame.data()[7] = std::numeric_limits<float>::quiet_NaN();
+    image_buffer<std::uint8_t> mask(40, 30);
+    for (std::size_t i = 0; i < mask.size(); i++) { mask.data()[i] = static_cast<std::uint8_t>(i % 3 == 0 ? 0 : 4); }
+
+    auto mixed = evaluate<float>(2.0f - frame / 4 + -frame);
+    auto clamped = evaluate<float>(clamp(frame, -10, 10));
+    auto chosen = evaluate<float>(where(mask, frame * 2, 100));
+    auto flags = evaluate<std::int32_t>(where(frame, 1, 0));
+    for (std::size_t i = 0; i < frame.size(); i++) {
+        float pixel = frame.data()[i];
+        if (i == 7) {
+            BOOST_REQUIRE(std::isnan(mixed.data()[i]) && std::isnan(clamped.data()[i]));
+            BOOST_REQUIRE_EQUAL(flags.data()[i], 1);
+            continue;
+        }
+        BOOST_REQUIRE_EQUAL(mixed.data()[i], 2.0f - pixel / 4 + -pixel);
+        BOOST_REQUIRE_EQUAL(clamped.data()[i], std::min(10.0f, std::max(-10.0f, pixel)));
+        BOOST_REQUIRE_EQUAL(chosen.data()[i], i % 3 == 0 ? 100.0f : 2 * pixel);
+        BOOST_REQUIRE_EQUAL(flags.data()[i], pixel < 0 || pixel > 0 ? 1 : 0);
+    }
+
+    // Tiles of larger images combine with whole images of the tile dimensions
+    auto large = make_image<std::int32_t>(100, 80, 0);
+    image_view<std::int32_t> tile = make_image_view(large).tile(10, 20, 40, 30);
+    auto sums = evaluate<std::int32_t>(tile + frame, 2);
+    for (std::size_t y = 0; y < 30; y++) {
+        for (std::size_t x = 0; x < 40; x++) {
+            if (y * 40 + x == 7) { continue; }
+            BOOST_REQUIRE_EQUAL(sums.data()[y * 40 + x],
+                detail::pixel_cast<std::int32_t>(static_cast<double>(tile(x, y)) + static_cast<double>(frame.data()[y * 40 + x])));
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(destinations_and_dimensions, fits_test::image_expression_fixture) {
+    auto frame = make_image<double>(25, 20, 100);
+    auto original = frame;
+
+    // Every pixel depends only on the pixels at its position, so an operand may be overwritten
+    evaluate(frame * frame - 1, frame);
+    for (std::size_t i = 0; i < frame.size(); i++) {
+        BOOST_REQUIRE_EQUAL(frame.data()[i], original.data()[i] * original.data()[i] - 1);
+    }
+
+    // A destination of other dimensions takes those of the expression
+    image_buffer<std::uint8_t> saturated(3, 3);
+    evaluate(original * 10, saturated);
+    BOOST_REQUIRE_EQUAL(saturated.width(), 25u);
+    BOOST_REQUIRE_EQUAL(saturated.size(), 500u);
+    for (std::size_t i = 0; i < saturated.size(); i++) {
+        BOOST_REQUIRE_EQUAL(saturated.data()[i], detail::pixel_cast<std::uint8_t>(original.data()[i] * 10));
+    }
+
+    // Integer results are rounded to nearest even and saturated, NaN becomes 0
+    image_buffer<double> edges(8, 1);
+    double values[] = { 0.5, 1.5, -2.5, 2.4999, 40000, -1e300, std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::infinity() };
+    std::int16_t expected[] = { 0, 2, -2, 2, 32767, -32768, 0, 32767 };
+    for (std::size_t i = 0; i < 8; i++) { edges.data()[i] = values[i]; }
+    auto converted = evaluate<std::int16_t>(edges + 0);
+    for (std::size_t i = 0; i < 8; i++) { BOOST_REQUIRE_EQUAL(converted.data()[i], expected[i]); }
+
+    image_buffer<float> narrower(24, 20);
+    BOOST_REQUIRE_THROW(frame + narrower, std::invalid_argument);
+    BOOST_REQUIRE_THROW(where(narrower, frame, 0), std::invalid_argument);
+    image<bitpix::_B32, binary_data_converter> unknown_dimensions;
+    unknown_dimensions.read_image(std::string(16, '\0'));
+    BOOST_REQUIRE_THROW(unknown_dimensions * 2, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,157 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE image_histogram_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/image_histogram.hpp>
+#include "sky_fixture.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    class image_histogram_fixture : public sky_fixture {
+    public:
+        image_histogram_fixture() : sky_fixture(42) {}
+
+        /**
+         * @brief Quantile of the finite pixels computed by sorting them, as numpy.quantile does
+        */
+        template<typename PixelType>
+        double sorted_quantile(const image_buffer<PixelType>& image, double probability) const {
+            std::vector<double> values = sorted_values(image);
+            double position = probability * static_cast<double>(values.size() - 1);
+            std::size_t rank = static_cast<std::size_t>(position);
+            double fraction = position - static_cast<double>(rank);
+            return rank + 1 < values.size() ? values[rank] + fraction * (values[rank + 1] - values[rank]) : values[rank];
+        }
+
+        template<typename PixelType>
+        void check_exact_quantiles(const image_buffer<PixelType>& image) const {
+            std::vector<double> probabilities = { 0.0, 0.01, 0.25, 0.5, 0.7531, 0.99, 1.0 };
+            for (std::size_t threads : { 1u, 4u }) {
+                std::vector<double> quantiles = exact_quantiles(image, probabilities, threads);
+                for (std::size_t i = 0; i < probabilities.size(); i++) {
+                    check_close(quantiles[i], sorted_quantile(image, probabilities[i]));
+                }
+            }
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(image_histogram)
+
+BOOST_FIXTURE_TEST_CASE(integer_histograms_count_every_value, fits_test::image_histogram_fixture) {
+    image_buffer<std::int16_t> image(300, 200);
+    for (std::size_t i = 0; i < image.size(); i++) { image.data()[i] = static_cast<std::int16_t>(static_cast<int>(i % 1000) - 500); }
+
+    histogram_options options;
+    options.threads = 3;
+    pixel_histogram histogram = make_histogram(make_image_view(image), options);
+    BOOST_REQUIRE(histogram.exact());
+    BOOST_REQUIRE_EQUAL(histogram.bins(), 1000u);
+    BOOST_REQUIRE_EQUAL(histogram.total(), 60000u);
+    BOOST_REQUIRE_EQUAL(histogram.minimum(), -500.0);
+    BOOST_REQUIRE_EQUAL(histogram.maximum(), 499.0);
+    for (std::size_t bin = 0; bin < histogram.bins(); bin++) { BOOST_REQUIRE_EQUAL(histogram.counts()[bin], 60u); }
+    BOOST_REQUIRE_EQUAL(histogram.quantile(0.5), sorted_quantile(image, 0.5));
+    BOOST_REQUIRE_EQUAL(histogram.quantile(0.0), -500.0);
+    BOOST_REQUIRE_EQUAL(histogram.quantile(1.0), 499.0);
+
+    // A narrower limit widens the bins to powers of two
+    options.max_bins = 100;
+    pixel_histogram coarse = make_histogram(image, options);
+    BOOST_REQUIRE(!coarse.exact());
+    BOOST_REQUIRE_EQUAL(coarse.width(), 16.0);
+    BOOST_REQUIRE_EQUAL(coarse.bins(), 63u);
+    BOOST_REQUIRE_SMALL(coarse.quantile(0.3) - sorted_quantile(image, 0.3), 8.0);
+
+    BOOST_REQUIRE_THROW(histogram.quantile(1.5), std::invalid_argument);
+    BOOST_REQUIRE_THROW(pixel_histogram().quantile(0.5), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(float_histograms_skip_unusable_pixels, fits_test::image_histogram_fixture) {
+    auto image = make_sky<float>(256, 128, 1000.0, 10.0);
+    image.data()[5] = std::numeric_limits<float>::quiet_NaN();
+    image.data()[6] = std::numeric_limits<float>::infinity();
+
+    pixel_histogram histogram = make_histogram(image);
+    BOOST_REQUIRE_EQUAL(histogram.total(), image.size() - 2);
+    BOOST_REQUIRE(std::isfinite(histogram.maximum()));
+    BOOST_REQUIRE_SMALL(histogram.quantile(0.5) - sorted_quantile(image, 0.5), histogram.width());
+    BOOST_REQUIRE_SMALL(histogram.quantile(0.99) - sorted_quantile(image, 0.99), histogram.width());
+
+    // Sampling every pixel at a stride keeps the estimate close
+    histogram_options options;
+    options.max_samples = 5000;
+    pixel_histogram sampled = make_histogram(image, options);
+    BOOST_REQUIRE_EQUAL(sampled.sample_stride(), 7u);
+    BOOST_REQUIRE(sampled.total() <= 5000u);
+    BOOST_REQUIRE_SMALL(sampled.quantile(0.5) - sorted_quantile(image, 0.5), 1.0);
+
+    image_buffer<double> constant(10, 10);
+    for (std::size_t i = 0; i < constant.size(); i++) { constant.data()[i] = 3.25; }
+    pixel_histogram single = make_histogram(constant);
+    BOOST_REQUIRE_EQUAL(single.bins(), 1u);
+    BOOST_REQUIRE_EQUAL(single.quantile(0.9), 3.25);
+}
+
+BOOST_FIXTURE_TEST_CASE(exact_quantiles_match_sorting, fits_test::image_histogram_fixture) {
+    check_exact_quantiles(make_sky<std::int8_t>(100, 77, 2.0, 20.0));
+    check_exact_quantiles(make_sky<std::int16_t>(100, 77, 1000.0, 300.0));
+    check_exact_quantiles(make_sky<std::int32_t>(100, 77, -50000.0, 100000.0));
+    check_exact_quantiles(make_sky<double>(100, 77, 0.0, 1.0));
+
+    // Most pixels share their top 16 bits, so the selection refines the keys before gathering pixels
+    auto narrow = make_sky<float>(700, 600, 1000.0, 0.5);
+    narrow.data()[17] = std::numeric_limits<float>::quiet_NaN();
+    narrow.data()[18] = -0.0f;
+    check_exact_quantiles(narrow);
+
+    BOOST_REQUIRE_EQUAL(exact_quantile(make_image_view(narrow), 0.0), 0.0);
+    BOOST_REQUIRE_THROW(exact_quantiles(narrow, { -0.1 }), std::invalid_argument);
+
+    image_buffer<float> unusable(2, 1);
+    unusable.data()[0] = unusable.data()[1] = std::numeric_limits<float>::quiet_NaN();
+    BOOST_REQUIRE_THROW(exact_quantiles(unusable, { 0.5 }), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(display_ranges, fits_test::image_histogram_fixture) {
+    auto sky = make_sky<float>(512, 512, 1000.0, 10.0);
+
+    display_range percentiles = percentile_range(make_image_view(sky), 0.01, 0.99);
+    BOOST_REQUIRE_SMALL(percentiles.lower - sorted_quantile(sky, 0.01), 1.5);
+    BOOST_REQUIRE_SMALL(percentiles.upper - sorted_quantile(sky, 0.99), 1.5);
+
+    // zscale ignores the outliers and spans several standard deviations of the background
+    display_range range = zscale(sky);
+    BOOST_REQUIRE(range.lower > 900.0 && range.lower < 990.0);
+    BOOST_REQUIRE(range.upper > 1010.0 && range.upper < 1100.0);
+
+    // Without rejection and with a contrast of one the range follows the line through the sorted samples
+    image_buffer<double> ramp(1000, 1);
+    for (std::size_t i = 0; i < ramp.size(); i++) { ramp.data()[i] = 2.0 * static_cast<double>(i); }
+    zscale_options options;
+    options.contrast = 1.0;
+    display_range linear = zscale(ramp, options);
+    BOOST_REQUIRE_SMALL(linear.lower - 3.0, 1e-6);
+    BOOST_REQUIRE_EQUAL(linear.upper, 1998.0);
+
+    image_buffer<std::int16_t> tiny(2, 1);
+    tiny.data()[0] = 7;
+    tiny.data()[1] = 3;
+    display_range limits = zscale(tiny);
+    BOOST_REQUIRE_EQUAL(limits.lower, 3.0);
+    BOOST_REQUIRE_EQUAL(limits.upper, 7.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,302 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE image_resampling_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/image_resampling.hpp>
+#include <boost/astronomy/io/image_stacking.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/fits_generator.hpp>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <stdio.h>
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    class image_resampling_fixture {
+    public:
+        std::string samples_directory;
+
+        image_resampling_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+        }
+
+        /**
+         * @brief Creates an image whose pixels follow an irregular pattern of values of both signs
+        */
+        template<typename PixelType>
+        image_buffer<PixelType> make_image(std::size_t width, std::size_t height) const {
+            image_buffer<PixelType> image(width, height);
+            for (std::size_t i = 0; i < image.size(); i++) {
+                image.data()[i] = static_cast<PixelType>(static_cast<int>((i * 7919) % 255) - 100);
+            }
+            return image;
+        }
+
+        /**
+         * @brief Bins an image one pixel at a time
+        */
+        template<typename PixelType>
+        std::vector<double> bin_directly(const image_buffer<PixelType>& image, std::size_t factor_x,
+            std::size_t factor_y, bool mean) const {
+            std::size_t output_width = image.width() / factor_x, output_height = image.height() / factor_y;
+            std::vector<double> binned(output_width * output_height, 0.0);
+            for (std::size_t y = 0; y < output_height * factor_y; y++) {
+                for (std::size_t x = 0; x < output_width * factor_x; x++) {
+                    binned[(y / factor_y) * output_width + x / factor_x] +=
+                        static_cast<double>(image.data()[y * image.width() + x]);
+                }
+            }
+            if (mean) {
+                for (double& value : binned) { value /= static_cast<double>(factor_x * factor_y); }
+            }
+            return binned;
+        }
+
+        template<typename Result>
+        void check_close(const Result* values, const Result* expected, std::size_t count, double tolerance) const {
+            for (std::size_t i = 0; i < count; i++) {
+                BOOST_REQUIRE_SMALL(static_cast<double>(values[i]) - static_cast<double>(expected[i]), tolerance);
+            }
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(image_resampling)
+
+BOOST_FIXTURE_TEST_CASE(read_images_know_their_dimensions, fits_test::image_resampling_fixture) {
+    std::string path = samples_directory + "resampling_dimensions.fits";
+    {
+        fits_generator generator(path, 3);
+        generator.write_primary_image(bitpix::B16, { 100, 60 });
+        generator.close();
+    }
+
+    auto reader = fits::open(path);
+    auto& prime_hdu = fits::convert_to<primary_hdu>(reader["primary_hdu"]);
+    auto image = prime_hdu.get_data<bitpix::B16>();
+    BOOST_REQUIRE_EQUAL(image.width(), 100u);
+    BOOST_REQUIRE_EQUAL(image.height(), 60u);
+
+    image_view<std::int16_t> view = make_image_view(image);
+    BOOST_REQUIRE_EQUAL(view.size(), 6000u);
+    BOOST_REQUIRE_THROW(view.tile(90, 0, 11, 1), std::out_of_range);
+    BOOST_REQUIRE_THROW(image.set_dimensions(99, 60), std::invalid_argument);
+
+    remove(path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(binning_matches_pixel_by_pixel_sums, fits_test::image_resampling_fixture) {
+    auto integers = make_image<std::int16_t>(37, 23);
+    auto reals = make_image<float>(37, 23);
+
+    for (bool mean : { false, true }) {
+        binning_mode mode = mean ? binning_mode::mean : binning_mode::sum;
+        std::vector<double> expected = bin_directly(integers, 3, 2, mean);
+
+        auto binned = bin_image(integers, 3, 2, mode, 4);
+        BOOST_REQUIRE_EQUAL(binned.width(), 12u);
+        BOOST_REQUIRE_EQUAL(binned.height(), 11u);
+        check_close(binned.data(), expected.data(), expected.size(), 1e-9);
+
+        auto binned_reals = bin_image(reals, 3, 2, mode, 1);
+        check_close(binned_reals.data(), expected.data(), expected.size(), 1e-4);
+
+        // Integer results are rounded to the nearest value
+        auto rounded = bin_image<std::int16_t>(integers, 3, 2, mode);
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            BOOST_REQUIRE_EQUAL(rounded.data()[i], static_cast<std::int16_t>(std::nearbyint(expected[i])));
+        }
+    }
+
+    // Sums which do not fit in the pixel type saturate
+    image_buffer<std::int16_t> bright(4, 4);
+    for (std::size_t i = 0; i < bright.size(); i++) { bright.data()[i] = 30000; }
+    auto saturated = bin_image<std::int16_t>(bright, 2, 2, binning_mode::sum);
+    BOOST_REQUIRE_EQUAL(saturated.data()[0], 32767);
+
+    BOOST_REQUIRE_THROW(bin_image(integers, 0, 2), std::invalid_argument);
+
+    // Pixels read without a header have no known dimensions
+    image<bitpix::_B32, binary_data_converter> unknown_dimensions;
+    unknown_dimensions.read_image(std::string(16, '\0'));
+    BOOST_REQUIRE_THROW(bin_image(unknown_dimensions, 2, 2), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(downsampling_keeps_first_pixel_of_blocks, fits_test::image_resampling_fixture) {
+    auto image = make_image<std::int32_t>(10, 9);
+    auto downsampled = downsample_image(image, 3, 2, 2);
+    BOOST_REQUIRE_EQUAL(downsampled.width(), 3u);
+    BOOST_REQUIRE_EQUAL(downsampled.height(), 4u);
+    for (std::size_t y = 0; y < 4; y++) {
+        for (std::size_t x = 0; x < 3; x++) {
+            BOOST_REQUIRE_EQUAL(downsampled.data()[y * 3 + x], image.data()[(2 * y) * 10 + 3 * x]);
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(resampling_preserves_constant_and_linear_images, fits_test::image_resampling_fixture) {
+    image_buffer<float> constant(50, 40);
+    image_buffer<double> ramp(50, 40);
+    for (std::size_t i = 0; i < constant.size(); i++) {
+        constant.data()[i] = 12.5f;
+        ramp.data()[i] = static_cast<double>(i % 50);
+    }
+
+    for (interpolation method : { interpolation::bilinear, interpolation::lanczos3 }) {
+        for (std::size_t width : { 17u, 50u, 123u }) {
+            auto resampled = resample_image(constant, width, 71, method, 3);
+            for (std::size_t i = 0; i < resampled.size(); i++) {
+                BOOST_REQUIRE_SMALL(resampled.data()[i] - 12.5, 1e-9);
+            }
+        }
+
+        // Resampling to the same dimensions reproduces the image
+        auto same = resample_image(ramp, 50, 40, method);
+        check_close(same.data(), ramp.data(), ramp.size(), 1e-9);
+    }
+
+    // Away from the edges bilinear interpolation of a ramp gives the ramp at the mapped position
+    auto enlarged = resample_image(ramp, 100, 40, interpolation::bilinear);
+    for (std::size_t x = 2; x < 98; x++) {
+        BOOST_REQUIRE_SMALL(enlarged.data()[5 * 100 + x] - ((static_cast<double>(x) + 0.5) / 2 - 0.5), 1e-9);
+    }
+
+    auto rounded = resample_image<std::int16_t>(constant, 25, 20, interpolation::lanczos3);
+    BOOST_REQUIRE_EQUAL(rounded.data()[0], 12);
+    BOOST_REQUIRE_THROW(resample_image(image_buffer<float>(0, 0), 4, 4), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(streaming_matches_whole_image, fits_test::image_resampling_fixture) {
+    auto image = make_image<float>(61, 47);
+    for (std::size_t block_rows : { 1u, 7u, 47u }) {
+        image_binner<double> binner(61, 4, 3, binning_mode::mean);
+        std::vector<double> binned;
+        for (std::size_t y = 0; y < 47; y += block_rows) {
+            binner.push_rows(image.data() + y * 61, std::min<std::size_t>(block_rows, 47 - y),
+                [&](const double* row) { binned.insert(binned.end(), row, row + binner.output_width()); });
+        }
+        auto expected = bin_image(image, 4, 3, binning_mode::mean);
+        BOOST_REQUIRE_EQUAL(binned.size(), expected.size());
+        check_close(binned.data(), expected.data(), expected.size(), 1e-9);
+
+        for (auto dimensions : { std::make_pair(23u, 19u), std::make_pair(130u, 101u) }) {
+            image_resampler<double> resampler(61, 47, dimensions.first, dimensions.second, interpolation::lanczos3);
+            std::vector<double> resampled;
+            for (std::size_t y = 0; y < 47; y += block_rows) {
+                resampler.push_rows(image.data() + y * 61, std::min<std::size_t>(block_rows, 47 - y),
+                    [&](const double* row) { resampled.insert(resampled.end(), row, row + dimensions.first); });
+            }
+            BOOST_REQUIRE(resampler.finished());
+            auto whole = resample_image(image, dimensions.first, dimensions.second, interpolation::lanczos3);
+            BOOST_REQUIRE_EQUAL(resampled.size(), whole.size());
+            check_close(resampled.data(), whole.data(), whole.size(), 1e-9);
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(bin_and_resample_files, fits_test::image_resampling_fixture) {
+    std::string source_path = samples_directory + "resampling_source.fits";
+    std::string binned_path = samples_directory + "resampling_binned.fits";
+    std::string resampled_path = samples_directory + "resampling_resampled.fits";
+    {
+        fits_generator generator(source_path, 11);
+        generator.write_primary_image(bitpix::B32, { 64, 50 });
+        generator.close();
+    }
+    auto source_file = fits::open(source_path);
+    auto source = fits::convert_to<primary_hdu>(source_file["primary_hdu"]).get_data<bitpix::B32>();
+
+    bin_image_file(source_path, 0, binned_path, 4, 4, binning_mode::mean, bitpix::_B64, 5);
+    auto binned_file = fits::open(binned_path);
+    auto binned = fits::convert_to<primary_hdu>(binned_file["primary_hdu"]).get_data<bitpix::_B64>();
+    auto expected = bin_image(source, 4, 4);
+    BOOST_REQUIRE_EQUAL(binned.width(), 16u);
+    BOOST_REQUIRE_EQUAL(binned.height(), 12u);
+    check_close(binned.data(), expected.data(), expected.size(), 1e-3);
+
+    resample_image_file(source_path, 0, resampled_path, 20, 30, interpolation::bilinear, bitpix::B32, 3);
+    auto resampled_file = fits::open(resampled_path);
+    auto resampled = fits::convert_to<primary_hdu>(resampled_file["primary_hdu"]).get_data<bitpix::B32>();
+    auto expected_resampled = resample_image<std::int32_t>(source, 20, 30);
+    BOOST_REQUIRE_EQUAL(resampled.size(), 600u);
+    check_close(resampled.data(), expected_resampled.data(), expected_resampled.size(), 0.5);
+
+    BOOST_REQUIRE_THROW(bin_image_file(source_path, 1, binned_path, 2, 2), boost::astronomy::file_reading_exception);
+
+    remove(source_path.c_str());
+    remove(binned_path.c_str());
+    remove(resampled_path.c_str());
+}
+
+BOOST_FIXTURE_TEST_CASE(frames_after_tables_with_a_heap, fits_test::image_resampling_fixture) {
+    std::string source_path = samples_directory + "resampling_after_heap.fits";
+    std::string binned_path = samples_directory + "resampling_after_heap_binned.fits";
+    std::string resampled_path = samples_directory + "resampling_after_heap_resampled.fits";
+    std::string stacked_path = samples_directory + "resampling_after_heap_stacked.fits";
+    {
+        // The table has neither EXTNAME nor a heap fitting into its last logical record
+        fits_generator generator(source_path, 5);
+        generator.write_primary_hdu();
+        generator.write_binary_table(10, { "J" }, "", 6000);
+        generator.write_image_extension(bitpix::B16, { 24, 18 });
+        generator.close();
+    }
+
+    // Headers of the primary HDU, the table and the image, then 10 * 4 + 6000 bytes of table in 3 records
+    image_buffer<std::int16_t> source(24, 18);
+    {
+        std::ifstream raw(source_path, std::ios::binary);
+        raw.seekg(6 * 2880);
+        std::string bytes(source.size() * 2, '\0');
+        raw.read(&bytes[0], static_cast<std::streamsize>(bytes.size()));
+        BOOST_REQUIRE(raw);
+        for (std::size_t i = 0; i < source.size(); i++) {
+            source.data()[i] = detail::load_big_endian<std::int16_t, std::uint16_t>(bytes.data() + 2 * i);
+        }
+    }
+
+    bin_image_file(source_path, 2, binned_path, 3, 2, binning_mode::mean, bitpix::_B64);
+    auto binned_file = fits::open(binned_path);
+    auto binned = fits::convert_to<primary_hdu>(binned_file["primary_hdu"]).get_data<bitpix::_B64>();
+    auto expected = bin_directly(source, 3, 2, true);
+    BOOST_REQUIRE_EQUAL(binned.size(), expected.size());
+    check_close(binned.data(), expected.data(), expected.size(), 1e-9);
+
+    resample_image_file(source_path, 2, resampled_path, 10, 7, interpolation::bilinear, bitpix::B32);
+    auto resampled_file = fits::open(resampled_path);
+    auto resampled = fits::convert_to<primary_hdu>(resampled_file["primary_hdu"]).get_data<bitpix::B32>();
+    auto expected_resampled = resample_image<std::int32_t>(source, 10, 7);
+    check_close(resampled.data(), expected_resampled.data(), expected_resampled.size(), 0.5);
+
+    stack_image_files({ source_path, source_path }, 2, stacked_path);
+    auto stacked_file = fits::open(stacked_path);
+    auto stacked = fits::convert_to<primary_hdu>(stacked_file["primary_hdu"]).get_data<bitpix::_B32>();
+    for (std::size_t i = 0; i < source.size(); i++) {
+        BOOST_REQUIRE_EQUAL(stacked.data()[i], static_cast<float>(source.data()[i]));
+    }
+
+    BOOST_REQUIRE_THROW(bin_image_file(source_path, 3, binned_path, 2, 2), boost::astronomy::file_reading_exception);
+
+    remove(source_path.c_str());
+    remove(binned_path.c_str());
+    remove(resampled_path.c_str());
+    remove(stacked_path.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
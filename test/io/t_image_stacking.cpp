@@ -0,0 +1,235 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE image_stacking_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/image_stacking.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include "sky_fixture.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <numeric>
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    class image_stacking_fixture : public sky_fixture {
+    public:
+        std::string samples_directory;
+        std::vector<std::string> frame_paths;
+        std::string stacked_path;
+
+        image_stacking_fixture() : sky_fixture(11) {
+#ifdef SOURCE_DIR
+            samples_directory = std::string(SOURCE_DIR) + "/fits_sample_files/";
+#else
+            samples_directory = std::string(boost::unit_test::framework::master_test_suite().argv[1]);
+#endif
+            stacked_path = samples_directory + "stacked.fits";
+        }
+
+        ~image_stacking_fixture() {
+            for (auto const& path : frame_paths) { std::remove(path.c_str()); }
+            std::remove(stacked_path.c_str());
+        }
+
+        /**
+         * @brief Creates frames of the same sky, each with its own outliers
+        */
+        template<typename PixelType>
+        std::vector<image_buffer<PixelType>> make_frames(std::size_t count, std::size_t width, std::size_t height) {
+            std::vector<image_buffer<PixelType>> frames;
+            for (std::size_t frame = 0; frame < count; frame++) {
+                frames.push_back(make_sky<PixelType>(width, height, 1000.0, 20.0, 37 * frame));
+            }
+            return frames;
+        }
+
+        template<typename PixelType>
+        std::vector<image_view<PixelType>> views_of(std::vector<image_buffer<PixelType>> const& frames) const {
+            std::vector<image_view<PixelType>> views;
+            for (auto const& frame : frames) { views.push_back(make_image_view(frame)); }
+            return views;
+        }
+
+        /**
+         * @brief Combines the usable values of a single pixel the straightforward way
+        */
+        double combine_directly(std::vector<double> values, stack_options const& options) const {
+            values.erase(std::remove_if(values.begin(), values.end(), [](double v) { return !std::isfinite(v); }), values.end());
+            if (values.empty()) { return std::numeric_limits<double>::quiet_NaN(); }
+            std::sort(values.begin(), values.end());
+            switch (options.method) {
+            case stack_method::mean:
+                return std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+            case stack_method::median:
+                return 0.5 * (values[(values.size() - 1) / 2] + values[values.size() / 2]);
+            default: {
+                image_buffer<double> pixel(values.size(), 1);
+                std::copy(values.begin(), values.end(), pixel.data());
+                sigma_clip_options clipping = options.clipping;
+                clipping.threads = 1;
+                return sigma_clipped_stats(pixel, clipping).mean;
+            }
+            }
+        }
+
+        template<typename PixelType>
+        void check_stack(std::vector<image_buffer<PixelType>> const& frames, stack_options const& options) const {
+            image_buffer<double> stacked = stack_images(views_of(frames), options);
+            for (std::size_t i = 0; i < stacked.size(); i++) {
+                std::vector<double> values;
+                for (auto const& frame : frames) { values.push_back(static_cast<double>(frame.data()[i])); }
+                double expected = combine_directly(values, options);
+                if (std::isnan(expected)) {
+                    BOOST_REQUIRE(std::isnan(stacked.data()[i]));
+                    continue;
+                }
+                check_close(stacked.data()[i], expected);
+            }
+        }
+
+        template<typename PixelType>
+        void check_methods(std::vector<image_buffer<PixelType>> const& frames) const {
+            for (stack_method method : { stack_method::mean, stack_method::median, stack_method::sigma_clipped_mean }) {
+                stack_options options;
+                options.method = method;
+                options.threads = 2;
+                options.clipping.sigma_lower = options.clipping.sigma_upper = 2;
+                check_stack(frames, options);
+                if (method == stack_method::sigma_clipped_mean) {
+                    options.clipping.center = clip_center::mean;
+                    options.clipping.max_iterations = 1;
+                    check_stack(frames, options);
+                }
+            }
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(image_stacking)
+
+BOOST_FIXTURE_TEST_CASE(stacks_match_pixel_by_pixel, fits_test::image_stacking_fixture) {
+    // Stacks of up to 64 frames are sorted by sorting networks, taller ones pixel by pixel
+    for (std::size_t count : { 1u, 2u, 3u, 8u, 13u, 64u, 65u }) {
+        check_methods(make_frames<std::int16_t>(count, 70, 9));
+    }
+    check_methods(make_frames<float>(9, 130, 5));
+    check_methods(make_frames<std::int32_t>(6, 65, 4));
+    check_methods(make_frames<double>(70, 20, 3));
+
+    // Even stacks of one value repeated keep it exactly, whatever the statistic
+    std::vector<image_buffer<std::uint8_t>> constant(4, image_buffer<std::uint8_t>(3, 2));
+    for (auto& frame : constant) { std::fill(frame.data(), frame.data() + frame.size(), std::uint8_t(200)); }
+    for (stack_method method : { stack_method::mean, stack_method::median, stack_method::sigma_clipped_mean }) {
+        stack_options options;
+        options.method = method;
+        auto stacked = stack_images<std::uint8_t>(views_of(constant), options);
+        BOOST_REQUIRE(std::all_of(stacked.data(), stacked.data() + stacked.size(), [](std::uint8_t v) { return v == 200; }));
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(unusable_values_are_left_out, fits_test::image_stacking_fixture) {
+    for (std::size_t count : { 5u, 70u }) {
+        auto frames = make_frames<float>(count, 90, 4);
+        for (std::size_t frame = 0; frame < count; frame++) {
+            for (std::size_t i = frame; i < frames[frame].size(); i += 11) {
+                frames[frame].data()[i] = i % 2 == 0 ? std::numeric_limits<float>::quiet_NaN() :
+                    std::numeric_limits<float>::infinity();
+            }
+            frames[frame].data()[100] = std::numeric_limits<float>::quiet_NaN();
+        }
+        check_methods(frames);
+
+        auto rounded = stack_images<std::int16_t>(views_of(frames));
+        BOOST_REQUIRE_EQUAL(rounded.data()[100], 0);
+    }
+
+    // Tiles of larger frames stack like whole frames
+    auto frames = make_frames<double>(7, 50, 40);
+    std::vector<image_view<double>> tiles;
+    for (auto const& frame : frames) { tiles.push_back(make_image_view(frame).tile(5, 10, 30, 20)); }
+    auto stacked = stack_images(tiles);
+    for (std::size_t y = 0; y < 20; y++) {
+        for (std::size_t x = 0; x < 30; x++) {
+            std::vector<double> values;
+            for (auto const& tile : tiles) { values.push_back(tile(x, y)); }
+            BOOST_REQUIRE_EQUAL(stacked.data()[y * 30 + x], combine_directly(values, stack_options()));
+        }
+    }
+
+    BOOST_REQUIRE_THROW(stack_images(std::vector<image_view<float>>()), std::invalid_argument);
+    tiles[3] = make_image_view(frames[3]).tile(0, 0, 30, 21);
+    BOOST_REQUIRE_THROW(stack_images(tiles), std::invalid_argument);
+    stack_options negative;
+    negative.clipping.sigma_upper = -1;
+    BOOST_REQUIRE_THROW(stack_images(views_of(frames), negative), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(files_are_stacked_within_the_budget, fits_test::image_stacking_fixture) {
+    const std::size_t width = 37, height = 23;
+    auto integers = make_frames<std::int16_t>(4, width, height);
+    auto reals = make_frames<float>(3, width, height);
+    auto wide = make_frames<std::int32_t>(1, width, height);
+    std::vector<std::string>& paths = frame_paths;
+    std::vector<image_buffer<double>> expected_frames;
+    auto write_frame = [&](auto const& frame, bitpix frame_bitpix) {
+        paths.push_back(samples_directory + "stacked_frame_" + std::to_string(paths.size()) + ".fits");
+        image_writer writer(paths.back(), frame_bitpix, { width, height });
+        writer.write_rows(frame.data(), height);
+        writer.close();
+        expected_frames.emplace_back(width, height);
+        std::copy(frame.data(), frame.data() + frame.size(), expected_frames.back().data());
+    };
+    for (auto const& frame : integers) { write_frame(frame, bitpix::B16); }
+    for (auto const& frame : reals) { write_frame(frame, bitpix::_B32); }
+
+    std::string const& destination = stacked_path;
+    auto check_file = [&](stack_options const& options) {
+        auto expected = stack_images<float>(views_of(expected_frames), options);
+        auto file = fits::open(destination);
+        auto stacked = fits::convert_to<primary_hdu>(file["primary_hdu"]).get_data<bitpix::_B32>();
+        BOOST_REQUIRE_EQUAL(stacked.width(), width);
+        BOOST_REQUIRE_EQUAL(stacked.height(), height);
+        for (std::size_t i = 0; i < stacked.size(); i++) {
+            BOOST_REQUIRE_SMALL(stacked.data()[i] - expected.data()[i], 1e-3f);
+        }
+    };
+
+    // A budget of a few rows stacks the frames over many bands
+    stack_options options;
+    options.memory_budget = 3 * width * (7 * sizeof(float) + 8 + 4);
+    for (stack_method method : { stack_method::mean, stack_method::median, stack_method::sigma_clipped_mean }) {
+        options.method = method;
+        stack_image_files(paths, 0, destination, options);
+        check_file(options);
+    }
+
+    // 32 bit integer frames are combined in double precision
+    write_frame(wide[0], bitpix::B32);
+    options.memory_budget = std::size_t(1) << 20;
+    stack_image_files(paths, 0, destination, options);
+    check_file(options);
+
+    options.memory_budget = width;
+    BOOST_REQUIRE_THROW(stack_image_files(paths, 0, destination, options), std::invalid_argument);
+    {
+        image_writer writer(paths[0], bitpix::B16, { width, height - 1 });
+        writer.write_rows(integers[0].data(), height - 1);
+        writer.close();
+    }
+    BOOST_REQUIRE_THROW(stack_image_files(paths, 0, destination, stack_options()), std::invalid_argument);
+    BOOST_REQUIRE_THROW(stack_image_files({}, 0, destination), std::invalid_argument);
+    BOOST_REQUIRE_THROW(stack_image_files(paths, 1, destination), boost::astronomy::file_reading_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
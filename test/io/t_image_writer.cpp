@@ -0,0 +1,162 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE image_writer_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/image_writer.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <cstdint>
+#include <limits>
+#include <stdio.h>
+#include "base_fixture.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    class image_writer_fixture :public base_fixture<fits_stream, card_policy> {
+    public:
+        std::string image_path;
+
+        image_writer_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+            image_path = samples_directory + "written_image.fits";
+        }
+
+        /**
+         * @brief Reads the data unit of the primary HDU ( its header occupies a single logical record )
+        */
+        std::string read_primary_data(std::size_t size) {
+            fits_stream file;
+            file.set_file(image_path);
+            BOOST_REQUIRE_EQUAL(file.file_size(), 2880 + (size + 2879) / 2880 * 2880);
+            file.set_reading_pos(2880);
+            return file.read(size);
+        }
+
+        ~image_writer_fixture() {
+            remove(image_path.c_str());
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(image_writer_tests)
+
+BOOST_FIXTURE_TEST_CASE(write_row_blocks_to_primary_hdu, fits_test::image_writer_fixture) {
+    {
+        // A buffer smaller than a row block forces every block to be converted in several chunks
+        image_writer writer(image_path, bitpix::B16, { 50, 30 }, "", false, 64);
+        BOOST_REQUIRE_EQUAL(writer.size(), 1500u);
+
+        std::vector<int> rows(50 * 7);
+        for (std::size_t first_row = 0; first_row < 30; first_row += 7) {
+            std::size_t block = std::min<std::size_t>(7, 30 - first_row);
+            for (std::size_t i = 0; i < block * 50; i++) {
+                rows[i] = static_cast<int>(first_row * 50 + i) - 700;
+            }
+            writer.write_rows(rows.data(), block);
+        }
+        BOOST_REQUIRE_EQUAL(writer.pixels_written(), 1500u);
+        BOOST_REQUIRE_THROW(writer.write_rows(rows.data(), 1), boost::astronomy::file_writing_exception);
+    }
+
+    auto fits_file = fits::open(image_path);
+    auto prime_hdu = fits::convert_to<primary_hdu>(fits_file["primary_hdu"]);
+    BOOST_REQUIRE_EQUAL(prime_hdu.get_data<bitpix::B16>().size(), 1500u);
+
+    std::string data = read_primary_data(1500 * 2);
+    for (std::size_t pixel = 0; pixel < 1500; pixel++) {
+        BOOST_REQUIRE_EQUAL((detail::load_big_endian<std::int16_t, std::uint16_t>(&data[2 * pixel])),
+            static_cast<int>(pixel) - 700);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(write_tiles_in_any_order, fits_test::image_writer_fixture) {
+    {
+        image_writer writer(image_path, bitpix::_B32, { 40, 30 }, "", false, 128);
+
+        std::vector<double> tile(16 * 16);
+        // Tiles are written from the bottom right corner and clipped at the edges of the image
+        for (std::size_t y = 0; y < 30; y += 16) {
+            for (std::size_t x = 0; x < 40; x += 16) {
+                std::size_t tile_x = 32 - x, tile_y = 16 - y;
+                std::size_t tile_width = std::min<std::size_t>(16, 40 - tile_x);
+                std::size_t tile_height = std::min<std::size_t>(16, 30 - tile_y);
+                for (std::size_t row = 0; row < tile_height; row++) {
+                    for (std::size_t col = 0; col < tile_width; col++) {
+                        tile[row * tile_width + col] = static_cast<double>((tile_y + row) * 40 + tile_x + col) * 0.5;
+                    }
+                }
+                writer.write_tile(tile.data(), tile_x, tile_y, tile_width, tile_height);
+            }
+        }
+        BOOST_REQUIRE_THROW(writer.write_tile(tile.data(), 30, 0, 16, 16), boost::astronomy::file_writing_exception);
+    }
+
+    std::string data = read_primary_data(1200 * 4);
+    for (std::size_t pixel = 0; pixel < 1200; pixel++) {
+        BOOST_REQUIRE_EQUAL((detail::load_big_endian<float, std::uint32_t>(&data[4 * pixel])),
+            static_cast<float>(pixel) * 0.5f);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(append_image_extension_with_unwritten_pixels, fits_test::image_writer_fixture) {
+    {
+        image_writer writer(image_path, bitpix::B8, { 10, 10 });
+        std::vector<std::uint8_t> pixels(100, 7);
+        writer.write_pixels(pixels.data(), pixels.size());
+    }
+    {
+        image_writer writer(image_path, bitpix::B32, { 1000, 3 }, "SCI", true);
+        std::vector<std::int32_t> row(1000, -5);
+        writer.write_rows(row.data(), 1);
+    }
+
+    fits_stream file;
+    file.set_file(image_path);
+    BOOST_REQUIRE_EQUAL(file.file_size() % 2880, 0u);
+
+    header<card_policy> extension_header;
+    file.set_reading_pos(2 * 2880);
+    extension_header.read_header(file);
+    BOOST_REQUIRE_EQUAL(extension_header.value_of<std::string>("XTENSION"), "IMAGE");
+    BOOST_REQUIRE_EQUAL(extension_header.value_of<std::string>("EXTNAME"), "SCI");
+    BOOST_REQUIRE_EQUAL(extension_header.naxis(2), 3u);
+
+    std::size_t data_location = 3 * 2880;
+    BOOST_REQUIRE_EQUAL(file.file_size(), data_location + 5 * 2880);
+    file.set_reading_pos(data_location + 3996);
+    std::string data = file.read(8);
+    BOOST_REQUIRE_EQUAL(static_cast<unsigned char>(data[3]), 0xFBu);
+    BOOST_REQUIRE_EQUAL(data.substr(4), std::string(4, '\0'));
+}
+
+BOOST_FIXTURE_TEST_CASE(saturate_values_outside_integer_pixels, fits_test::image_writer_fixture) {
+    {
+        image_writer writer(image_path, bitpix::B16, { 6 });
+        std::vector<double> values = { std::numeric_limits<double>::quiet_NaN(), 1e10, -1e10, 2.6, -2.6,
+            std::numeric_limits<double>::infinity() };
+        writer.write_pixels(values.data(), values.size());
+    }
+
+    std::string data = read_primary_data(12);
+    std::vector<std::int16_t> expected = { 0, 32767, -32768, 3, -3, 32767 };
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        BOOST_REQUIRE_EQUAL((detail::load_big_endian<std::int16_t, std::uint16_t>(data.data() + 2 * i)), expected[i]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
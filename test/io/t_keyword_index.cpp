@@ -0,0 +1,126 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE keyword_index_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/astronomy/io/keyword_index.hpp>
+#include <boost/astronomy/io/header_editor.hpp>
+#include <boost/astronomy/io/fits_generator.hpp>
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    class keyword_index_fixture {
+        std::string samples_directory;
+    public:
+        std::string index_directory;
+
+        keyword_index_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+            index_directory = samples_directory + "keyword_index_tree";
+            boost::filesystem::create_directories(index_directory + "/night2");
+
+            add_frame("/frame1.fits", "r", 600.0);
+            add_frame("/frame2.fits", "g", 900.0);
+            add_frame("/night2/frame3.fits", "r", 120.0);
+        }
+
+        ~keyword_index_fixture() {
+            boost::filesystem::remove_all(index_directory);
+        }
+
+        std::string get_path(const std::string& file_name) {
+            return samples_directory + file_name;
+        }
+
+        /**
+         * @brief Generates a frame with an IMAGE extension and tags its primary header
+        */
+        void add_frame(const std::string& name, const std::string& filter, double exposure) {
+            {
+                boost::astronomy::io::fits_generator generator(index_directory + name);
+                generator.write_primary_image(bitpix::B16, { 10, 10 });
+                generator.write_image_extension(bitpix::_B32, { 8, 8 }, "SCI");
+                generator.close();
+            }
+            header_editor editor;
+            editor.set_value("FILTER", filter).set_value("EXPTIME", exposure);
+            editor.apply(index_directory + name);
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(keyword_index_methods)
+
+BOOST_FIXTURE_TEST_CASE(query_indexed_keywords, fits_test::keyword_index_fixture) {
+    keyword_index index({ "FILTER", "EXPTIME", "EXTNAME", "SIMPLE" });
+    auto summary = index.update(index_directory, 2);
+
+    BOOST_REQUIRE_EQUAL(summary.files_scanned, 3u);
+    BOOST_REQUIRE(summary.failed_files.empty());
+    BOOST_REQUIRE_EQUAL(index.total_files(), 3u);
+    BOOST_REQUIRE_EQUAL(index.total_hdus(), 6u);
+
+    auto matches = index.find(keyword_query().equal("FILTER", "r").greater("EXPTIME", 300));
+    BOOST_REQUIRE_EQUAL(matches.size(), 1u);
+    BOOST_REQUIRE(matches[0].path.find("frame1.fits") != std::string::npos);
+    BOOST_REQUIRE_EQUAL(matches[0].hdu_index, 0u);
+
+    BOOST_REQUIRE_EQUAL(index.find(keyword_query().between("EXPTIME", 100, 600)).size(), 2u);
+    BOOST_REQUIRE_EQUAL(index.find(keyword_query().equal("EXTNAME", "SCI")).size(), 3u);
+    BOOST_REQUIRE_EQUAL(index.find(keyword_query().equal("SIMPLE", true)).size(), 3u);
+    BOOST_REQUIRE_THROW(index.find(keyword_query().equal("OBJECT", "M31")), boost::astronomy::key_not_defined_exception);
+}
+
+BOOST_FIXTURE_TEST_CASE(save_and_load_index, fits_test::keyword_index_fixture) {
+    keyword_index index({ "FILTER", "EXPTIME" });
+    index.update(index_directory);
+
+    std::string index_path = get_path("keywords.idx");
+    index.save(index_path);
+    keyword_index loaded = keyword_index::load(index_path);
+    remove(index_path.c_str());
+
+    BOOST_REQUIRE(loaded.get_keywords() == index.get_keywords());
+    BOOST_REQUIRE_EQUAL(loaded.total_hdus(), 6u);
+    auto matches = loaded.find(keyword_query().equal("FILTER", "g"));
+    BOOST_REQUIRE_EQUAL(matches.size(), 1u);
+    BOOST_REQUIRE(matches[0].path.find("frame2.fits") != std::string::npos);
+
+    BOOST_REQUIRE_THROW(keyword_index::load(get_path("test_random_file.txt")), boost::astronomy::file_reading_exception);
+}
+
+BOOST_FIXTURE_TEST_CASE(update_only_modified_files, fits_test::keyword_index_fixture) {
+    keyword_index index({ "FILTER", "EXPTIME" });
+    index.update(index_directory);
+
+    std::string modified = index_directory + "/night2/frame3.fits";
+    header_editor editor;
+    editor.set_value("EXPTIME", 450.0);
+    editor.apply(modified);
+    boost::filesystem::last_write_time(modified, boost::filesystem::last_write_time(modified) + 10);
+    boost::filesystem::remove(index_directory + "/frame2.fits");
+
+    auto summary = index.update(index_directory);
+    BOOST_REQUIRE_EQUAL(summary.files_scanned, 1u);
+    BOOST_REQUIRE_EQUAL(summary.files_unchanged, 1u);
+    BOOST_REQUIRE_EQUAL(summary.files_removed, 1u);
+    BOOST_REQUIRE_EQUAL(index.total_files(), 2u);
+    BOOST_REQUIRE_EQUAL(index.find(keyword_query().equal("FILTER", "r").greater("EXPTIME", 300)).size(), 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
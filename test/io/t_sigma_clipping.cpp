@@ -0,0 +1,174 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE sigma_clipping_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/sigma_clipping.hpp>
+#include "sky_fixture.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    class sigma_clipping_fixture : public sky_fixture {
+    public:
+        sigma_clipping_fixture() : sky_fixture(7) {}
+
+        /**
+         * @brief Clips the pixels the straightforward way, sorting them for every median
+        */
+        template<typename PixelType>
+        clipped_statistics clip_directly(const image_buffer<PixelType>& image, const std::vector<bool>& masked,
+            sigma_clip_options const& options) const {
+            std::vector<double> values;
+            for (std::size_t i = 0; i < image.size(); i++) {
+                double value = static_cast<double>(image.data()[i]);
+                if (std::isfinite(value) && (masked.empty() || !masked[i])) { values.push_back(value); }
+            }
+
+            auto mean_of = [](std::vector<double> const& v) { return std::accumulate(v.begin(), v.end(), 0.0) / static_cast<double>(v.size()); };
+            auto median_of = [](std::vector<double> v) {
+                std::sort(v.begin(), v.end());
+                return 0.5 * (v[(v.size() - 1) / 2] + v[v.size() / 2]);
+            };
+            auto std_of = [&](std::vector<double> const& v) {
+                double mean = mean_of(v), sum = 0;
+                for (double value : v) { sum += (value - mean) * (value - mean); }
+                return std::sqrt(sum / static_cast<double>(v.size()));
+            };
+
+            clipped_statistics statistics;
+            std::size_t usable = values.size();
+            while (statistics.iterations < options.max_iterations && !values.empty()) {
+                double center = options.center == clip_center::median ? median_of(values) : mean_of(values);
+                double deviation = std_of(values);
+                std::vector<double> kept;
+                for (double value : values) {
+                    if (value >= center - options.sigma_lower * deviation && value <= center + options.sigma_upper * deviation) {
+                        kept.push_back(value);
+                    }
+                }
+                statistics.iterations++;
+                bool converged = kept.size() == values.size();
+                values.swap(kept);
+                if (converged) { break; }
+            }
+
+            statistics.count = values.size();
+            statistics.rejected = usable - values.size();
+            if (!values.empty()) {
+                statistics.mean = mean_of(values);
+                statistics.median = median_of(values);
+                statistics.standard_deviation = std_of(values);
+            }
+            return statistics;
+        }
+
+        void check_statistics(clipped_statistics const& statistics, clipped_statistics const& expected) const {
+            BOOST_REQUIRE_EQUAL(statistics.count, expected.count);
+            BOOST_REQUIRE_EQUAL(statistics.rejected, expected.rejected);
+            BOOST_REQUIRE_EQUAL(statistics.iterations, expected.iterations);
+            double scale = std::max(1.0, std::fabs(expected.mean));
+            BOOST_REQUIRE_SMALL(statistics.mean - expected.mean, 1e-9 * scale);
+            BOOST_REQUIRE_SMALL(statistics.median - expected.median, 1e-9 * scale);
+            BOOST_REQUIRE_SMALL(statistics.standard_deviation - expected.standard_deviation, 1e-9 * scale);
+        }
+
+        template<typename PixelType>
+        void check_clipping(const image_buffer<PixelType>& image) const {
+            for (clip_center center : { clip_center::median, clip_center::mean }) {
+                for (std::size_t threads : { 1u, 4u }) {
+                    sigma_clip_options options;
+                    options.center = center;
+                    options.threads = threads;
+                    options.sigma_lower = 2.5;
+                    options.max_iterations = 10;
+                    check_statistics(sigma_clipped_stats(image, options), clip_directly(image, {}, options));
+                }
+            }
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(sigma_clipping)
+
+BOOST_FIXTURE_TEST_CASE(clipping_matches_sorting, fits_test::sigma_clipping_fixture) {
+    check_clipping(make_sky<float>(400, 350, 1000.0, 10.0));
+    check_clipping(make_sky<double>(400, 350, -3.0, 0.001));
+    check_clipping(make_sky<std::int16_t>(400, 350, 1000.0, 10.0));
+    check_clipping(make_sky<std::int32_t>(400, 350, 0.0, 20000.0));
+
+    // Few distinct values crowd the median bins, and a distant pixel packs the rest into one bin to be refined
+    image_buffer<float> steps(500, 300);
+    auto clustered = make_sky<double>(500, 300, 0.0, 1.0);
+    for (std::size_t i = 0; i < steps.size(); i++) { steps.data()[i] = i % 1000 == 0 ? 30000.0f : static_cast<float>(990 + i % 20); }
+    clustered.data()[123] = 1e12;
+    check_clipping(steps);
+    check_clipping(clustered);
+
+    auto sky = make_sky<float>(300, 300, 500.0, 5.0);
+    clipped_statistics statistics = sigma_clipped_stats(make_image_view(sky));
+    BOOST_REQUIRE(statistics.rejected > 0);
+    BOOST_REQUIRE_SMALL(statistics.median - 500.0, 0.2);
+    BOOST_REQUIRE_SMALL(statistics.standard_deviation - 5.0, 0.2);
+}
+
+BOOST_FIXTURE_TEST_CASE(masked_and_unusable_pixels_are_ignored, fits_test::sigma_clipping_fixture) {
+    auto sky = make_sky<float>(200, 150, 100.0, 3.0);
+    image_buffer<std::uint8_t> mask(200, 150);
+    std::vector<bool> masked(sky.size(), false);
+    for (std::size_t i = 0; i < sky.size(); i++) {
+        if (i % 13 == 0) { sky.data()[i] = std::numeric_limits<float>::quiet_NaN(); }
+        mask.data()[i] = (i % 7 == 0) ? 1 : 0;
+        masked[i] = i % 7 == 0;
+    }
+
+    sigma_clip_options options;
+    clipped_statistics statistics = sigma_clipped_stats(make_image_view(sky), make_image_view(mask), options);
+    check_statistics(statistics, clip_directly(sky, masked, options));
+    check_statistics(sigma_clipped_stats(sky, mask, options), statistics);
+
+    image_buffer<std::uint8_t> everything(200, 150);
+    for (std::size_t i = 0; i < everything.size(); i++) { everything.data()[i] = 255; }
+    clipped_statistics empty = sigma_clipped_stats(sky, everything);
+    BOOST_REQUIRE_EQUAL(empty.count, 0u);
+    BOOST_REQUIRE(std::isnan(empty.mean) && std::isnan(empty.median) && std::isnan(empty.standard_deviation));
+
+    BOOST_REQUIRE_THROW(sigma_clipped_stats(make_image_view(sky), make_image_view(image_buffer<std::uint8_t>(10, 10))),
+        std::invalid_argument);
+    options.sigma_upper = -1;
+    BOOST_REQUIRE_THROW(sigma_clipped_stats(sky, options), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(iteration_limits_and_constant_images, fits_test::sigma_clipping_fixture) {
+    auto sky = make_sky<double>(100, 100, 10.0, 1.0);
+    sigma_clip_options options;
+    options.max_iterations = 0;
+    clipped_statistics unclipped = sigma_clipped_stats(sky, options);
+    BOOST_REQUIRE_EQUAL(unclipped.iterations, 0u);
+    BOOST_REQUIRE_EQUAL(unclipped.count, sky.size());
+    check_statistics(unclipped, clip_directly(sky, {}, options));
+
+    options.max_iterations = 1;
+    check_statistics(sigma_clipped_stats(sky, options), clip_directly(sky, {}, options));
+
+    image_buffer<std::int32_t> constant(50, 20);
+    for (std::size_t i = 0; i < constant.size(); i++) { constant.data()[i] = -7; }
+    clipped_statistics flat = sigma_clipped_stats(constant);
+    BOOST_REQUIRE_EQUAL(flat.count, 1000u);
+    BOOST_REQUIRE_EQUAL(flat.iterations, 1u);
+    BOOST_REQUIRE_EQUAL(flat.median, -7.0);
+    BOOST_REQUIRE_EQUAL(flat.standard_deviation, 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,8 @@ file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include <boost/test/unit_test.hpp>
 #include <boost/astronomy/exception/fits_exception.hpp>
 #include <boost/astronomy/io/string_conversion_utility.hpp>
+#include <limits>
+#include <string>
 
 using namespace boost::astronomy::io;
 
@@ -56,6 +58,40 @@ BOOST_AUTO_TEST_CASE(raise_exception_on_incompatible_type) {
     BOOST_REQUIRE_THROW(ascii_converter::deserialize_to<int>("14.23",0), boost::astronomy::invalid_cast);
 }
 
+BOOST_AUTO_TEST_CASE(serialize_integers) {
+
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize(-2147483647 - 1), "-2147483648");
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize(18446744073709551615ull), "18446744073709551615");
+}
+
+BOOST_AUTO_TEST_CASE(serialize_floating_point_round_trip) {
+
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize(1.4f), "1.4");
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize(1234323.2334242), "1234323.2334242");
+
+    double value = 2.0 / 3.0;
+    BOOST_REQUIRE_EQUAL(ascii_converter::deserialize_to<double>(ascii_converter::serialize(value), 0), value);
+}
+
+BOOST_AUTO_TEST_CASE(serialize_to_field_format) {
+
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize_field(1234323.2334242, "'E15.7  '"), "1.2343232E+06");
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize_field(-0.5f, "D12.4"), "-5.0000E-01");
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize_field(2.0 / 3.0, "F8.3"), "0.667");
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize_field(7, "F8.3"), "7.000");
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize_field(-41.6, "I6"), "-42");
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize_field(-2147483647 - 1, "I11"), "-2147483648");
+    BOOST_REQUIRE_EQUAL(ascii_converter::serialize_field(std::string("ABC"), "A4"), "ABC");
+
+    BOOST_REQUIRE_THROW(ascii_converter::serialize_field(123456, "I5"), boost::astronomy::invalid_table_colum_format);
+    BOOST_REQUIRE_THROW(ascii_converter::serialize_field(1234323.2334242, "F8.3"), boost::astronomy::invalid_table_colum_format);
+    BOOST_REQUIRE_THROW(ascii_converter::serialize_field(1.0, "E"), boost::astronomy::invalid_table_colum_format);
+    BOOST_REQUIRE_THROW(ascii_converter::serialize_field(std::numeric_limits<double>::quiet_NaN(), "E15.7"),
+        boost::astronomy::invalid_cast);
+    BOOST_REQUIRE_THROW(ascii_converter::serialize_field(-std::numeric_limits<float>::infinity(), "F10.2"),
+        boost::astronomy::invalid_cast);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,135 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE table_schema_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/table_schema.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/binary_data_converter.hpp>
+#include <boost/astronomy/io/fits_generator.hpp>
+#include <boost/astronomy/io/fits_stream.hpp>
+#include <stdio.h>
+#include "base_fixture.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    BOOST_ASTRONOMY_TABLE_COLUMN(count_col, "COL1", std::int32_t);
+    BOOST_ASTRONOMY_TABLE_COLUMN(flux_col, "COL2", float);
+    BOOST_ASTRONOMY_TABLE_COLUMN(ra_col, "COL3", double);
+    BOOST_ASTRONOMY_TABLE_COLUMN(flag_col, "COL5", bool);
+    BOOST_ASTRONOMY_TABLE_COLUMN(name_col, "COL7", std::string);
+    BOOST_ASTRONOMY_TABLE_COLUMN(spectrum_col, "COL8", std::array<float, 4>);
+    BOOST_ASTRONOMY_TABLE_COLUMN(phase_col, "COL10", std::complex<double>);
+    BOOST_ASTRONOMY_TABLE_COLUMN(wrong_type_col, "COL1", double);
+    BOOST_ASTRONOMY_TABLE_COLUMN(wrong_repeat_col, "COL8", std::array<float, 3>);
+    BOOST_ASTRONOMY_TABLE_COLUMN(missing_col, "MISSING", double);
+
+    typedef basic_binary_table_extension<card_policy, binary_data_converter> binary_table_type;
+
+    class table_schema_fixture :public base_fixture<fits_stream, card_policy> {
+        std::string sample_path;
+    public:
+        hdu_store<card_policy>* raw_table;
+
+        table_schema_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+            sample_path = samples_directory + "typed_table_sample.fits";
+            {
+                boost::astronomy::io::fits_generator generator(sample_path, 11);
+                generator.write_binary_table(50, boost::astronomy::io::fits_generator::mixed_column_forms(12), "TYPED");
+                generator.close();
+            }
+            load_file("typed_table_sample.fits");
+            raw_table = get_raw_hdu("typed_table_sample", "BINTABLE");
+        }
+
+        ~table_schema_fixture() {
+            remove(sample_path.c_str());
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(typed_binary_table_access)
+
+BOOST_FIXTURE_TEST_CASE(fields_match_binary_table, fits_test::table_schema_fixture) {
+    using namespace fits_test;
+    BOOST_REQUIRE(raw_table != nullptr);
+
+    typed_binary_table<table_schema<count_col, flux_col, ra_col, spectrum_col>> typed_table(
+        raw_table->hdu_header, raw_table->hdu_data_buffer);
+    binary_table_type table(raw_table->hdu_header, raw_table->hdu_data_buffer);
+
+    BOOST_REQUIRE_EQUAL(typed_table.total_rows(), 50u);
+
+    auto& counts = table.get_column<boost::int32_t>("COL1");
+    auto& fluxes = table.get_column<boost::float32_t>("COL2");
+    auto& ras = table.get_column<boost::float64_t>("COL3");
+    auto& spectra = table.get_column<std::vector<boost::float32_t>>("COL8");
+
+    for (std::size_t row = 0; row < 50; row++) {
+        BOOST_REQUIRE_EQUAL(typed_table.get<count_col>(row), counts[static_cast<int>(row)]);
+        BOOST_REQUIRE_EQUAL(typed_table.get<flux_col>(row), fluxes[static_cast<int>(row)]);
+        BOOST_REQUIRE_EQUAL(typed_table.get<ra_col>(row), ras[static_cast<int>(row)]);
+
+        std::array<float, 4> spectrum = typed_table.get<spectrum_col>(row);
+        std::vector<boost::float32_t> expected = spectra[static_cast<int>(row)];
+        BOOST_REQUIRE_EQUAL_COLLECTIONS(spectrum.begin(), spectrum.end(), expected.begin(), expected.end());
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(column_view_is_strided_over_rows, fits_test::table_schema_fixture) {
+    using namespace fits_test;
+
+    binary_table_type table(raw_table->hdu_header, raw_table->hdu_data_buffer);
+    typed_binary_table<table_schema<flag_col, name_col, phase_col, ra_col>> typed_table(table);
+
+    auto names = typed_table.column<name_col>();
+    auto ras = typed_table.column<ra_col>();
+    BOOST_REQUIRE_EQUAL(names.size(), 50u);
+
+    std::size_t row = 0;
+    for (auto ra : ras) {
+        BOOST_REQUIRE_EQUAL(ra, typed_table.get<ra_col>(row));
+        BOOST_REQUIRE_EQUAL(names[row].size(), 16u);
+        row++;
+    }
+    BOOST_REQUIRE_EQUAL(row, 50u);
+
+    std::size_t row_width = table.get_header().naxis(1);
+    const std::string& raw_rows = raw_table->hdu_data_buffer;
+    BOOST_REQUIRE_EQUAL(names[1], raw_rows.substr(row_width + 20, 16));
+    BOOST_REQUIRE_EQUAL(typed_table.get<flag_col>(1), raw_rows[row_width + 18] == 'T');
+}
+
+BOOST_FIXTURE_TEST_CASE(schema_is_validated_against_header, fits_test::table_schema_fixture) {
+    using namespace fits_test;
+
+    typedef typed_binary_table<table_schema<wrong_type_col>> wrong_type_table;
+    typedef typed_binary_table<table_schema<wrong_repeat_col>> wrong_repeat_table;
+    typedef typed_binary_table<table_schema<ra_col, missing_col>> missing_column_table;
+
+    BOOST_REQUIRE_THROW(wrong_type_table(raw_table->hdu_header, raw_table->hdu_data_buffer),
+        boost::astronomy::invalid_table_colum_format);
+    BOOST_REQUIRE_THROW(wrong_repeat_table(raw_table->hdu_header, raw_table->hdu_data_buffer),
+        boost::astronomy::invalid_table_colum_format);
+    BOOST_REQUIRE_THROW(missing_column_table(raw_table->hdu_header, raw_table->hdu_data_buffer),
+        boost::astronomy::column_not_found_exception);
+    BOOST_REQUIRE_THROW(typed_binary_table<table_schema<ra_col>>(raw_table->hdu_header, raw_table->hdu_data_buffer.substr(0, 100)),
+        boost::astronomy::file_reading_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,155 @@
+/*=============================================================================
+Copyright 2026 agent <agent@local>
+
+Distributed under the Boost Software License, Version 1.0. (See accompanying
+file License.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MODULE uring_reader_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/uring_reader.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/fits_generator.hpp>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdio.h>
+
+using namespace boost::astronomy::io;
+
+namespace fits_test {
+
+    class uring_reader_fixture {
+    public:
+        std::string samples_directory;
+        std::string generated_path;
+        std::string contents;
+
+        /**
+         * @brief Generates a file with a primary image of 256 KiB followed by a binary table
+        */
+        uring_reader_fixture() {
+#ifdef SOURCE_DIR
+            samples_directory = std::string((std::string(SOURCE_DIR) +
+                "/fits_sample_files/"));
+#else
+            samples_directory = std::string(
+                std::string(boost::unit_test::framework::master_test_suite().argv[1]) +
+                "/fits_sample_files/");
+#endif
+            generated_path = samples_directory + "uring_reader.fits";
+            fits_generator generator(generated_path, 5);
+            generator.write_primary_image(bitpix::B32, { 256, 256 });
+            generator.write_binary_table(4000, { "J", "D", "4A" }, "TABLE1");
+            generator.close();
+            contents = read_file(generated_path);
+        }
+
+        ~uring_reader_fixture() {
+            remove(generated_path.c_str());
+        }
+
+        std::string read_file(const std::string& path) const {
+            std::ifstream file(path, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        /**
+         * @brief Queues three reads ( the last one running past the end of file ) and checks every chunk
+        */
+        void check_queued_reads(uring_read_queue& queue) const {
+            std::vector<std::string> reads(3);
+            std::vector<std::size_t> bytes_received(3, 0);
+            reads[0].assign(100000, '\0');
+            reads[1].assign(5000, '\0');
+            reads[2].assign(10000, '\0');
+            std::size_t offsets[] = { 1000, 70001, contents.size() - 6000 };
+
+            for (std::size_t tag = 0; tag < 3; tag++) { queue.enqueue(offsets[tag], reads[tag].size(), tag); }
+            BOOST_REQUIRE_EQUAL(queue.outstanding(), 25u + 2u + 3u);
+
+            queue.drain([&](const read_completion& completion) {
+                BOOST_REQUIRE(completion.tag < 3);
+                std::memcpy(&reads[completion.tag][completion.position], completion.data, completion.size);
+                bytes_received[completion.tag] += completion.size;
+            });
+            BOOST_REQUIRE_EQUAL(queue.outstanding(), 0u);
+
+            for (std::size_t tag = 0; tag < 2; tag++) {
+                BOOST_REQUIRE_EQUAL(bytes_received[tag], reads[tag].size());
+                BOOST_REQUIRE(reads[tag] == contents.substr(offsets[tag], reads[tag].size()));
+            }
+            BOOST_REQUIRE_EQUAL(bytes_received[2], 6000u);
+            BOOST_REQUIRE(reads[2].substr(0, 6000) == contents.substr(offsets[2]));
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(uring_read_queue_tests)
+
+BOOST_FIXTURE_TEST_CASE(complete_chunks_with_io_uring, fits_test::uring_reader_fixture) {
+    uring_options options;
+    options.queue_depth = 8;
+    options.chunk_size = 4096;
+    uring_read_queue queue(generated_path, options);
+#ifdef BOOST_ASTRONOMY_IO_HAS_IO_URING
+    BOOST_TEST_MESSAGE("io_uring in use: " << queue.uses_io_uring());
+#endif
+    check_queued_reads(queue);
+}
+
+BOOST_FIXTURE_TEST_CASE(complete_chunks_with_positional_reads, fits_test::uring_reader_fixture) {
+    uring_options options;
+    options.chunk_size = 4096;
+    options.use_io_uring = false;
+    uring_read_queue queue(generated_path, options);
+    BOOST_REQUIRE(!queue.uses_io_uring());
+    check_queued_reads(queue);
+}
+
+BOOST_FIXTURE_TEST_CASE(queue_reads_from_handler, fits_test::uring_reader_fixture) {
+    uring_options options;
+    options.queue_depth = 4;
+    options.chunk_size = 2880;
+    uring_read_queue queue(generated_path, options);
+
+    // Every header record read queues the next one until the END card of the primary header is found
+    std::string header;
+    queue.enqueue(0, 2880);
+    queue.drain([&](const read_completion& completion) {
+        std::string record(completion.data, completion.size);
+        header += record;
+        bool end_found = false;
+        for (std::size_t card = 0; card < record.size(); card += 80) {
+            if (record.compare(card, 8, "END     ") == 0) { end_found = true; }
+        }
+        if (!end_found) { queue.enqueue(header.size(), 2880); }
+    });
+    BOOST_REQUIRE(header == contents.substr(0, header.size()));
+
+    std::string data(300000, '\0');
+    BOOST_REQUIRE_EQUAL(queue.read(2880, &data[0], data.size()), data.size());
+    BOOST_REQUIRE(data == contents.substr(2880, data.size()));
+
+    queue.enqueue(0, 10);
+    BOOST_REQUIRE_THROW(queue.read(0, &data[0], 10), boost::astronomy::file_reading_exception);
+}
+
+BOOST_FIXTURE_TEST_CASE(read_hdus_through_fits_io, fits_test::uring_reader_fixture) {
+    typedef default_hdu_manager<card_policy, ascii_converter, binary_data_converter> hdu_manager;
+    fits_io<uring_stream, hdu_manager> uring_reader(generated_path);
+    uring_reader.read_entire_hdus();
+    fits_io<fits_stream, hdu_manager> stream_reader(generated_path);
+    stream_reader.read_entire_hdus();
+
+    std::string uring_copy = generated_path + ".uring", stream_copy = generated_path + ".stream";
+    uring_reader.write_to(uring_copy);
+    stream_reader.write_to(stream_copy);
+    BOOST_REQUIRE(read_file(uring_copy) == read_file(stream_copy));
+
+    remove(uring_copy.c_str());
+    remove(stream_copy.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()